@@ -83,8 +83,11 @@ LOCAL_SRC_FILES := \
         src/armnnUtils/HeapProfiling.cpp \
         src/armnnUtils/LeakChecking.cpp \
         src/armnnUtils/Logging.cpp \
+        src/armnnUtils/MappedFile.cpp \
+        src/armnnUtils/ParallelFor.cpp \
         src/armnnUtils/ParserHelper.cpp \
         src/armnnUtils/Permute.cpp \
+        src/armnnUtils/TensorDataset.cpp \
         src/armnnUtils/TensorUtils.cpp \
         src/armnnUtils/VerificationHelpers.cpp \
         src/armnn/layers/ActivationLayer.cpp \
@@ -145,15 +148,18 @@ LOCAL_SRC_FILES := \
         src/armnn/Layer.cpp \
         src/armnn/LoadedNetwork.cpp \
         src/armnn/Network.cpp \
+        src/armnn/NetworkScheduler.cpp \
         src/armnn/NetworkUtils.cpp \
         src/armnn/WallClockTimer.cpp \
         src/armnn/ProfilingEvent.cpp \
         src/armnn/Profiling.cpp \
         src/armnn/JsonPrinter.cpp \
         src/armnn/Tensor.cpp \
+        src/armnn/TensorObserver.cpp \
         src/armnn/TypesUtils.cpp \
         src/armnn/Utils.cpp \
         src/armnn/LayerSupport.cpp \
+        src/armnn/LayerSupportCache.cpp \
         src/armnn/Observable.cpp
 
 LOCAL_STATIC_LIBRARIES := \
@@ -254,6 +260,7 @@ LOCAL_SRC_FILES := \
         src/armnn/test/RuntimeTests.cpp \
         src/armnn/test/SubgraphViewTests.cpp \
         src/armnn/test/TensorTest.cpp \
+        src/armnn/test/NetworkSchedulerTest.cpp \
         src/armnn/test/NetworkTests.cpp \
         src/armnn/test/InstrumentTests.cpp \
         src/armnn/test/ProfilingEventTest.cpp \
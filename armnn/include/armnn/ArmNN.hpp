@@ -13,6 +13,7 @@
 #include "LstmParams.hpp"
 #include "Optional.hpp"
 #include "Tensor.hpp"
+#include "TensorObserver.hpp"
 #include "Types.hpp"
 #include "TypesUtils.hpp"
 #include "Utils.hpp"
@@ -550,6 +550,7 @@ struct LstmDescriptor
     , m_CifgEnabled(true)
     , m_PeepholeEnabled(false)
     , m_ProjectionEnabled(false)
+    , m_SequenceMode(false)
     {}
 
     /// @brief The activation function to use.
@@ -565,6 +566,10 @@ struct LstmDescriptor
     bool m_PeepholeEnabled;
     /// Enable/disable the projection layer.
     bool m_ProjectionEnabled;
+    /// Enable/disable sequence mode. In sequence mode the input is a time-major sequence
+    /// [timeSteps, batchSize, inputSize] that is processed in one go, the output holds the output of every time step,
+    /// [timeSteps, batchSize, outputSize], and the state outputs hold the state after the last time step.
+    bool m_SequenceMode;
 };
 
 /// A MeanDescriptor for the MeanLayer.
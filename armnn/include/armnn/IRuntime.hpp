@@ -8,6 +8,7 @@
 #include "INetwork.hpp"
 #include "IProfiler.hpp"
 #include "Tensor.hpp"
+#include "TensorObserver.hpp"
 #include "Types.hpp"
 #include "TypesUtils.hpp"
 
@@ -23,6 +24,43 @@ class IGpuAccTunedParameters;
 class IRuntime;
 using IRuntimePtr = std::unique_ptr<IRuntime, void(*)(IRuntime* runtime)>;
 
+/// Scheduling parameters of a network loaded into a runtime that has a shared worker pool
+/// (see IRuntime::CreationOptions::m_NumSchedulerThreads).
+struct NetworkSchedulingOptions
+{
+    NetworkSchedulingOptions()
+        : m_Priority(1)
+        , m_CoreBudget(0)
+    {}
+
+    /// Relative share of worker time when several networks have queued requests. A network with priority 2
+    /// receives twice the execution time of a network with priority 1. Must be at least 1.
+    unsigned int m_Priority;
+
+    /// Number of pool workers (and therefore CPU cores, when the workers are pinned) the requests of this network
+    /// may run on. Keeping a network on a subset of the cores keeps its weights warm in those cores' caches.
+    /// 0 means all workers.
+    unsigned int m_CoreBudget;
+};
+
+/// Per-network counters collected by the runtime scheduler. All values are zero if the scheduler is disabled.
+struct NetworkSchedulingCounters
+{
+    NetworkSchedulingCounters()
+        : m_QueueDepth(0)
+        , m_CompletedRequests(0)
+        , m_MeanQueueLatencyUs(0.0)
+        , m_MaxQueueLatencyUs(0.0)
+        , m_MeanExecutionLatencyUs(0.0)
+    {}
+
+    unsigned int  m_QueueDepth;             ///< Requests waiting for a worker right now.
+    unsigned long m_CompletedRequests;
+    double        m_MeanQueueLatencyUs;     ///< Time from EnqueueWorkload() until a worker picks the request up.
+    double        m_MaxQueueLatencyUs;
+    double        m_MeanExecutionLatencyUs; ///< Time spent executing the request on a worker.
+};
+
 class IRuntime
 {
 public:
@@ -31,6 +69,8 @@ public:
         CreationOptions()
             : m_GpuAccTunedParameters(nullptr)
             , m_EnableGpuProfiling(false)
+            , m_NumSchedulerThreads(0)
+            , m_PinSchedulerThreads(false)
         {}
 
         /// If set, uses the GpuAcc tuned parameters from the given object when executing GPU workloads.
@@ -39,6 +79,15 @@ public:
 
         // Setting this flag will allow the user to obtain GPU profiling information from the runtime.
         bool m_EnableGpuProfiling;
+
+        /// If non-zero, EnqueueWorkload() hands each request to a pool of this many worker threads shared by all
+        /// loaded networks, and blocks until it has been executed. Requests are queued per network and dispatched
+        /// fairly according to each network's NetworkSchedulingOptions. If zero, every request runs on the
+        /// calling thread.
+        unsigned int m_NumSchedulerThreads;
+
+        /// Pins each scheduler worker thread to its own CPU core (where the platform supports it).
+        bool m_PinSchedulerThreads;
     };
 
     static IRuntime* CreateRaw(const CreationOptions& options);
@@ -89,6 +138,31 @@ public:
     /// @param func callback function to pass to the debug layer.
     virtual void RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func) = 0;
 
+    /// Sets a function called with the outputs of layers each time they are computed, without Debug layers in the
+    /// network. Replaces the observer set before, and enables observation.
+    /// @param networkId The id of the network to observe.
+    /// @param observer The function to call. An empty function disables observation.
+    /// @param layers The guids of the layers of the INetwork to observe the outputs of. Empty observes every layer.
+    /// @return armnn::Status Failure if the network is not loaded.
+    virtual Status SetTensorObserver(NetworkId networkId,
+                                     const TensorObserverFunction& observer,
+                                     const std::vector<LayerGuid>& layers = {}) = 0;
+
+    /// Switches the tensor observer of a network on or off, e.g. to only sample some executions. A disabled
+    /// observer has no per-layer cost.
+    /// @return armnn::Status Failure if the network is not loaded.
+    virtual Status EnableTensorObservation(NetworkId networkId, bool enable) = 0;
+
+    /// Sets the priority and core budget the scheduler uses for the given network.
+    /// @param networkId The id of the network to configure.
+    /// @param options The new scheduling parameters.
+    /// @return armnn::Status Failure if the network is not loaded or the runtime has no scheduler.
+    virtual Status SetNetworkSchedulingOptions(NetworkId networkId, const NetworkSchedulingOptions& options) = 0;
+
+    /// Gets the queue depth and latency counters the scheduler has collected for the given network.
+    /// @param networkId The id of the network to query.
+    virtual NetworkSchedulingCounters GetNetworkSchedulingCounters(NetworkId networkId) const = 0;
+
 protected:
     ~IRuntime() {}
 };
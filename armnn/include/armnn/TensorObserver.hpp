@@ -0,0 +1,80 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Tensor.hpp"
+#include "Types.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+/// Called with an output of a layer, each time the layer has executed. @a guid identifies the layer in the INetwork
+/// the running network was optimized from. The tensor is only valid for the duration of the call.
+using TensorObserverFunction = std::function<void(LayerGuid guid, unsigned int slotIndex, const ConstTensor& tensor)>;
+
+/// Statistics of the values an observed tensor had, over all the executions it was observed in.
+struct TensorStatistics
+{
+    TensorStatistics()
+        : m_NumObservations(0)
+        , m_Min(0.0f)
+        , m_Max(0.0f)
+        , m_Checksum(0)
+    {}
+
+    unsigned int m_NumObservations;
+
+    /// The smallest and largest values, dequantized for quantized tensors.
+    float m_Min;
+    float m_Max;
+
+    /// The number of values in each bin of the collector's histogram range. Values outside of the range are
+    /// counted in the first or last bin.
+    std::vector<uint64_t> m_Histogram;
+
+    /// FNV-1a hash of the bytes of the tensor at its latest observation, to spot changes between runs.
+    uint32_t m_Checksum;
+};
+
+/// Collects TensorStatistics for every tensor it observes. Pass GetObserver() to IRuntime::SetTensorObserver().
+/// A collector can observe several networks at once, and must outlive their observation.
+class TensorStatisticsCollector
+{
+public:
+    /// @param numHistogramBins Number of histogram bins, between @a histogramMin and @a histogramMax.
+    ///                         0 disables the histogram.
+    TensorStatisticsCollector(unsigned int numHistogramBins = 0, float histogramMin = 0.0f, float histogramMax = 0.0f);
+
+    TensorObserverFunction GetObserver();
+
+    /// Adds the values of @a tensor to the statistics of the output @a slotIndex of layer @a guid.
+    void Observe(LayerGuid guid, unsigned int slotIndex, const ConstTensor& tensor);
+
+    /// Returns a copy of the statistics of an output, which are empty if it has never been observed.
+    TensorStatistics GetStatistics(LayerGuid guid, unsigned int slotIndex) const;
+
+    /// Returns the outputs observed so far.
+    std::vector<std::pair<LayerGuid, unsigned int>> GetObservedTensors() const;
+
+    void Reset();
+
+private:
+    const unsigned int m_NumHistogramBins;
+    const float        m_HistogramMin;
+    const float        m_HistogramMax;
+
+    mutable std::mutex m_Mutex;
+    std::map<std::pair<LayerGuid, unsigned int>, TensorStatistics> m_Statistics;
+};
+
+} // namespace armnn
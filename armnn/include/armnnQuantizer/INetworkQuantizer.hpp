@@ -20,10 +20,15 @@ struct QuantizerOptions
 
     QuantizerOptions(DataType activationFormat, bool preserveType)
     : m_ActivationFormat(activationFormat)
-    , m_PreserveType(preserveType) {}
+    , m_PreserveType(preserveType)
+    , m_NumCalibrationThreads(0) {}
 
     DataType m_ActivationFormat;
     bool m_PreserveType;
+
+    /// The maximum number of calibration inputs RefineBatch() runs concurrently, each through its own copy of the
+    /// network. 0 uses one per hardware thread.
+    unsigned int m_NumCalibrationThreads;
 };
 
 using INetworkQuantizerPtr = std::unique_ptr<class INetworkQuantizer, void(*)(INetworkQuantizer* quantizer)>;
@@ -47,6 +52,10 @@ public:
     /// Refine input network with a set of refinement data for specified LayerBindingId
     virtual void Refine(const InputTensors& inputTensors) = 0;
 
+    /// Refine input network with several sets of refinement data, which are run concurrently.
+    /// Gives the same ranges as calling Refine() for each of them.
+    virtual void RefineBatch(const std::vector<InputTensors>& inputTensorsBatch) = 0;
+
     /// Extract final quantized network
     virtual INetworkPtr ExportNetwork() = 0;
 
@@ -11,14 +11,44 @@
 namespace armnnSerializer
 {
 
+/// How the serializer stores the data of constant tensors, such as weights.
+enum class TensorCompression
+{
+    /// Stores the data as is.
+    None,
+    /// Replaces each element by a 4 or 8 bit index into a codebook of the distinct values of the tensor, when it has
+    /// no more than 256 of them, as is the case for weights clustered during training.
+    Palette,
+    /// Losslessly run-length encodes the data.
+    RunLength,
+    /// Uses whichever of the above stores each tensor in the fewest bytes.
+    Smallest
+};
+
+struct SerializerOptions
+{
+    SerializerOptions()
+        : m_TensorCompression(TensorCompression::None)
+        , m_TensorDataAlignment(0)
+    {}
+
+    /// Compression of the constant tensors. A tensor is only stored compressed when that makes it smaller, and is
+    /// decompressed by the deserializer when the layer using it is created.
+    TensorCompression m_TensorCompression;
+
+    /// Alignment in bytes, a power of two, of the uncompressed data of each constant tensor in the serialized graph.
+    /// 0 keeps the natural alignment of the elements. Aligning to e.g. 64 lets a memory-mapped file be read in place.
+    unsigned int m_TensorDataAlignment;
+};
+
 class ISerializer;
 using ISerializerPtr = std::unique_ptr<ISerializer, void(*)(ISerializer* serializer)>;
 
 class ISerializer
 {
 public:
-    static ISerializer* CreateRaw();
-    static ISerializerPtr Create();
+    static ISerializer* CreateRaw(const SerializerOptions& options = SerializerOptions());
+    static ISerializerPtr Create(const SerializerOptions& options = SerializerOptions());
     static void Destroy(ISerializer* serializer);
 
     /// Serializes the network to ArmNN SerializedGraph.
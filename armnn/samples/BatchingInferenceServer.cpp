@@ -0,0 +1,304 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "BatchingInferenceServer.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <sstream>
+
+namespace armnnSamples
+{
+
+namespace
+{
+
+unsigned int GetBatchSize(const armnn::TensorInfo& info)
+{
+    return info.GetNumDimensions() > 0 ? info.GetShape()[0] : 1u;
+}
+
+void CheckFloat32Binding(const armnn::TensorInfo& info, armnn::LayerBindingId bindingId)
+{
+    if (info.GetDataType() != armnn::DataType::Float32)
+    {
+        std::stringstream ss;
+        ss << "BatchingInferenceServer: binding " << bindingId << " is of type "
+           << armnn::GetDataTypeName(info.GetDataType()) << ", only Float32 is supported";
+        throw armnn::InvalidArgumentException(ss.str());
+    }
+}
+
+} // anonymous namespace
+
+BatchingInferenceServer::BatchingInferenceServer(armnn::IRuntime& runtime,
+                                                 armnn::NetworkId networkId,
+                                                 const std::vector<armnn::LayerBindingId>& inputBindings,
+                                                 const std::vector<armnn::LayerBindingId>& outputBindings,
+                                                 const BatchingServerOptions& options)
+    : m_Runtime(runtime)
+    , m_NetworkId(networkId)
+    , m_MaxBatchSize(options.m_MaxBatchSize)
+    , m_MaxQueueDelay(options.m_MaxQueueDelay)
+    , m_Stopping(false)
+    , m_TotalQueueDelayUs(0.0)
+    , m_FirstSubmitSeen(false)
+{
+    if (inputBindings.empty() || outputBindings.empty())
+    {
+        throw armnn::InvalidArgumentException("BatchingInferenceServer: at least one input and one output "
+                                              "binding is required");
+    }
+
+    // Every binding must share the same batch dimension, which bounds the server batch size.
+    const unsigned int networkBatchSize = GetBatchSize(m_Runtime.GetInputTensorInfo(m_NetworkId, inputBindings[0]));
+    if (m_MaxBatchSize == 0)
+    {
+        m_MaxBatchSize = networkBatchSize;
+    }
+    if (m_MaxBatchSize > networkBatchSize)
+    {
+        std::stringstream ss;
+        ss << "BatchingInferenceServer: maximum batch size " << m_MaxBatchSize
+           << " exceeds the batch dimension of the network (" << networkBatchSize << ")";
+        throw armnn::InvalidArgumentException(ss.str());
+    }
+
+    auto bindTensors = [&](const std::vector<armnn::LayerBindingId>& bindings, bool isInput)
+    {
+        for (armnn::LayerBindingId bindingId : bindings)
+        {
+            armnn::TensorInfo info = isInput ? m_Runtime.GetInputTensorInfo(m_NetworkId, bindingId)
+                                             : m_Runtime.GetOutputTensorInfo(m_NetworkId, bindingId);
+            CheckFloat32Binding(info, bindingId);
+            if (GetBatchSize(info) != networkBatchSize)
+            {
+                std::stringstream ss;
+                ss << "BatchingInferenceServer: binding " << bindingId << " has batch dimension "
+                   << GetBatchSize(info) << ", expected " << networkBatchSize;
+                throw armnn::InvalidArgumentException(ss.str());
+            }
+
+            const unsigned int sampleSize = info.GetNumElements() / networkBatchSize;
+            if (isInput)
+            {
+                m_InputSampleSizes.push_back(sampleSize);
+                m_InputBuffers.emplace_back(info.GetNumElements(), 0.0f);
+                m_InputTensors.push_back({ bindingId, armnn::ConstTensor(info, m_InputBuffers.back().data()) });
+            }
+            else
+            {
+                m_OutputSampleSizes.push_back(sampleSize);
+                m_OutputBuffers.emplace_back(info.GetNumElements(), 0.0f);
+                m_OutputTensors.push_back({ bindingId, armnn::Tensor(info, m_OutputBuffers.back().data()) });
+            }
+        }
+    };
+
+    // Reserve up front so that the pointers captured by the bound tensors stay valid.
+    m_InputBuffers.reserve(inputBindings.size());
+    m_OutputBuffers.reserve(outputBindings.size());
+    bindTensors(inputBindings, true);
+    bindTensors(outputBindings, false);
+
+    m_Thread = std::thread(&BatchingInferenceServer::ServeLoop, this);
+}
+
+BatchingInferenceServer::~BatchingInferenceServer()
+{
+    Stop();
+}
+
+void BatchingInferenceServer::Submit(std::vector<std::vector<float>> inputs, ResponseCallback callback)
+{
+    if (inputs.size() != m_InputSampleSizes.size())
+    {
+        throw armnn::InvalidArgumentException("BatchingInferenceServer: wrong number of inputs in request");
+    }
+    for (unsigned int i = 0; i < inputs.size(); ++i)
+    {
+        if (inputs[i].size() != m_InputSampleSizes[i])
+        {
+            std::stringstream ss;
+            ss << "BatchingInferenceServer: input " << i << " has " << inputs[i].size()
+               << " elements, expected " << m_InputSampleSizes[i];
+            throw armnn::InvalidArgumentException(ss.str());
+        }
+    }
+
+    Request request{ std::move(inputs), std::move(callback), Clock::now() };
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Stopping)
+        {
+            throw armnn::Exception("BatchingInferenceServer: Submit() called on a stopped server");
+        }
+        if (!m_FirstSubmitSeen)
+        {
+            m_FirstSubmitSeen = true;
+            m_FirstSubmitTime = request.m_SubmitTime;
+        }
+        m_Queue.push_back(std::move(request));
+    }
+    m_Condition.notify_one();
+}
+
+void BatchingInferenceServer::Stop()
+{
+    if (std::this_thread::get_id() == m_Thread.get_id())
+    {
+        throw armnn::Exception("BatchingInferenceServer: Stop() called from a response callback");
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_Condition.notify_one();
+
+    if (m_Thread.joinable())
+    {
+        m_Thread.join();
+    }
+}
+
+BatchingServerStatistics BatchingInferenceServer::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    BatchingServerStatistics stats = m_Stats;
+    if (stats.m_Requests > 0)
+    {
+        stats.m_MeanQueueDelayUs = m_TotalQueueDelayUs / static_cast<double>(stats.m_Requests);
+    }
+    if (stats.m_Batches > 0)
+    {
+        stats.m_MeanBatchFillRatio = static_cast<double>(stats.m_Requests) /
+                                     (static_cast<double>(stats.m_Batches) * m_MaxBatchSize);
+    }
+    if (m_FirstSubmitSeen && stats.m_Requests > 0)
+    {
+        const double elapsedSeconds =
+            std::chrono::duration<double>(m_LastCompletionTime - m_FirstSubmitTime).count();
+        if (elapsedSeconds > 0.0)
+        {
+            stats.m_ThroughputPerSecond = static_cast<double>(stats.m_Requests) / elapsedSeconds;
+        }
+    }
+    return stats;
+}
+
+void BatchingInferenceServer::ServeLoop()
+{
+    std::vector<Request> batch;
+    batch.reserve(m_MaxBatchSize);
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        m_Condition.wait(lock, [this] { return m_Stopping || !m_Queue.empty(); });
+        if (m_Queue.empty())
+        {
+            // Stopping and fully drained.
+            break;
+        }
+
+        // Give the batch until the oldest request's deadline to fill up. When stopping, run immediately.
+        const Clock::time_point deadline = m_Queue.front().m_SubmitTime + m_MaxQueueDelay;
+        m_Condition.wait_until(lock, deadline, [this]
+        {
+            return m_Stopping || m_Queue.size() >= m_MaxBatchSize;
+        });
+
+        const size_t batchSize = std::min<size_t>(m_Queue.size(), m_MaxBatchSize);
+        for (size_t i = 0; i < batchSize; ++i)
+        {
+            batch.push_back(std::move(m_Queue.front()));
+            m_Queue.pop_front();
+        }
+
+        lock.unlock();
+        RunBatch(batch);
+        batch.clear();
+        lock.lock();
+    }
+}
+
+void BatchingInferenceServer::RunBatch(std::vector<Request>& batch)
+{
+    const Clock::time_point startTime = Clock::now();
+    const unsigned int batchSize = static_cast<unsigned int>(batch.size());
+
+    for (unsigned int i = 0; i < m_InputBuffers.size(); ++i)
+    {
+        const unsigned int sampleSize = m_InputSampleSizes[i];
+        float* buffer = m_InputBuffers[i].data();
+        for (unsigned int b = 0; b < batchSize; ++b)
+        {
+            std::copy(batch[b].m_Inputs[i].begin(), batch[b].m_Inputs[i].end(), buffer + b * sampleSize);
+        }
+        // Clear the unused slots so that a partial batch never computes on stale data.
+        std::fill(buffer + batchSize * sampleSize, buffer + m_InputBuffers[i].size(), 0.0f);
+    }
+
+    armnn::Status status = armnn::Status::Failure;
+    try
+    {
+        status = m_Runtime.EnqueueWorkload(m_NetworkId, m_InputTensors, m_OutputTensors);
+    }
+    catch (const armnn::Exception&)
+    {
+        status = armnn::Status::Failure;
+    }
+
+    // Account for the batch before responding, so that a client holding its response sees it in the statistics.
+    {
+        const Clock::time_point endTime = Clock::now();
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (const Request& request : batch)
+        {
+            const double delayUs =
+                std::chrono::duration<double, std::micro>(startTime - request.m_SubmitTime).count();
+            m_TotalQueueDelayUs += delayUs;
+            m_Stats.m_MaxQueueDelayUs = std::max(m_Stats.m_MaxQueueDelayUs, delayUs);
+        }
+        m_Stats.m_Requests += batchSize;
+        m_Stats.m_Batches++;
+        m_Stats.m_Failures += (status == armnn::Status::Success) ? 0 : batchSize;
+        m_LastCompletionTime = endTime;
+    }
+
+    for (unsigned int b = 0; b < batchSize; ++b)
+    {
+        std::vector<std::vector<float>> outputs;
+        if (status == armnn::Status::Success)
+        {
+            outputs.reserve(m_OutputBuffers.size());
+            for (unsigned int i = 0; i < m_OutputBuffers.size(); ++i)
+            {
+                const float* sampleBegin = m_OutputBuffers[i].data() + b * m_OutputSampleSizes[i];
+                outputs.emplace_back(sampleBegin, sampleBegin + m_OutputSampleSizes[i]);
+            }
+        }
+
+        // A throwing callback must not take down the server thread, nor deprive the rest of the batch of their
+        // responses.
+        try
+        {
+            batch[b].m_Callback(status, outputs);
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "BatchingInferenceServer: response callback threw: " << e.what() << std::endl;
+        }
+        catch (...)
+        {
+            std::cerr << "BatchingInferenceServer: response callback threw an unknown exception" << std::endl;
+        }
+    }
+}
+
+} // namespace armnnSamples
@@ -0,0 +1,145 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/ArmNN.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnnSamples
+{
+
+/// Options controlling how a BatchingInferenceServer groups requests.
+struct BatchingServerOptions
+{
+    BatchingServerOptions()
+        : m_MaxBatchSize(0)
+        , m_MaxQueueDelay(std::chrono::microseconds(1000))
+    {}
+
+    /// Largest number of requests executed in a single EnqueueWorkload call.
+    /// 0 means "use the batch dimension of the loaded network".
+    unsigned int m_MaxBatchSize;
+
+    /// Longest time the oldest queued request waits for the batch to fill before the batch is run anyway.
+    std::chrono::microseconds m_MaxQueueDelay;
+};
+
+/// Aggregate counters reported by a BatchingInferenceServer.
+struct BatchingServerStatistics
+{
+    BatchingServerStatistics()
+        : m_Requests(0)
+        , m_Batches(0)
+        , m_Failures(0)
+        , m_MeanQueueDelayUs(0.0)
+        , m_MaxQueueDelayUs(0.0)
+        , m_MeanBatchFillRatio(0.0)
+        , m_ThroughputPerSecond(0.0)
+    {}
+
+    unsigned long m_Requests;
+    unsigned long m_Batches;
+    unsigned long m_Failures;
+    double        m_MeanQueueDelayUs;     ///< Time from Submit() until the request's batch starts executing.
+    double        m_MaxQueueDelayUs;
+    double        m_MeanBatchFillRatio;   ///< Requests per batch divided by the maximum batch size.
+    double        m_ThroughputPerSecond;  ///< Completed requests per second since the first Submit().
+};
+
+/// Serves single-sample inference requests from any number of producer threads by grouping them into batches.
+///
+/// The network must be loaded into @a runtime with a batch dimension (dimension 0 of every input and output)
+/// at least as large as the maximum batch size. Each request carries one sample per input binding; the server
+/// copies the samples of up to m_MaxBatchSize requests into a shared batch buffer, runs a single
+/// EnqueueWorkload and hands each request its slice of every output through its callback.
+/// A batch is run as soon as it is full, or when the oldest request in it has waited for m_MaxQueueDelay.
+/// Only Float32 bindings are supported.
+class BatchingInferenceServer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Invoked on the server thread once the request has been executed. On failure the outputs are empty.
+    /// Exceptions thrown by a callback are logged and discarded. A callback must not call Stop().
+    using ResponseCallback = std::function<void(armnn::Status status, std::vector<std::vector<float>>& outputs)>;
+
+    BatchingInferenceServer(armnn::IRuntime& runtime,
+                            armnn::NetworkId networkId,
+                            const std::vector<armnn::LayerBindingId>& inputBindings,
+                            const std::vector<armnn::LayerBindingId>& outputBindings,
+                            const BatchingServerOptions& options = BatchingServerOptions());
+
+    /// Stops the server after all queued requests have been executed.
+    ~BatchingInferenceServer();
+
+    BatchingInferenceServer(const BatchingInferenceServer&) = delete;
+    BatchingInferenceServer& operator=(const BatchingInferenceServer&) = delete;
+
+    /// Queues a request. @a inputs holds one sample per input binding, in the order the bindings were given.
+    /// Thread safe. Throws armnn::InvalidArgumentException if the inputs have the wrong size
+    /// and armnn::Exception if the server has been stopped.
+    void Submit(std::vector<std::vector<float>> inputs, ResponseCallback callback);
+
+    /// Executes everything still queued, then joins the server thread. Further Submit() calls will throw.
+    /// Throws armnn::Exception when called from a response callback, as the server thread cannot join itself.
+    void Stop();
+
+    /// Returns a snapshot of the counters accumulated so far. Thread safe.
+    BatchingServerStatistics GetStatistics() const;
+
+    unsigned int GetMaxBatchSize() const { return m_MaxBatchSize; }
+
+    /// Number of elements of a single sample for the given input/output binding index.
+    unsigned int GetInputSampleSize(unsigned int index) const { return m_InputSampleSizes[index]; }
+    unsigned int GetOutputSampleSize(unsigned int index) const { return m_OutputSampleSizes[index]; }
+
+private:
+    struct Request
+    {
+        std::vector<std::vector<float>> m_Inputs;
+        ResponseCallback                m_Callback;
+        Clock::time_point               m_SubmitTime;
+    };
+
+    void ServeLoop();
+    void RunBatch(std::vector<Request>& batch);
+
+    armnn::IRuntime&  m_Runtime;
+    armnn::NetworkId  m_NetworkId;
+    unsigned int      m_MaxBatchSize;
+    Clock::duration   m_MaxQueueDelay;
+
+    std::vector<unsigned int> m_InputSampleSizes;
+    std::vector<unsigned int> m_OutputSampleSizes;
+
+    // Batch-sized buffers, bound once to the network and reused for every batch.
+    std::vector<std::vector<float>> m_InputBuffers;
+    std::vector<std::vector<float>> m_OutputBuffers;
+    armnn::InputTensors             m_InputTensors;
+    armnn::OutputTensors            m_OutputTensors;
+
+    mutable std::mutex      m_Mutex;
+    std::condition_variable m_Condition;
+    std::deque<Request>     m_Queue;
+    bool                    m_Stopping;
+
+    // Statistics, guarded by m_Mutex.
+    BatchingServerStatistics m_Stats;
+    double                   m_TotalQueueDelayUs;
+    bool                     m_FirstSubmitSeen;
+    Clock::time_point        m_FirstSubmitTime;
+    Clock::time_point        m_LastCompletionTime;
+
+    std::thread m_Thread;
+};
+
+} // namespace armnnSamples
@@ -0,0 +1,172 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "BatchingInferenceServer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/// Drives a BatchingInferenceServer locally at a fixed request rate so that the latency/throughput trade-off of
+/// the batching parameters can be tuned without a network service.
+///
+/// Usage: BatchingServerSample [qps] [max batch size] [max queue delay us] [duration s] [producer threads]
+///
+/// The served model is a single fully connected layer with a configurable batch dimension. Each producer thread
+/// issues requests on a fixed schedule (so the offered load does not depend on how fast responses come back),
+/// and the end-to-end latency of every request is measured from its scheduled send time.
+namespace
+{
+
+using Clock = armnnSamples::BatchingInferenceServer::Clock;
+
+constexpr unsigned int g_InputSize  = 256;
+constexpr unsigned int g_OutputSize = 64;
+
+armnn::IOptimizedNetworkPtr CreateFullyConnectedNetwork(armnn::IRuntime& runtime,
+                                                        unsigned int batchSize,
+                                                        std::vector<float>& weightsData)
+{
+    using namespace armnn;
+
+    INetworkPtr network = INetwork::Create();
+
+    weightsData.resize(g_InputSize * g_OutputSize);
+    for (unsigned int i = 0; i < weightsData.size(); ++i)
+    {
+        weightsData[i] = static_cast<float>(i % 7) * 0.01f;
+    }
+
+    FullyConnectedDescriptor descriptor;
+    TensorInfo weightsInfo(TensorShape({ g_InputSize, g_OutputSize }), DataType::Float32);
+    ConstTensor weights(weightsInfo, weightsData);
+
+    IConnectableLayer* input  = network->AddInputLayer(0);
+    IConnectableLayer* fc     = network->AddFullyConnectedLayer(descriptor, weights, EmptyOptional(), "fc");
+    IConnectableLayer* output = network->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(fc->GetInputSlot(0));
+    fc->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo(TensorShape({ batchSize, g_InputSize }), DataType::Float32));
+    fc->GetOutputSlot(0).SetTensorInfo(TensorInfo(TensorShape({ batchSize, g_OutputSize }), DataType::Float32));
+
+    return Optimize(*network, { Compute::CpuRef }, runtime.GetDeviceSpec());
+}
+
+unsigned int ParseArgument(int argc, char* argv[], int index, unsigned int defaultValue)
+{
+    return argc > index ? static_cast<unsigned int>(std::stoul(argv[index])) : defaultValue;
+}
+
+double Percentile(const std::vector<double>& sorted, double fraction)
+{
+    if (sorted.empty())
+    {
+        return 0.0;
+    }
+    const size_t index = std::min(sorted.size() - 1, static_cast<size_t>(fraction * static_cast<double>(sorted.size())));
+    return sorted[index];
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    using namespace armnn;
+    using namespace armnnSamples;
+
+    const unsigned int qps          = std::max(1u, ParseArgument(argc, argv, 1, 2000));
+    const unsigned int maxBatchSize = std::max(1u, ParseArgument(argc, argv, 2, 8));
+    const unsigned int maxDelayUs   = ParseArgument(argc, argv, 3, 2000);
+    const unsigned int durationSec  = std::max(1u, ParseArgument(argc, argv, 4, 5));
+    const unsigned int numProducers = std::max(1u, ParseArgument(argc, argv, 5, 4));
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime = IRuntime::Create(options);
+
+    std::vector<float> weightsData;
+    NetworkId networkId;
+    std::string errorMessage;
+    if (runtime->LoadNetwork(networkId,
+                             CreateFullyConnectedNetwork(*runtime, maxBatchSize, weightsData),
+                             errorMessage) != Status::Success)
+    {
+        std::cerr << "Failed to load network: " << errorMessage << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    BatchingServerOptions serverOptions;
+    serverOptions.m_MaxBatchSize  = maxBatchSize;
+    serverOptions.m_MaxQueueDelay = std::chrono::microseconds(maxDelayUs);
+
+    BatchingInferenceServer server(*runtime, networkId, { 0 }, { 0 }, serverOptions);
+
+    const unsigned long totalRequests = static_cast<unsigned long>(qps) * durationSec;
+    const Clock::duration interval = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / qps));
+
+    std::mutex latencyMutex;
+    std::vector<double> latenciesUs;
+    latenciesUs.reserve(totalRequests);
+    std::atomic<unsigned long> failures(0);
+
+    const Clock::time_point start = Clock::now() + std::chrono::milliseconds(10);
+
+    // Producer p sends requests p, p + N, p + 2N, ... so that together they issue exactly one request per interval.
+    std::vector<std::thread> producers;
+    for (unsigned int p = 0; p < numProducers; ++p)
+    {
+        producers.emplace_back([&, p]()
+        {
+            std::vector<float> sample(g_InputSize);
+            for (unsigned long i = p; i < totalRequests; i += numProducers)
+            {
+                const Clock::time_point scheduled = start + interval * static_cast<long>(i);
+                std::this_thread::sleep_until(scheduled);
+
+                std::fill(sample.begin(), sample.end(), static_cast<float>(i % 100) * 0.01f);
+                server.Submit({ sample }, [&, scheduled](Status status, std::vector<std::vector<float>>&)
+                {
+                    const double latencyUs =
+                        std::chrono::duration<double, std::micro>(Clock::now() - scheduled).count();
+                    if (status != Status::Success)
+                    {
+                        failures++;
+                    }
+                    std::lock_guard<std::mutex> lock(latencyMutex);
+                    latenciesUs.push_back(latencyUs);
+                });
+            }
+        });
+    }
+
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    server.Stop();
+
+    const BatchingServerStatistics stats = server.GetStatistics();
+    std::sort(latenciesUs.begin(), latenciesUs.end());
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Offered load:         " << qps << " requests/s for " << durationSec << " s ("
+              << numProducers << " producers)\n";
+    std::cout << "Max batch size:       " << maxBatchSize << ", max queue delay " << maxDelayUs << " us\n";
+    std::cout << "Requests completed:   " << stats.m_Requests << " in " << stats.m_Batches << " batches ("
+              << failures.load() << " failed)\n";
+    std::cout << "Throughput:           " << stats.m_ThroughputPerSecond << " requests/s\n";
+    std::cout << "Mean batch fill:      " << stats.m_MeanBatchFillRatio * 100.0 << " %\n";
+    std::cout << "Queueing delay:       mean " << stats.m_MeanQueueDelayUs << " us, max "
+              << stats.m_MaxQueueDelayUs << " us\n";
+    std::cout << "End-to-end latency:   p50 " << Percentile(latenciesUs, 0.50) << " us, p90 "
+              << Percentile(latenciesUs, 0.90) << " us, p99 " << Percentile(latenciesUs, 0.99) << " us"
+              << std::endl;
+
+    return failures.load() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,182 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include <armnn/ArmNN.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/// Measures the throughput of the CpuRef data movement layers (Pad, StridedSlice, Gather, SpaceToBatchNd and
+/// BatchToSpaceNd), which do no arithmetic and so should run at memory bandwidth.
+///
+/// Usage: DataMovementBenchmark [iterations] [image size]
+///
+/// Each layer runs on its own single-layer network over a 1 x size x size x 32 NHWC float tensor. The reported
+/// throughput counts the bytes read from the input plus the bytes written to the output, per second.
+namespace
+{
+
+using namespace armnn;
+
+constexpr unsigned int g_Channels = 32;
+
+struct Benchmark
+{
+    std::string m_Name;
+    TensorInfo  m_InputInfo;
+    TensorInfo  m_OutputInfo;
+    std::function<IConnectableLayer*(INetwork&)> m_AddLayer;
+};
+
+double RunBenchmark(IRuntime& runtime, const Benchmark& benchmark, unsigned int iterations)
+{
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* input = network->AddInputLayer(0);
+    IConnectableLayer* layer = benchmark.m_AddLayer(*network);
+    IConnectableLayer* output = network->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+    layer->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(benchmark.m_InputInfo);
+    layer->GetOutputSlot(0).SetTensorInfo(benchmark.m_OutputInfo);
+
+    NetworkId networkId;
+    IOptimizedNetworkPtr optimized = Optimize(*network, { Compute::CpuRef }, runtime.GetDeviceSpec());
+    if (!optimized || runtime.LoadNetwork(networkId, std::move(optimized)) != Status::Success)
+    {
+        throw Exception("DataMovementBenchmark: failed to load the " + benchmark.m_Name + " network");
+    }
+
+    std::vector<float> inputData(benchmark.m_InputInfo.GetNumElements());
+    for (unsigned int i = 0; i < inputData.size(); ++i)
+    {
+        inputData[i] = static_cast<float>(i % 251);
+    }
+    std::vector<float> outputData(benchmark.m_OutputInfo.GetNumElements());
+
+    InputTensors inputTensors{ { 0, ConstTensor(runtime.GetInputTensorInfo(networkId, 0), inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime.GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+
+    // One run to allocate the working memory, outside the timing.
+    runtime.EnqueueWorkload(networkId, inputTensors, outputTensors);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; ++i)
+    {
+        runtime.EnqueueWorkload(networkId, inputTensors, outputTensors);
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    runtime.UnloadNetwork(networkId);
+
+    const double bytesPerRun = static_cast<double>(benchmark.m_InputInfo.GetNumBytes() +
+                                                   benchmark.m_OutputInfo.GetNumBytes());
+    return bytesPerRun * iterations / seconds / 1e9;
+}
+
+std::vector<Benchmark> CreateBenchmarks(unsigned int size, std::vector<int32_t>& gatherIndices)
+{
+    const TensorInfo imageInfo({ 1, size, size, g_Channels }, DataType::Float32);
+    const unsigned int half = size / 2;
+
+    std::vector<Benchmark> benchmarks;
+
+    benchmarks.push_back({ "Pad", imageInfo,
+        TensorInfo({ 1, size + 2, size + 2, g_Channels }, DataType::Float32),
+        [](INetwork& network)
+        {
+            return network.AddPadLayer(PadDescriptor({ { 0, 0 }, { 1, 1 }, { 1, 1 }, { 0, 0 } }), "pad");
+        } });
+
+    benchmarks.push_back({ "StridedSlice (crop)", imageInfo,
+        TensorInfo({ 1, half, half, g_Channels }, DataType::Float32),
+        [half](INetwork& network)
+        {
+            const int begin = static_cast<int>(half / 2);
+            const int end = begin + static_cast<int>(half);
+            StridedSliceDescriptor descriptor({ 0, begin, begin, 0 }, { 1, end, end, static_cast<int>(g_Channels) },
+                                              { 1, 1, 1, 1 });
+            return network.AddStridedSliceLayer(descriptor, "crop");
+        } });
+
+    // Gather whole rows of a [size * size, channels] table, in reverse order.
+    gatherIndices.resize(size * size);
+    for (unsigned int i = 0; i < gatherIndices.size(); ++i)
+    {
+        gatherIndices[i] = static_cast<int32_t>(gatherIndices.size() - 1 - i);
+    }
+    const TensorInfo tableInfo({ size * size, g_Channels }, DataType::Float32);
+    benchmarks.push_back({ "Gather", tableInfo, tableInfo,
+        [&gatherIndices](INetwork& network)
+        {
+            const TensorInfo indicesInfo({ static_cast<unsigned int>(gatherIndices.size()) }, DataType::Signed32);
+            IConnectableLayer* indices =
+                network.AddConstantLayer(ConstTensor(indicesInfo, gatherIndices.data()), "indices");
+            indices->GetOutputSlot(0).SetTensorInfo(indicesInfo);
+
+            IConnectableLayer* gather = network.AddGatherLayer("gather");
+            indices->GetOutputSlot(0).Connect(gather->GetInputSlot(1));
+            return gather;
+        } });
+
+    SpaceToBatchNdDescriptor spaceToBatch({ 2, 2 }, { { 0, size % 2 }, { 0, size % 2 } });
+    spaceToBatch.m_DataLayout = DataLayout::NHWC;
+    const unsigned int blocked = (size + size % 2) / 2;
+    const TensorInfo batchesInfo({ 4, blocked, blocked, g_Channels }, DataType::Float32);
+    benchmarks.push_back({ "SpaceToBatchNd", imageInfo, batchesInfo,
+        [spaceToBatch](INetwork& network)
+        {
+            return network.AddSpaceToBatchNdLayer(spaceToBatch, "spaceToBatch");
+        } });
+
+    BatchToSpaceNdDescriptor batchToSpace({ 2, 2 }, { { 0, 0 }, { 0, 0 } });
+    batchToSpace.m_DataLayout = DataLayout::NHWC;
+    benchmarks.push_back({ "BatchToSpaceNd", batchesInfo,
+        TensorInfo({ 1, 2 * blocked, 2 * blocked, g_Channels }, DataType::Float32),
+        [batchToSpace](INetwork& network)
+        {
+            return network.AddBatchToSpaceNdLayer(batchToSpace, "batchToSpace");
+        } });
+
+    return benchmarks;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    const unsigned int iterations = argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : 100;
+    const unsigned int size = argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : 112;
+    if (iterations == 0 || size < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " [iterations] [image size (at least 2)]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+
+    std::vector<int32_t> gatherIndices;
+    std::cout << "Data movement throughput over " << iterations << " runs, 1x" << size << "x" << size << "x"
+              << g_Channels << " float tensors" << std::endl;
+    try
+    {
+        for (const Benchmark& benchmark : CreateBenchmarks(size, gatherIndices))
+        {
+            const double gigabytesPerSecond = RunBenchmark(*runtime, benchmark, iterations);
+            std::cout << std::left << std::setw(24) << benchmark.m_Name << std::right << std::fixed
+                      << std::setprecision(2) << std::setw(8) << gigabytesPerSecond << " GB/s" << std::endl;
+        }
+    }
+    catch (const Exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
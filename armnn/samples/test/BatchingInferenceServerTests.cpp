@@ -0,0 +1,199 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../BatchingInferenceServer.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using namespace armnn;
+using namespace armnnSamples;
+
+namespace
+{
+
+constexpr unsigned int g_NetworkBatchSize = 4;
+constexpr unsigned int g_SampleSize = 2;
+
+/// Loads ReLU over a [4, 2] tensor on CpuRef: four samples of two elements per batch.
+NetworkId LoadReluNetwork(IRuntime& runtime)
+{
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = ActivationFunction::ReLu;
+    IConnectableLayer* relu = net->AddActivationLayer(descriptor);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    const TensorInfo info({ g_NetworkBatchSize, g_SampleSize }, DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    relu->GetOutputSlot(0).SetTensorInfo(info);
+
+    NetworkId networkId;
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    BOOST_REQUIRE(runtime.LoadNetwork(networkId, Optimize(*net, backends, runtime.GetDeviceSpec()))
+                  == Status::Success);
+    return networkId;
+}
+
+/// Collects the responses of a set of requests, for checking on the test thread.
+class Responses
+{
+public:
+    explicit Responses(unsigned int numRequests)
+        : m_Statuses(numRequests, Status::Failure)
+        , m_Outputs(numRequests)
+        , m_NumReceived(0)
+    {}
+
+    BatchingInferenceServer::ResponseCallback CallbackFor(unsigned int request)
+    {
+        return [this, request](Status status, std::vector<std::vector<float>>& outputs)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Statuses[request] = status;
+            m_Outputs[request] = outputs;
+            ++m_NumReceived;
+            m_Condition.notify_all();
+        };
+    }
+
+    void WaitFor(unsigned int numResponses)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Condition.wait(lock, [this, numResponses]() { return m_NumReceived >= numResponses; });
+    }
+
+    /// Checks that request @a request produced ReLU of @a input.
+    void CheckRelu(unsigned int request, const std::vector<float>& input)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        BOOST_TEST(m_Statuses[request] == Status::Success);
+        BOOST_REQUIRE(m_Outputs[request].size() == 1u);
+        BOOST_REQUIRE(m_Outputs[request][0].size() == input.size());
+        for (unsigned int i = 0; i < input.size(); ++i)
+        {
+            BOOST_TEST(m_Outputs[request][0][i] == std::max(0.0f, input[i]));
+        }
+    }
+
+private:
+    std::mutex                                   m_Mutex;
+    std::condition_variable                      m_Condition;
+    std::vector<Status>                          m_Statuses;
+    std::vector<std::vector<std::vector<float>>> m_Outputs;
+    unsigned int                                 m_NumReceived;
+};
+
+std::vector<float> MakeSample(unsigned int request)
+{
+    const float value = static_cast<float>(request) + 1.0f;
+    return { value, -value };
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(BatchingInferenceServerTests)
+
+BOOST_AUTO_TEST_CASE(BatchingServerSplitsFullAndPartialBatches)
+{
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    const NetworkId networkId = LoadReluNetwork(*runtime);
+
+    BatchingServerOptions options;
+    options.m_MaxQueueDelay = std::chrono::milliseconds(50);
+    BatchingInferenceServer server(*runtime, networkId, { 0 }, { 0 }, options);
+    BOOST_TEST(server.GetMaxBatchSize() == g_NetworkBatchSize);
+
+    // A full batch runs as soon as the fourth request arrives.
+    Responses responses(6);
+    for (unsigned int r = 0; r < 4; ++r)
+    {
+        server.Submit({ MakeSample(r) }, responses.CallbackFor(r));
+    }
+    responses.WaitFor(4);
+
+    // Two requests only fill half a batch, which runs once the oldest has waited for the maximum delay.
+    const auto partialStart = std::chrono::steady_clock::now();
+    server.Submit({ MakeSample(4) }, responses.CallbackFor(4));
+    server.Submit({ MakeSample(5) }, responses.CallbackFor(5));
+    responses.WaitFor(6);
+    BOOST_TEST((std::chrono::steady_clock::now() - partialStart >= options.m_MaxQueueDelay));
+
+    for (unsigned int r = 0; r < 6; ++r)
+    {
+        responses.CheckRelu(r, MakeSample(r));
+    }
+
+    const BatchingServerStatistics stats = server.GetStatistics();
+    BOOST_TEST(stats.m_Requests == 6u);
+    BOOST_TEST(stats.m_Batches == 2u);
+    BOOST_TEST(stats.m_Failures == 0u);
+    BOOST_TEST(stats.m_MeanBatchFillRatio == 0.75);
+}
+
+BOOST_AUTO_TEST_CASE(BatchingServerDrainsQueueOnStop)
+{
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    const NetworkId networkId = LoadReluNetwork(*runtime);
+
+    // The delay is far longer than the test: only Stop() can release the partial batch.
+    BatchingServerOptions options;
+    options.m_MaxQueueDelay = std::chrono::seconds(60);
+    BatchingInferenceServer server(*runtime, networkId, { 0 }, { 0 }, options);
+
+    Responses responses(3);
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        server.Submit({ MakeSample(r) }, responses.CallbackFor(r));
+    }
+    server.Stop();
+
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        responses.CheckRelu(r, MakeSample(r));
+    }
+    BOOST_TEST(server.GetStatistics().m_Batches == 1u);
+    BOOST_CHECK_THROW(server.Submit({ MakeSample(0) }, responses.CallbackFor(0)), armnn::Exception);
+}
+
+BOOST_AUTO_TEST_CASE(BatchingServerSurvivesThrowingCallbacks)
+{
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    const NetworkId networkId = LoadReluNetwork(*runtime);
+
+    BatchingServerOptions options;
+    options.m_MaxBatchSize = 1;
+    BatchingInferenceServer server(*runtime, networkId, { 0 }, { 0 }, options);
+
+    server.Submit({ MakeSample(0) }, [](Status, std::vector<std::vector<float>>&)
+    {
+        throw std::runtime_error("callback failure");
+    });
+
+    // Stopping from a callback is refused rather than deadlocking the server thread on itself.
+    server.Submit({ MakeSample(1) }, [&server](Status, std::vector<std::vector<float>>&)
+    {
+        server.Stop();
+    });
+
+    Responses responses(1);
+    server.Submit({ MakeSample(2) }, responses.CallbackFor(0));
+    responses.WaitFor(1);
+    responses.CheckRelu(0, MakeSample(2));
+
+    BOOST_CHECK_THROW(server.Submit({ { 1.0f } }, responses.CallbackFor(0)), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
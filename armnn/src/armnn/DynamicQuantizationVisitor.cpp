@@ -4,7 +4,6 @@
 //
 
 #include "DynamicQuantizationVisitor.hpp"
-#include "NetworkUtils.hpp"
 
 #include <boost/core/ignore_unused.hpp>
 #include <armnn/Descriptors.hpp>
@@ -15,9 +14,8 @@
 namespace armnn
 {
 
-DynamicQuantizationVisitor::DynamicQuantizationVisitor(RangeTracker& rangeTracker, Graph& graph)
-        : m_RangeTracker(rangeTracker),
-          m_Graph(graph)
+DynamicQuantizationVisitor::DynamicQuantizationVisitor(RangeTracker& rangeTracker)
+        : m_RangeTracker(rangeTracker)
 {}
 
 void DynamicQuantizationVisitor::SetRange(const IConnectableLayer* layer, unsigned int outputIdx, float min, float max)
@@ -47,35 +45,17 @@ void DynamicQuantizationVisitor::AddToNonCalibratedLayers(const IConnectableLaye
     m_LayersNotToCalibrate.push_back(layer);
 }
 
-void DynamicQuantizationVisitor::FinishVisit()
+std::vector<LayerGuid> DynamicQuantizationVisitor::GetLayersToCalibrate() const
 {
+    std::vector<LayerGuid> layers;
     for (const IConnectableLayer* layer : m_LayersToCalibrate)
     {
-        std::vector<DebugLayer*> newDebugLayers = InsertDebugLayerAfter(
-            m_Graph, *boost::polymorphic_downcast<Layer*>(const_cast<IConnectableLayer*>(layer)));
-        // record them so we can take them out again efficiently afterward
-        m_DebugLayers.insert(std::end(m_DebugLayers), std::begin(newDebugLayers), std::end(newDebugLayers));
+        layers.push_back(layer->GetGuid());
     }
-}
-
-void DynamicQuantizationVisitor::RemoveDebugLayers()
-{
-    for (DebugLayer* debugLayer : m_DebugLayers)
-    {
-        OutputSlot& proceedingOutputSlot = *debugLayer->GetInputSlot(0).GetConnectedOutputSlot();
-        InputSlot& succeedingInputSlot = *debugLayer->GetOutputSlot(0).GetConnection(0);
-        proceedingOutputSlot.Disconnect(debugLayer->GetInputSlot(0));
-        debugLayer->GetOutputSlot(0).Disconnect(succeedingInputSlot);
-
-        m_Graph.EraseLayer(debugLayer);
-
-        proceedingOutputSlot.Connect(succeedingInputSlot);
-    }
-    m_DebugLayers.clear();
+    return layers;
 }
 
 void DynamicQuantizationVisitor::VisitNonCalibratedLayers() {
-    RemoveDebugLayers();
     for (const IConnectableLayer* layer : m_LayersNotToCalibrate)
     {
         ForwardParentParameters(layer);
@@ -7,7 +7,6 @@
 
 #include "armnn/LayerVisitorBase.hpp"
 #include "RangeTracker.hpp"
-#include "layers/DebugLayer.hpp"
 
 #include <armnn/INetwork.hpp>
 #include <armnnQuantizer/INetworkQuantizer.hpp>
@@ -15,11 +14,11 @@
 namespace armnn
 {
 
-/// Visitor class to establish min/max ranges based on the type of the layer
+/// Visitor class to establish min/max ranges based on the type of the layer, and which layers to calibrate
 class DynamicQuantizationVisitor : public LayerVisitorBase<VisitorNoThrowPolicy>
 {
 public:
-    DynamicQuantizationVisitor(RangeTracker& rangeTracker, Graph& graph);
+    DynamicQuantizationVisitor(RangeTracker& rangeTracker);
     ~DynamicQuantizationVisitor() = default;
 
     /// Functions to set the Range on a per-layer-type basis
@@ -107,11 +106,13 @@ public:
                           LayerBindingId id,
                           const char* name = nullptr) override;
 
-    void FinishVisit() override;
     void VisitNonCalibratedLayers();
 
     const std::vector<armnn::LayerBindingId>& GetOutputLayers();
 
+    /// The layers whose outputs must be observed during calibration
+    std::vector<LayerGuid> GetLayersToCalibrate() const;
+
 private:
     /// Set the range for an output slot on a layer
     void SetRange(const IConnectableLayer* layer, unsigned int outputIdx, float min, float max);
@@ -121,17 +122,13 @@ private:
     /// Mapping from a layer Guid to an array of ranges for outputs
     RangeTracker& m_RangeTracker;
 
-    Graph& m_Graph;
-
     std::vector<const IConnectableLayer*> m_LayersToCalibrate;
     std::vector<const IConnectableLayer*> m_LayersNotToCalibrate;
-    std::vector<DebugLayer*> m_DebugLayers;
 
     std::vector<armnn::LayerBindingId> m_OutputLayers;
 
     void AddToCalibratedLayers(const IConnectableLayer* layer);
     void AddToNonCalibratedLayers(const IConnectableLayer* layer);
-    void RemoveDebugLayers();
 };
 
 } //namespace armnn
\ No newline at end of file
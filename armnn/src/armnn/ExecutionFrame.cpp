@@ -5,27 +5,88 @@
 
 #include "ExecutionFrame.hpp"
 
+#include <backendsCommon/WorkloadUtils.hpp>
+
+#include <boost/assert.hpp>
+
 using namespace std;
 
 namespace armnn
 {
-ExecutionFrame::ExecutionFrame() {}
+
+void BranchState::Reset(unsigned int numSwitches)
+{
+    m_TakenBranches.assign(numSwitches, -1);
+}
+
+void BranchState::SetTakenBranch(unsigned int switchIndex, unsigned int branch)
+{
+    BOOST_ASSERT(switchIndex < m_TakenBranches.size());
+    m_TakenBranches[switchIndex] = static_cast<int>(branch);
+}
+
+bool BranchState::IsTaken(const BranchCondition& condition) const
+{
+    BOOST_ASSERT(condition.m_SwitchIndex < m_TakenBranches.size());
+    return m_TakenBranches[condition.m_SwitchIndex] == static_cast<int>(condition.m_Branch);
+}
+
+void TensorObservation::SetObserver(const TensorObserverFunction& observer, const std::vector<LayerGuid>& layers)
+{
+    m_Observer = observer;
+    m_Layers = std::unordered_set<LayerGuid>(layers.begin(), layers.end());
+    m_IsEnabled = static_cast<bool>(m_Observer);
+}
+
+void TensorObservation::Enable(bool enable)
+{
+    m_IsEnabled = enable && m_Observer;
+}
+
+void TensorObservation::Observe(const ObservableTensor& tensor) const
+{
+    if (!m_Layers.empty() && m_Layers.count(tensor.m_LayerGuid) == 0)
+    {
+        return;
+    }
+
+    const void* data = tensor.m_TensorHandle->Map(true);
+    try
+    {
+        m_Observer(tensor.m_LayerGuid, tensor.m_SlotIndex, ConstTensor(tensor.m_TensorInfo, data));
+    }
+    catch (...)
+    {
+        tensor.m_TensorHandle->Unmap();
+        throw;
+    }
+    tensor.m_TensorHandle->Unmap();
+}
+
+ExecutionFrame::ExecutionFrame(const TensorObservation* tensorObservation)
+    : m_TensorObservation(tensorObservation)
+{}
 
 IExecutionFrame* ExecutionFrame::ExecuteWorkloads(IExecutionFrame* previousFrame)
 {
-    for (auto& workload: m_WorkloadQueue)
+    if (IsActive())
     {
-        workload->Execute();
+        RunWorkloads();
     }
     return m_NextExecutionFrame;
 }
 
 void ExecutionFrame::PostAllocationConfigure()
 {
+    if (m_BranchState)
+    {
+        return;
+    }
     for (auto&& workloadPtr: m_WorkloadQueue)
     {
         workloadPtr.get()->PostAllocationConfigure();
     }
+    m_IsConfigured = true;
 }
 
 void ExecutionFrame::RegisterDebugCallback(const DebugCallbackFunction& func)
@@ -36,9 +97,23 @@ void ExecutionFrame::RegisterDebugCallback(const DebugCallbackFunction& func)
     }
 }
 
-void ExecutionFrame::AddWorkloadToQueue(std::unique_ptr<IWorkload> workload)
+void ExecutionFrame::AddWorkloadToQueue(std::unique_ptr<IWorkload> workload, std::vector<ObservableTensor> outputs)
 {
     m_WorkloadQueue.push_back(move(workload));
+    m_WorkloadOutputs.push_back(move(outputs));
+}
+
+void ExecutionFrame::AddObservableView(const ObservableTensor& view)
+{
+    // Views of tensors computed by previous frames are observed before the first workload.
+    if (m_WorkloadOutputs.empty())
+    {
+        m_LeadingViews.push_back(view);
+    }
+    else
+    {
+        m_WorkloadOutputs.back().push_back(view);
+    }
 }
 
 void ExecutionFrame::SetNextExecutionFrame(IExecutionFrame* nextExecutionFrame)
@@ -46,4 +121,115 @@ void ExecutionFrame::SetNextExecutionFrame(IExecutionFrame* nextExecutionFrame)
     m_NextExecutionFrame = nextExecutionFrame;
 }
 
-}
\ No newline at end of file
+void ExecutionFrame::SetCondition(const BranchState& branchState, const BranchCondition& condition)
+{
+    m_BranchState = &branchState;
+    m_Condition = condition;
+}
+
+void ExecutionFrame::AddDeferredTensor(ITensorHandle* tensorHandle)
+{
+    m_DeferredTensors.push_back(tensorHandle);
+}
+
+bool ExecutionFrame::IsActive() const
+{
+    return !m_BranchState || m_BranchState->IsTaken(m_Condition);
+}
+
+void ExecutionFrame::RunWorkloads()
+{
+    if (!m_IsConfigured)
+    {
+        for (ITensorHandle* tensorHandle : m_DeferredTensors)
+        {
+            tensorHandle->Allocate();
+        }
+        m_DeferredTensors.clear();
+
+        for (auto&& workloadPtr: m_WorkloadQueue)
+        {
+            workloadPtr.get()->PostAllocationConfigure();
+        }
+        m_IsConfigured = true;
+    }
+
+    if (m_TensorObservation && m_TensorObservation->IsEnabled())
+    {
+        for (const ObservableTensor& view : m_LeadingViews)
+        {
+            m_TensorObservation->Observe(view);
+        }
+        for (size_t i = 0; i < m_WorkloadQueue.size(); ++i)
+        {
+            m_WorkloadQueue[i]->Execute();
+            for (const ObservableTensor& output : m_WorkloadOutputs[i])
+            {
+                m_TensorObservation->Observe(output);
+            }
+        }
+        return;
+    }
+
+    for (auto& workload: m_WorkloadQueue)
+    {
+        workload->Execute();
+    }
+}
+
+SwitchExecutionFrame::SwitchExecutionFrame(BranchState& branchState,
+                                           unsigned int switchIndex,
+                                           const ITensorHandle* conditionTensor,
+                                           const TensorInfo& conditionInfo,
+                                           const TensorObservation* tensorObservation)
+    : ExecutionFrame(tensorObservation)
+    , m_SwitchBranchState(branchState)
+    , m_SwitchIndex(switchIndex)
+    , m_ConditionTensor(conditionTensor)
+    , m_ConditionInfo(conditionInfo)
+    , m_DeferredOutputs{ { nullptr, nullptr } }
+{}
+
+IExecutionFrame* SwitchExecutionFrame::ExecuteWorkloads(IExecutionFrame* previousFrame)
+{
+    if (!IsActive())
+    {
+        return GetNextExecutionFrame();
+    }
+
+    const unsigned int branch = IsSwitchConditionTrue(*m_ConditionTensor, m_ConditionInfo) ? 1 : 0;
+    m_SwitchBranchState.SetTakenBranch(m_SwitchIndex, branch);
+
+    if (m_DeferredOutputs[branch])
+    {
+        m_DeferredOutputs[branch]->Allocate();
+        m_DeferredOutputs[branch] = nullptr;
+    }
+
+    RunWorkloads();
+
+    const TensorObservation* tensorObservation = GetTensorObservation();
+    if (tensorObservation && tensorObservation->IsEnabled() && branch < m_ObservableOutputs.size() &&
+        m_ObservableOutputs[branch].m_TensorHandle)
+    {
+        tensorObservation->Observe(m_ObservableOutputs[branch]);
+    }
+    return GetNextExecutionFrame();
+}
+
+void SwitchExecutionFrame::SetDeferredOutput(unsigned int branch, ITensorHandle* tensorHandle)
+{
+    BOOST_ASSERT(branch < m_DeferredOutputs.size());
+    m_DeferredOutputs[branch] = tensorHandle;
+}
+
+void SwitchExecutionFrame::SetObservableOutput(unsigned int branch, const ObservableTensor& output)
+{
+    if (m_ObservableOutputs.size() <= branch)
+    {
+        m_ObservableOutputs.resize(branch + 1, ObservableTensor{ 0, 0, TensorInfo(), nullptr });
+    }
+    m_ObservableOutputs[branch] = output;
+}
+
+}
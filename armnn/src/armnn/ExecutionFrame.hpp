@@ -5,8 +5,14 @@
 
 #pragma once
 
+#include <armnn/TensorObserver.hpp>
+
 #include <backendsCommon/Workload.hpp>
 
+#include <array>
+#include <unordered_set>
+#include <vector>
+
 namespace armnn
 {
 
@@ -17,26 +23,138 @@ class IExecutionFrame
 {
 
 public:
-    ~IExecutionFrame() {}
+    virtual ~IExecutionFrame() {}
 
     virtual IExecutionFrame* ExecuteWorkloads(IExecutionFrame* previousFrame) = 0;
     virtual void PostAllocationConfigure() {};
     virtual void RegisterDebugCallback(const DebugCallbackFunction& func) {};
 };
 
+/// One output of a Switch layer: branch 0 is taken when the condition is false and branch 1 when it is true.
+struct BranchCondition
+{
+    unsigned int m_SwitchIndex;
+    unsigned int m_Branch;
+};
+
+/// The branch taken by each Switch layer of a network during one execution.
+class BranchState
+{
+public:
+    /// Forgets the branches taken, ready for a new execution of a network with @a numSwitches Switch layers.
+    void Reset(unsigned int numSwitches);
+
+    void SetTakenBranch(unsigned int switchIndex, unsigned int branch);
+
+    /// Returns false if the switch did not run, e.g. because it is itself on a branch that was not taken.
+    bool IsTaken(const BranchCondition& condition) const;
+
+private:
+    std::vector<int> m_TakenBranches;
+};
+
+/// An output of a layer, which can be passed to the tensor observer of the network once the layer has executed.
+struct ObservableTensor
+{
+    LayerGuid      m_LayerGuid;
+    unsigned int   m_SlotIndex;
+    TensorInfo     m_TensorInfo;
+    ITensorHandle* m_TensorHandle;
+};
+
+/// The tensor observer of a network, shared by its frames. Frames only look at the outputs of their workloads while
+/// it is enabled, so a disabled observer costs one check per frame.
+class TensorObservation
+{
+public:
+    /// Observes the outputs of @a layers, or of every layer if it is empty. An empty @a observer disables observation.
+    void SetObserver(const TensorObserverFunction& observer, const std::vector<LayerGuid>& layers);
+
+    /// Has no effect without an observer.
+    void Enable(bool enable);
+
+    bool IsEnabled() const { return m_IsEnabled; }
+
+    /// Passes the tensor, mapped, to the observer if its layer is observed.
+    void Observe(const ObservableTensor& tensor) const;
+
+private:
+    TensorObserverFunction        m_Observer;
+    std::unordered_set<LayerGuid> m_Layers;
+    bool                          m_IsEnabled = false;
+};
+
 class ExecutionFrame: public IExecutionFrame
 {
 public:
-    ExecutionFrame();
+    explicit ExecutionFrame(const TensorObservation* tensorObservation = nullptr);
 
     IExecutionFrame* ExecuteWorkloads(IExecutionFrame* previousFrame) override ;
     void PostAllocationConfigure() override;
     void RegisterDebugCallback(const DebugCallbackFunction& func) override ;
-    void AddWorkloadToQueue(std::unique_ptr<IWorkload> workload);
+    /// Adds a workload, with the outputs it computes that the tensor observer can be given.
+    void AddWorkloadToQueue(std::unique_ptr<IWorkload> workload, std::vector<ObservableTensor> outputs = {});
+    /// Adds an output that is a view of a tensor computed before it, such as the output of an aliased Reshape layer.
+    /// It is observed with the outputs of the last workload added.
+    void AddObservableView(const ObservableTensor& view);
     void SetNextExecutionFrame(IExecutionFrame* nextExecutionFrame);
+
+    /// Makes the frame run only when @a condition is taken in @a branchState. The post allocation configuration of
+    /// a conditional frame is postponed to its first execution, so that the tensors it reads and writes need not
+    /// exist before a branch using them is taken.
+    void SetCondition(const BranchState& branchState, const BranchCondition& condition);
+
+    /// Adds a tensor written by the frame, which is allocated the first time the frame runs.
+    void AddDeferredTensor(ITensorHandle* tensorHandle);
+
+protected:
+    bool IsActive() const;
+    IExecutionFrame* GetNextExecutionFrame() const { return m_NextExecutionFrame; }
+
+    /// Allocates the deferred tensors and configures the workloads on the first call, then executes them.
+    void RunWorkloads();
+
+    const TensorObservation* GetTensorObservation() const { return m_TensorObservation; }
+
 private:
     WorkloadQueue m_WorkloadQueue;
+    std::vector<std::vector<ObservableTensor>> m_WorkloadOutputs;
+    std::vector<ObservableTensor> m_LeadingViews;
+    const TensorObservation* m_TensorObservation;
     IExecutionFrame* m_NextExecutionFrame = nullptr;
+
+    const BranchState* m_BranchState = nullptr;
+    BranchCondition m_Condition = { 0, 0 };
+    std::vector<ITensorHandle*> m_DeferredTensors;
+    bool m_IsConfigured = false;
+};
+
+/// Runs the workload of a Switch layer: evaluates its condition, records the branch taken, allocates the output of
+/// that branch if it is deferred and copies the input to it. The frames of the branch not taken are then skipped.
+class SwitchExecutionFrame: public ExecutionFrame
+{
+public:
+    SwitchExecutionFrame(BranchState& branchState,
+                         unsigned int switchIndex,
+                         const ITensorHandle* conditionTensor,
+                         const TensorInfo& conditionInfo,
+                         const TensorObservation* tensorObservation = nullptr);
+
+    IExecutionFrame* ExecuteWorkloads(IExecutionFrame* previousFrame) override;
+
+    /// Adds the output tensor of @a branch, which is allocated the first time that branch is taken.
+    void SetDeferredOutput(unsigned int branch, ITensorHandle* tensorHandle);
+
+    /// Sets the output of @a branch, which is observed when that branch is taken.
+    void SetObservableOutput(unsigned int branch, const ObservableTensor& output);
+
+private:
+    BranchState&                 m_SwitchBranchState;
+    unsigned int                 m_SwitchIndex;
+    const ITensorHandle*         m_ConditionTensor;
+    TensorInfo                   m_ConditionInfo;
+    std::array<ITensorHandle*, 2> m_DeferredOutputs;
+    std::vector<ObservableTensor> m_ObservableOutputs;
 };
 
-}
\ No newline at end of file
+}
@@ -15,6 +15,7 @@
 #include <boost/assert.hpp>
 #include <boost/format.hpp>
 
+#include <algorithm>
 #include <unordered_map>
 #include <DotSerializer.hpp>
 #include <sstream>
@@ -136,12 +137,13 @@ Status Graph::SerializeToDot(std::ostream& stream)
     return Status::Success;
 }
 
-Status Graph::AllocateDynamicBuffers()
+Status Graph::AllocateDynamicBuffers(const std::unordered_set<const ITensorHandle*>& deferredTensors)
 {
     // Layers must be sorted in topological order
     BOOST_ASSERT(m_LayersInOrder);
 
-    std::unordered_set<const ITensorHandle*> preallocatedTensors;
+    // Deferred tensors are treated as if already allocated: their lifetime is not managed here.
+    std::unordered_set<const ITensorHandle*> preallocatedTensors(deferredTensors);
     std::unordered_map<const ITensorHandle*, unsigned int> handleReferenceCounts;
 
     // Finds the first TensorHandle ancestor of a SubTensorHandle. If the ITensorHandle provided
@@ -156,6 +158,30 @@ Status Graph::AllocateDynamicBuffers()
         return ancestor;
     };
 
+    // The size of each tensor is the size of the output it was created for. Views and sub-tensors have a parent.
+    std::unordered_map<const ITensorHandle*, size_t> handleSizes;
+    for (auto&& layer : m_Layers)
+    {
+        for (auto&& slot = layer->BeginOutputSlots(); slot != layer->EndOutputSlots(); ++slot)
+        {
+            const ITensorHandle* tensorHandle = slot->GetOutputHandler().GetData();
+            if (tensorHandle && !tensorHandle->GetParent())
+            {
+                handleSizes[tensorHandle] = slot->GetTensorInfo().GetNumBytes();
+            }
+        }
+    }
+
+    m_TensorMemoryUsage = TensorMemoryUsage();
+    size_t liveBytes = 0;
+    auto StartLifetime = [&](ITensorHandle* const tensorHandle)
+    {
+        const size_t numBytes = handleSizes[tensorHandle];
+        m_TensorMemoryUsage.m_TotalBytes += numBytes;
+        liveBytes += numBytes;
+        m_TensorMemoryUsage.m_PeakBytes = std::max(m_TensorMemoryUsage.m_PeakBytes, liveBytes);
+    };
+
     // Checks whether a TensorHandle has been pre-allocated
     auto IsPreallocated = [&](ITensorHandle* const tensorHandle)
     {
@@ -176,6 +202,7 @@ Status Graph::AllocateDynamicBuffers()
                 {
                     tensorHandle->Allocate();
                     preallocatedTensors.insert(tensorHandle);
+                    StartLifetime(tensorHandle);
                 }
             }
         }
@@ -197,6 +224,7 @@ Status Graph::AllocateDynamicBuffers()
                 {
                     handleReferenceCounts[tensorHandle] = numConnections;
                     tensorHandle->Manage();
+                    StartLifetime(tensorHandle);
                 }
                 else
                 {
@@ -221,6 +249,7 @@ Status Graph::AllocateDynamicBuffers()
                     // Stop managing lifetime of tensor handle
                     tensorHandle->Allocate();
                     handleReferenceCounts.erase(tensorHandle);
+                    liveBytes -= handleSizes[tensorHandle];
                 }
             }
         }
@@ -24,6 +24,17 @@
 namespace armnn
 {
 
+/// The memory taken by the tensors of a graph, measured by Graph::AllocateDynamicBuffers(). Deferred tensors are not
+/// counted.
+struct TensorMemoryUsage
+{
+    /// Bytes of all the tensors, which backends without a memory manager keep allocated at once.
+    size_t m_TotalBytes = 0;
+
+    /// The most bytes of tensors alive at the same time, which is what a memory manager needs.
+    size_t m_PeakBytes = 0;
+};
+
 class SubgraphView;
 
 class Graph
@@ -186,8 +197,12 @@ public:
 
     size_t GetNumLayers() const { return m_Layers.size(); }
 
-    /// Allocates memory for all tensors under output tensor handers of each layer.
-    Status AllocateDynamicBuffers();
+    /// Allocates memory for all tensors under output tensor handers of each layer, except @a deferredTensors,
+    /// whose allocation is left to the caller (e.g. tensors only used on one branch of a Switch layer).
+    Status AllocateDynamicBuffers(const std::unordered_set<const ITensorHandle*>& deferredTensors = {});
+
+    /// The memory taken by the tensors allocated by the last call to AllocateDynamicBuffers().
+    const TensorMemoryUsage& GetTensorMemoryUsage() const { return m_TensorMemoryUsage; }
 
     /// Modifies the graph in-place, removing edges connecting layers using different compute devices,
     /// and relinking them via an intermediary copy layers.
@@ -258,6 +273,8 @@ private:
     mutable bool m_LayersInOrder;
 
     std::map<const GraphEvent, std::list<IGraphObservable*>> m_Views;
+
+    TensorMemoryUsage m_TensorMemoryUsage;
 };
 
 /// Common base class for layers in the graph.
@@ -7,11 +7,13 @@
 #include "Graph.hpp"
 #include <backendsCommon/WorkloadData.hpp>
 #include <backendsCommon/CpuTensorHandle.hpp>
+#include <backendsCommon/WorkloadFactory.hpp>
 
 #include <boost/cast.hpp>
 #include <boost/format.hpp>
 #include <boost/log/trivial.hpp>
 
+#include <algorithm>
 #include <numeric>
 
 namespace armnn
@@ -210,12 +212,61 @@ void Layer::CollectWorkloadOutputs(WorkloadDataCollector& dataCollector, const G
 
 void Layer::CreateTensorHandles(Graph& graph, const IWorkloadFactory& factory)
 {
+    if (SupportsInPlaceExecution() && CreateInPlaceTensorHandle(factory))
+    {
+        return;
+    }
+
     for (auto&& outputHandler : m_OutputHandlers)
     {
         outputHandler.CreateTensorHandles(factory);
     }
 }
 
+bool Layer::IsExecutedInPlace() const
+{
+    const ITensorHandle* outputHandle = GetNumOutputSlots() == 1 ? GetOutputHandler(0).GetData() : nullptr;
+    if (!SupportsInPlaceExecution() || !outputHandle || !outputHandle->GetParent())
+    {
+        return false;
+    }
+    return std::any_of(m_InputSlots.begin(), m_InputSlots.end(), [outputHandle](const InputSlot& inputSlot)
+        {
+            const OutputSlot* input = inputSlot.GetConnectedOutputSlot();
+            return input && input->GetOutputHandler().GetData() == outputHandle->GetParent();
+        });
+}
+
+bool Layer::CreateInPlaceTensorHandle(const IWorkloadFactory& factory)
+{
+    BOOST_ASSERT(GetNumOutputSlots() == 1);
+    const TensorInfo& outputInfo = GetOutputSlot(0).GetTensorInfo();
+
+    for (auto&& inputSlot : m_InputSlots)
+    {
+        // The input is overwritten, so this layer must be its only reader. Constants are read by every execution,
+        // and views and sub-tensors share their memory with other tensors.
+        const OutputSlot* input = inputSlot.GetConnectedOutputSlot();
+        ITensorHandle* inputHandle = input->GetOutputHandler().GetData();
+        if (!inputHandle || inputHandle->GetParent() ||
+            input->GetNumConnections() != 1 ||
+            input->GetOwningLayer().GetType() == LayerType::Constant ||
+            input->GetOwningLayer().GetBackendId() != GetBackendId() ||
+            !(input->GetTensorInfo() == outputInfo))
+        {
+            continue;
+        }
+
+        std::unique_ptr<ITensorHandle> view = factory.CreateAliasTensorHandle(*inputHandle, outputInfo);
+        if (view)
+        {
+            m_OutputHandlers[0].SetData(std::move(view));
+            return true;
+        }
+    }
+    return false;
+}
+
 void Layer::ReleaseConstantData()
 {
     // Now free up the static data.
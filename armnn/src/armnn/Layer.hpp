@@ -248,8 +248,17 @@ public:
 
     virtual std::unique_ptr<IWorkload> CreateWorkload(const Graph& graph, const IWorkloadFactory& factory) const = 0;
 
+    /// Creates the tensor handles of the outputs. The output of a layer that supports in-place execution shares the
+    /// memory of an input when it is safe to overwrite it, and the backend can alias it.
     virtual void CreateTensorHandles(Graph& graph, const IWorkloadFactory& factory);
 
+    /// Indicates if each element of the output only depends on the elements at the same position in the inputs, so
+    /// that the workload of the layer can write its output over an input of the same shape and type.
+    virtual bool SupportsInPlaceExecution() const { return false; }
+
+    /// Indicates if CreateTensorHandles() made the output share the memory of an input.
+    bool IsExecutedInPlace() const;
+
     /// Creates a dynamically-allocated copy of this layer.
     /// @param graph - The Graph into which this Layer is being cloned.
     virtual Layer* Clone(Graph& graph) const = 0;
@@ -339,6 +348,9 @@ private:
     void CollectWorkloadInputs(WorkloadDataCollector& dataCollector, const Graph& graph) const;
     void CollectWorkloadOutputs(WorkloadDataCollector& dataCollector, const Graph& graph) const;
 
+    /// Makes the output a view of an input that can be overwritten, returning false if there is none.
+    bool CreateInPlaceTensorHandle(const IWorkloadFactory& factory);
+
 protected:
     std::vector<OutputHandler> m_OutputHandlers;
 
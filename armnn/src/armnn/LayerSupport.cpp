@@ -55,8 +55,14 @@ namespace armnn
             auto factoryFunc = backendRegistry.GetFactory(backendId); \
             auto backendObject = factoryFunc(); \
             auto layerSupportObject = backendObject->GetLayerSupport(); \
-            isSupported = layerSupportObject->func(__VA_ARGS__, Optional<std::string&>(reasonIfUnsupportedFull)); \
-            CopyErrorMessage(reasonIfUnsupported, reasonIfUnsupportedFull.c_str(), reasonIfUnsupportedMaxLength); \
+            /* the reason is only formatted when the caller has somewhere to put it */ \
+            Optional<std::string&> reasonIfUnsupportedOpt = reasonIfUnsupported != nullptr ? \
+                Optional<std::string&>(reasonIfUnsupportedFull) : Optional<std::string&>(EmptyOptional()); \
+            isSupported = layerSupportObject->func(__VA_ARGS__, reasonIfUnsupportedOpt); \
+            if (!isSupported) \
+            { \
+                CopyErrorMessage(reasonIfUnsupported, reasonIfUnsupportedFull.c_str(), reasonIfUnsupportedMaxLength); \
+            } \
         } \
     } catch (const InvalidArgumentException &e) { \
         /* re-throwing with more context information */ \
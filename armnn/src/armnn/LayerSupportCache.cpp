@@ -0,0 +1,359 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "LayerSupportCache.hpp"
+
+#include "Layer.hpp"
+#include "LayersFwd.hpp"
+
+#include <backendsCommon/BackendRegistry.hpp>
+#include <backendsCommon/CpuTensorHandle.hpp>
+#include <backendsCommon/WorkloadFactory.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/polymorphic_cast.hpp>
+
+#include <type_traits>
+
+namespace armnn
+{
+
+namespace
+{
+
+// The key of a cached answer is the binary representation of everything IWorkloadFactory::IsLayerSupported()
+// reads from a layer.
+
+template <typename T>
+void AppendValue(std::string& key, const T& value)
+{
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Only plain values can be appended");
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+void AppendValues(std::string& key, const std::vector<T>& values)
+{
+    AppendValue(key, values.size());
+    for (const T& value : values)
+    {
+        AppendValue(key, value);
+    }
+}
+
+void AppendValues(std::string& key, const std::vector<std::pair<unsigned int, unsigned int>>& values)
+{
+    AppendValue(key, values.size());
+    for (const auto& value : values)
+    {
+        AppendValue(key, value.first);
+        AppendValue(key, value.second);
+    }
+}
+
+void AppendShape(std::string& key, const TensorShape& shape)
+{
+    AppendValue(key, shape.GetNumDimensions());
+    for (unsigned int i = 0; i < shape.GetNumDimensions(); ++i)
+    {
+        AppendValue(key, shape[i]);
+    }
+}
+
+void AppendTensorInfo(std::string& key, const TensorInfo& info)
+{
+    AppendShape(key, info.GetShape());
+    AppendValue(key, info.GetDataType());
+    AppendValue(key, info.GetQuantizationScale());
+    AppendValue(key, info.GetQuantizationOffset());
+}
+
+// Descriptors are written member by member, as their padding bytes are not initialized. The answer for layers with a
+// descriptor that has no overload here is never cached. Every member of a descriptor must be written.
+template <typename Descriptor>
+bool AppendDescriptor(std::string&, const Descriptor&)
+{
+    return false;
+}
+
+bool AppendDescriptor(std::string& key, const ActivationDescriptor& descriptor)
+{
+    AppendValue(key, descriptor.m_Function);
+    AppendValue(key, descriptor.m_A);
+    AppendValue(key, descriptor.m_B);
+    return true;
+}
+
+bool AppendDescriptor(std::string& key, const BatchNormalizationDescriptor& descriptor)
+{
+    AppendValue(key, descriptor.m_Eps);
+    AppendValue(key, descriptor.m_DataLayout);
+    return true;
+}
+
+bool AppendDescriptor(std::string& key, const Convolution2dDescriptor& descriptor)
+{
+    AppendValue(key, descriptor.m_PadLeft);
+    AppendValue(key, descriptor.m_PadRight);
+    AppendValue(key, descriptor.m_PadTop);
+    AppendValue(key, descriptor.m_PadBottom);
+    AppendValue(key, descriptor.m_StrideX);
+    AppendValue(key, descriptor.m_StrideY);
+    AppendValue(key, descriptor.m_DilationX);
+    AppendValue(key, descriptor.m_DilationY);
+    AppendValue(key, descriptor.m_BiasEnabled);
+    AppendValue(key, descriptor.m_DataLayout);
+    return true;
+}
+
+bool AppendDescriptor(std::string& key, const DepthwiseConvolution2dDescriptor& descriptor)
+{
+    AppendValue(key, descriptor.m_PadLeft);
+    AppendValue(key, descriptor.m_PadRight);
+    AppendValue(key, descriptor.m_PadTop);
+    AppendValue(key, descriptor.m_PadBottom);
+    AppendValue(key, descriptor.m_StrideX);
+    AppendValue(key, descriptor.m_StrideY);
+    AppendValue(key, descriptor.m_DilationX);
+    AppendValue(key, descriptor.m_DilationY);
+    AppendValue(key, descriptor.m_BiasEnabled);
+    AppendValue(key, descriptor.m_DataLayout);
+    return true;
+}
+
+bool AppendDescriptor(std::string& key, const FullyConnectedDescriptor& descriptor)
+{
+    AppendValue(key, descriptor.m_BiasEnabled);
+    AppendValue(key, descriptor.m_TransposeWeightMatrix);
+    return true;
+}
+
+bool AppendDescriptor(std::string& key, const L2NormalizationDescriptor& descriptor)
+{
+    AppendValue(key, descriptor.m_DataLayout);
+    return true;
+}
+
+bool AppendDescriptor(std::string& key, const MeanDescriptor& descriptor)
+{
+    AppendValues(key, descriptor.m_Axis);
+    AppendValue(key, descriptor.m_KeepDims);
+    return true;
+}
+
+bool AppendDescriptor(std::string& key, const NormalizationDescriptor& descriptor)
+{
+    AppendValue(key, descriptor.m_NormChannelType);
+    AppendValue(key, descriptor.m_NormMethodType);
+    AppendValue(key, descriptor.m_NormSize);
+    AppendValue(key, descriptor.m_Alpha);
+    AppendValue(key, descriptor.m_Beta);
+    AppendValue(key, descriptor.m_K);
+    AppendValue(key, descriptor.m_DataLayout);
+    return true;
+}
+
+bool AppendDescriptor(std::string& key, const PadDescriptor& descriptor)
+{
+    AppendValues(key, descriptor.m_PadList);
+    return true;
+}
+
+bool AppendDescriptor(std::string& key, const PermuteDescriptor& descriptor)
+{
+    AppendValue(key, descriptor.m_DimMappings.GetSize());
+    for (unsigned int i = 0; i < descriptor.m_DimMappings.GetSize(); ++i)
+    {
+        AppendValue(key, descriptor.m_DimMappings[i]);
+    }
+    return true;
+}
+
+bool AppendDescriptor(std::string& key, const Pooling2dDescriptor& descriptor)
+{
+    AppendValue(key, descriptor.m_PoolType);
+    AppendValue(key, descriptor.m_PadLeft);
+    AppendValue(key, descriptor.m_PadRight);
+    AppendValue(key, descriptor.m_PadTop);
+    AppendValue(key, descriptor.m_PadBottom);
+    AppendValue(key, descriptor.m_PoolWidth);
+    AppendValue(key, descriptor.m_PoolHeight);
+    AppendValue(key, descriptor.m_StrideX);
+    AppendValue(key, descriptor.m_StrideY);
+    AppendValue(key, descriptor.m_OutputShapeRounding);
+    AppendValue(key, descriptor.m_PaddingMethod);
+    AppendValue(key, descriptor.m_DataLayout);
+    return true;
+}
+
+bool AppendDescriptor(std::string& key, const ReshapeDescriptor& descriptor)
+{
+    AppendShape(key, descriptor.m_TargetShape);
+    return true;
+}
+
+bool AppendDescriptor(std::string& key, const ResizeBilinearDescriptor& descriptor)
+{
+    AppendValue(key, descriptor.m_TargetWidth);
+    AppendValue(key, descriptor.m_TargetHeight);
+    AppendValue(key, descriptor.m_DataLayout);
+    return true;
+}
+
+bool AppendDescriptor(std::string& key, const SoftmaxDescriptor& descriptor)
+{
+    AppendValue(key, descriptor.m_Beta);
+    return true;
+}
+
+// Layers with parameters append their descriptor, the others have nothing to append.
+template <typename LayerT>
+auto AppendParameters(std::string& key, const LayerT& layer, int) -> decltype(layer.GetParameters(), bool())
+{
+    return AppendDescriptor(key, layer.GetParameters());
+}
+
+template <typename LayerT>
+bool AppendParameters(std::string&, const LayerT&, long)
+{
+    return true;
+}
+
+// Dispatches on the layer type, to append the parameters of the concrete layer class.
+template <unsigned int Type>
+struct LayerParametersAppender
+{
+    static bool Append(std::string& key, const Layer& layer)
+    {
+        constexpr LayerType layerType = static_cast<LayerType>(Type);
+        if (layer.GetType() == layerType)
+        {
+            return AppendParameters(key, *boost::polymorphic_downcast<const LayerTypeOf<layerType>*>(&layer), 0);
+        }
+        return LayerParametersAppender<Type + 1>::Append(key, layer);
+    }
+};
+
+template <>
+struct LayerParametersAppender<static_cast<unsigned int>(LayerType::LastLayer) + 1>
+{
+    static bool Append(std::string&, const Layer&)
+    {
+        return false;
+    }
+};
+
+/// Returns false if the answer for the layer cannot be cached.
+bool MakeKey(std::string& key, Layer& layer, Optional<DataType> dataType)
+{
+    if (layer.GetType() == LayerType::PreCompiled)
+    {
+        return false;
+    }
+
+    key.append(layer.GetBackendId().Get());
+    key.push_back('\0');
+    AppendValue(key, layer.GetType());
+    AppendValue(key, dataType.has_value());
+    if (dataType.has_value())
+    {
+        AppendValue(key, dataType.value());
+    }
+
+    if (!LayerParametersAppender<static_cast<unsigned int>(LayerType::FirstLayer)>::Append(key, layer))
+    {
+        return false;
+    }
+
+    AppendValue(key, layer.GetNumInputSlots());
+    for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+    {
+        const OutputSlot* connection = layer.GetInputSlot(i).GetConnectedOutputSlot();
+        if (connection == nullptr)
+        {
+            return false;
+        }
+        AppendTensorInfo(key, connection->GetTensorInfo());
+    }
+
+    AppendValue(key, layer.GetNumOutputSlots());
+    for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+    {
+        AppendTensorInfo(key, layer.GetOutputSlot(i).GetTensorInfo());
+    }
+
+    layer.OperateOnConstantTensors([&key](std::unique_ptr<ScopedCpuTensorHandle>& handle)
+    {
+        AppendTensorInfo(key, handle->GetTensorInfo());
+    });
+    return true;
+}
+
+} // anonymous namespace
+
+LayerSupportCache::LayerSupportCache()
+    : m_NumCacheHits(0)
+{}
+
+IBackendInternal& LayerSupportCache::GetBackend(const BackendId& backendId)
+{
+    return *GetBackendEntry(backendId).m_Backend;
+}
+
+LayerSupportCache::Backend& LayerSupportCache::GetBackendEntry(const BackendId& backendId)
+{
+    auto it = m_Backends.find(backendId);
+    if (it == m_Backends.end())
+    {
+        Backend backend;
+        backend.m_Backend = BackendRegistryInstance().GetFactory(backendId)();
+        BOOST_ASSERT(backend.m_Backend);
+        backend.m_LayerSupport = backend.m_Backend->GetLayerSupport();
+        it = m_Backends.emplace(backendId, std::move(backend)).first;
+    }
+    return it->second;
+}
+
+bool LayerSupportCache::IsLayerSupported(Layer& layer,
+                                         Optional<DataType> dataType,
+                                         std::string& outReasonIfUnsupported)
+{
+    if (!BackendRegistryInstance().IsBackendRegistered(layer.GetBackendId()))
+    {
+        return IWorkloadFactory::IsLayerSupported(layer, dataType, outReasonIfUnsupported);
+    }
+
+    std::string key;
+    const bool isCacheable = MakeKey(key, layer, dataType);
+    if (isCacheable)
+    {
+        auto it = m_Results.find(key);
+        if (it != m_Results.end())
+        {
+            ++m_NumCacheHits;
+            if (!it->second.m_IsSupported)
+            {
+                outReasonIfUnsupported = it->second.m_ReasonIfUnsupported;
+            }
+            return it->second.m_IsSupported;
+        }
+    }
+
+    std::string reasonIfUnsupported;
+    const bool isSupported = IWorkloadFactory::IsLayerSupported(*GetBackendEntry(layer.GetBackendId()).m_LayerSupport,
+                                                                layer,
+                                                                dataType,
+                                                                reasonIfUnsupported);
+    if (!isSupported)
+    {
+        outReasonIfUnsupported = reasonIfUnsupported;
+    }
+    if (isCacheable)
+    {
+        m_Results.emplace(std::move(key), Result{ isSupported, std::move(reasonIfUnsupported) });
+    }
+    return isSupported;
+}
+
+} // namespace armnn
@@ -0,0 +1,60 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/BackendId.hpp>
+#include <armnn/ILayerSupport.hpp>
+#include <armnn/Optional.hpp>
+#include <armnn/Types.hpp>
+
+#include <backendsCommon/IBackendInternal.hpp>
+
+#include <string>
+#include <unordered_map>
+
+namespace armnn
+{
+
+class Layer;
+
+/// Answers the layer support queries made while optimizing one network. Each backend, and its ILayerSupport, is
+/// created once instead of for every query, and the answer for a layer is remembered for the other layers of the same
+/// type, with the same parameters, constant tensor and input and output tensor infos, on the same backend.
+class LayerSupportCache
+{
+public:
+    LayerSupportCache();
+
+    /// Returns the backend @a backendId, creating it the first time. The backend must be registered.
+    IBackendInternal& GetBackend(const BackendId& backendId);
+
+    /// Same as IWorkloadFactory::IsLayerSupported() for the backend assigned to @a layer. The reason is only set when
+    /// the layer is not supported.
+    bool IsLayerSupported(Layer& layer, Optional<DataType> dataType, std::string& outReasonIfUnsupported);
+
+    /// The number of queries answered from the cache, rather than by a backend.
+    unsigned int GetNumCacheHits() const { return m_NumCacheHits; }
+
+private:
+    struct Backend
+    {
+        IBackendInternalUniquePtr m_Backend;
+        ILayerSupportSharedPtr    m_LayerSupport;
+    };
+
+    struct Result
+    {
+        bool        m_IsSupported;
+        std::string m_ReasonIfUnsupported;
+    };
+
+    Backend& GetBackendEntry(const BackendId& backendId);
+
+    std::unordered_map<BackendId, Backend>   m_Backends;
+    std::unordered_map<std::string, Result>  m_Results;
+    unsigned int                             m_NumCacheHits;
+};
+
+} // namespace armnn
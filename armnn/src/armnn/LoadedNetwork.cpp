@@ -19,6 +19,10 @@
 #include <boost/assert.hpp>
 #include <boost/format.hpp>
 #include <boost/log/trivial.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <algorithm>
+#include <unordered_set>
 
 namespace armnn
 {
@@ -36,6 +40,126 @@ std::string ToErrorMessage(const char * prefix, const ExceptionType & error)
     return ss.str();
 }
 
+// Guard of the layers and tensors that do not depend on any Switch layer.
+constexpr int g_NoGuard = -1;
+
+/// Works out which branch of which Switch layer each layer of a network depends on, so that the workloads of a
+/// branch can be skipped when it is not taken. A guard is one output of a Switch layer, nested in the guard of the
+/// Switch layer itself. A layer takes the innermost guard of its inputs, except Merge layers, which join branches
+/// and so take the guard their inputs have in common.
+class BranchAnalysis
+{
+public:
+    /// The layers of @a graph must be in topological order.
+    explicit BranchAnalysis(const Graph& graph)
+    {
+        for (auto&& layer : graph)
+        {
+            int guard = g_NoGuard;
+            if (layer->GetType() == LayerType::Merge)
+            {
+                guard = GetCommonAncestor(GetInputGuard(layer->GetInputSlot(0)),
+                                          GetInputGuard(layer->GetInputSlot(1)));
+            }
+            else
+            {
+                for (auto&& input : layer->GetInputSlots())
+                {
+                    guard = GetInnermost(*layer, guard, GetInputGuard(input));
+                }
+            }
+            m_LayerGuards[layer] = guard;
+
+            if (layer->GetType() == LayerType::Output && guard != g_NoGuard)
+            {
+                throw InvalidArgumentException(boost::str(
+                    boost::format("Output layer '%1%' is only computed on one branch of a Switch layer; "
+                                  "join the branches with a Merge layer") % layer->GetNameStr()));
+            }
+
+            if (layer->GetType() == LayerType::Switch)
+            {
+                const unsigned int switchIndex = boost::numeric_cast<unsigned int>(m_SwitchIndices.size());
+                m_SwitchIndices[layer] = switchIndex;
+                for (unsigned int branch = 0; branch < layer->GetNumOutputSlots(); ++branch)
+                {
+                    m_Guards.push_back({ guard, { switchIndex, branch } });
+                    m_OutputGuards[&layer->GetOutputSlot(branch)] = boost::numeric_cast<int>(m_Guards.size() - 1);
+                }
+            }
+            else
+            {
+                for (auto&& output : layer->GetOutputSlots())
+                {
+                    m_OutputGuards[&output] = guard;
+                }
+            }
+        }
+    }
+
+    unsigned int GetNumSwitches() const { return boost::numeric_cast<unsigned int>(m_SwitchIndices.size()); }
+
+    /// For a Switch layer, this is the guard of the layer itself, not of its outputs.
+    int GetLayerGuard(const Layer& layer) const { return m_LayerGuards.at(&layer); }
+
+    int GetInputGuard(const InputSlot& input) const { return m_OutputGuards.at(input.GetConnectedOutputSlot()); }
+
+    unsigned int GetSwitchIndex(const Layer& switchLayer) const { return m_SwitchIndices.at(&switchLayer); }
+
+    const BranchCondition& GetCondition(int guard) const
+    {
+        return m_Guards[boost::numeric_cast<size_t>(guard)].m_Condition;
+    }
+
+private:
+    struct Guard
+    {
+        int             m_Parent;
+        BranchCondition m_Condition;
+    };
+
+    bool IsAncestor(int ancestor, int guard) const
+    {
+        for (; guard != g_NoGuard; guard = m_Guards[boost::numeric_cast<size_t>(guard)].m_Parent)
+        {
+            if (guard == ancestor)
+            {
+                return true;
+            }
+        }
+        return ancestor == g_NoGuard;
+    }
+
+    int GetInnermost(const Layer& layer, int guard0, int guard1) const
+    {
+        if (IsAncestor(guard0, guard1))
+        {
+            return guard1;
+        }
+        if (IsAncestor(guard1, guard0))
+        {
+            return guard0;
+        }
+        throw InvalidArgumentException(boost::str(
+            boost::format("Layer '%1%' uses tensors from different branches of a Switch layer; "
+                          "join the branches with a Merge layer first") % layer.GetNameStr()));
+    }
+
+    int GetCommonAncestor(int guard0, int guard1) const
+    {
+        while (!IsAncestor(guard0, guard1))
+        {
+            guard0 = m_Guards[boost::numeric_cast<size_t>(guard0)].m_Parent;
+        }
+        return guard0;
+    }
+
+    std::vector<Guard> m_Guards;
+    std::unordered_map<const Layer*, int> m_LayerGuards;
+    std::unordered_map<const OutputSlot*, int> m_OutputGuards;
+    std::unordered_map<const Layer*, unsigned int> m_SwitchIndices;
+};
+
 } // anonymous
 
 std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
@@ -100,33 +224,164 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net)
         layer->CreateTensorHandles(m_OptimizedNetwork->GetGraph(), GetWorkloadFactory(*layer));
     }
 
-    //Then create workloads.
+    //Then create workloads, in execution frames split at the branches of Switch layers. The outputs of layers
+    //on a branch are only allocated when the branch is first taken, if their backend allocates tensors one by one.
+    const BranchAnalysis branches(order);
+    m_NumSwitches = branches.GetNumSwitches();
+    std::unordered_set<const ITensorHandle*> deferredTensors;
+
+    auto CanDefer = [&](const Layer& layer, const ITensorHandle* tensorHandle)
+    {
+        return tensorHandle && !tensorHandle->GetParent() &&
+               !m_WorkloadFactories.at(layer.GetBackendId()).second;
+    };
+
+    auto CreateLayerWorkload = [&](const Layer& layer, const IWorkloadFactory& workloadFactory)
+    {
+        auto workload = layer.CreateWorkload(m_OptimizedNetwork->GetGraph(), workloadFactory);
+        if (!workload)
+        {
+            const char* const layerName = layer.GetNameStr().length() != 0 ? layer.GetName() : "<Unnamed>";
+            throw InvalidArgumentException(boost::str(
+                boost::format("No workload created for layer (name: '%1%' type: '%2%') (compute '%3%')")
+                % layerName % static_cast<int>(layer.GetType()) % layer.GetBackendId().Get()
+            ));
+        }
+        return workload;
+    };
+
+    auto GetObservableOutputs = [](const Layer& layer)
+    {
+        std::vector<ObservableTensor> outputs;
+        for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+        {
+            const OutputSlot& output = layer.GetOutputSlot(i);
+            outputs.push_back({ layer.GetGuid(), i, output.GetTensorInfo(), output.GetOutputHandler().GetData() });
+        }
+        return outputs;
+    };
+
+    // Frames are only extended with workloads of the same guard; a Switch layer always ends its frame.
+    int frameGuard = g_NoGuard;
+    bool isFrameOpen = false;
+    auto GetFrame = [&](int guard) -> ExecutionFrame&
+    {
+        if (!isFrameOpen || guard != frameGuard)
+        {
+            m_ExecutionFrames.push_back(std::make_unique<ExecutionFrame>(&m_TensorObservation));
+            if (guard != g_NoGuard)
+            {
+                m_ExecutionFrames.back()->SetCondition(m_BranchState, branches.GetCondition(guard));
+            }
+            frameGuard = guard;
+            isFrameOpen = true;
+        }
+        return *m_ExecutionFrames.back();
+    };
+
     for (auto&& layer : order)
     {
         const IWorkloadFactory& workloadFactory = GetWorkloadFactory(*layer);
+        const int guard = branches.GetLayerGuard(*layer);
 
         switch (layer->GetType())
         {
         case LayerType::Input:
-        case LayerType::Output:
             {
                 // Inputs and outputs are treated in a special way - see EnqueueInput() and EnqueueOutput().
+                std::vector<ObservableTensor> outputs = GetObservableOutputs(*layer);
+                m_ObservableInputs.insert(m_ObservableInputs.end(), outputs.begin(), outputs.end());
+                break;
+            }
+        case LayerType::Output:
+            {
+                break;
+            }
+        case LayerType::Switch:
+            {
+                const OutputSlot* condition = layer->GetInputSlot(1).GetConnectedOutputSlot();
+                auto frame = std::make_unique<SwitchExecutionFrame>(m_BranchState,
+                                                                    branches.GetSwitchIndex(*layer),
+                                                                    condition->GetOutputHandler().GetData(),
+                                                                    condition->GetTensorInfo(),
+                                                                    &m_TensorObservation);
+                if (guard != g_NoGuard)
+                {
+                    frame->SetCondition(m_BranchState, branches.GetCondition(guard));
+                }
+                std::vector<ObservableTensor> outputs = GetObservableOutputs(*layer);
+                for (unsigned int branch = 0; branch < layer->GetNumOutputSlots(); ++branch)
+                {
+                    frame->SetObservableOutput(branch, outputs[branch]);
+                    ITensorHandle* tensorHandle = layer->GetOutputSlot(branch).GetOutputHandler().GetData();
+                    if (CanDefer(*layer, tensorHandle))
+                    {
+                        frame->SetDeferredOutput(branch, tensorHandle);
+                        deferredTensors.insert(tensorHandle);
+                    }
+                }
+                frame->AddWorkloadToQueue(CreateLayerWorkload(*layer, workloadFactory));
+                m_ExecutionFrames.push_back(std::move(frame));
+                isFrameOpen = false;
+                break;
+            }
+        case LayerType::Merge:
+            {
+                const int guard0 = branches.GetInputGuard(layer->GetInputSlot(0));
+                const int guard1 = branches.GetInputGuard(layer->GetInputSlot(1));
+                if (guard0 == guard1)
+                {
+                    GetFrame(guard).AddWorkloadToQueue(CreateLayerWorkload(*layer, workloadFactory),
+                                                       GetObservableOutputs(*layer));
+                    break;
+                }
+
+                // Only the inputs of the branches taken are computed, so the Merge becomes a copy on each branch.
+                // Input 1 is copied first, so that input 0 wins if both branches were taken.
+                for (unsigned int inputIndex : { 1u, 0u })
+                {
+                    const OutputSlot* source = layer->GetInputSlot(inputIndex).GetConnectedOutputSlot();
+                    MemCopyQueueDescriptor descriptor;
+                    WorkloadInfo info;
+                    descriptor.m_Inputs.push_back(source->GetOutputHandler().GetData());
+                    info.m_InputTensorInfos.push_back(source->GetTensorInfo());
+                    descriptor.m_Outputs.push_back(layer->GetOutputHandler(0).GetData());
+                    info.m_OutputTensorInfos.push_back(layer->GetOutputSlot(0).GetTensorInfo());
+
+                    GetFrame(inputIndex == 0 ? guard0 : guard1).AddWorkloadToQueue(
+                        workloadFactory.CreateMemCopy(descriptor, info), GetObservableOutputs(*layer));
+                }
                 break;
             }
         default:
             {
-                auto workload = layer->CreateWorkload(m_OptimizedNetwork->GetGraph(), workloadFactory);
+                ExecutionFrame& frame = GetFrame(guard);
 
-                if (!workload)
+                // A Reshape whose output is a view of its input has nothing to compute.
+                if (layer->GetType() == LayerType::Reshape &&
+                    boost::polymorphic_downcast<const ReshapeLayer*>(layer)->IsViewOfInput())
                 {
-                    const char* const layerName = layer->GetNameStr().length() != 0 ? layer->GetName() : "<Unnamed>";
-                    throw InvalidArgumentException(boost::str(
-                        boost::format("No workload created for layer (name: '%1%' type: '%2%') (compute '%3%')")
-                        % layerName % static_cast<int>(layer->GetType()) % layer->GetBackendId().Get()
-                    ));
+                    for (const ObservableTensor& output : GetObservableOutputs(*layer))
+                    {
+                        frame.AddObservableView(output);
+                    }
+                    break;
                 }
 
-                m_WorkloadQueue.push_back(move(workload));
+                if (guard != g_NoGuard && layer->GetType() != LayerType::Constant)
+                {
+                    for (auto&& output : layer->GetOutputSlots())
+                    {
+                        ITensorHandle* tensorHandle = output.GetOutputHandler().GetData();
+                        if (CanDefer(*layer, tensorHandle))
+                        {
+                            frame.AddDeferredTensor(tensorHandle);
+                            deferredTensors.insert(tensorHandle);
+                        }
+                    }
+                }
+
+                frame.AddWorkloadToQueue(CreateLayerWorkload(*layer, workloadFactory), GetObservableOutputs(*layer));
                 // release the constant data in the layer..
                 layer->ReleaseConstantData();
                 break;
@@ -134,13 +389,28 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net)
         }
     }
 
+    for (size_t i = 1; i < m_ExecutionFrames.size(); ++i)
+    {
+        m_ExecutionFrames[i - 1]->SetNextExecutionFrame(m_ExecutionFrames[i].get());
+    }
+
     // Set up memory.
-    m_OptimizedNetwork->GetGraph().AllocateDynamicBuffers();
+    m_OptimizedNetwork->GetGraph().AllocateDynamicBuffers(deferredTensors);
+
+    const TensorMemoryUsage& memoryUsage = m_OptimizedNetwork->GetGraph().GetTensorMemoryUsage();
+    const auto numInPlaceLayers = std::count_if(order.begin(), order.end(), [](const Layer* layer)
+        {
+            return layer->IsExecutedInPlace();
+        });
+    BOOST_LOG_TRIVIAL(debug) << "Tensors of the network: " << memoryUsage.m_TotalBytes << " bytes, of which at most "
+                             << memoryUsage.m_PeakBytes << " bytes are alive at once. " << numInPlaceLayers
+                             << " layers run in place.";
 
     // Now that the intermediate tensor memory has been set-up, do any post allocation configuration for each workload.
-    for (auto& workload : m_WorkloadQueue)
+    // Conditional frames configure their workloads when they first run.
+    for (auto& frame : m_ExecutionFrames)
     {
-        workload->PostAllocationConfigure();
+        frame->PostAllocationConfigure();
     }
 }
 
@@ -468,10 +738,22 @@ bool LoadedNetwork::Execute()
         {
             input->Execute();
         }
+        if (m_TensorObservation.IsEnabled())
+        {
+            for (const ObservableTensor& input : m_ObservableInputs)
+            {
+                m_TensorObservation.Observe(input);
+            }
+        }
 
-        for (auto& workload : m_WorkloadQueue)
+        m_BranchState.Reset(m_NumSwitches);
+        IExecutionFrame* previousFrame = nullptr;
+        IExecutionFrame* frame = m_ExecutionFrames.empty() ? nullptr : m_ExecutionFrames.front().get();
+        while (frame)
         {
-            workload->Execute();
+            IExecutionFrame* nextFrame = frame->ExecuteWorkloads(previousFrame);
+            previousFrame = frame;
+            frame = nextFrame;
         }
 
         for (auto& output: m_OutputQueue)
@@ -493,10 +775,22 @@ bool LoadedNetwork::Execute()
 
 void LoadedNetwork::RegisterDebugCallback(const DebugCallbackFunction& func)
 {
-    for (auto&& workloadPtr: m_WorkloadQueue)
+    for (auto&& frame : m_ExecutionFrames)
     {
-        workloadPtr.get()->RegisterDebugCallback(func);
+        frame->RegisterDebugCallback(func);
     }
 }
 
+void LoadedNetwork::SetTensorObserver(const TensorObserverFunction& observer, const std::vector<LayerGuid>& layers)
+{
+    std::lock_guard<std::mutex> lockGuard(m_WorkingMemMutex);
+    m_TensorObservation.SetObserver(observer, layers);
+}
+
+void LoadedNetwork::EnableTensorObservation(bool enable)
+{
+    std::lock_guard<std::mutex> lockGuard(m_WorkingMemMutex);
+    m_TensorObservation.Enable(enable);
+}
+
 }
@@ -7,6 +7,7 @@
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 
+#include "ExecutionFrame.hpp"
 #include "Network.hpp"
 #include "LayerFwd.hpp"
 #include "Profiling.hpp"
@@ -51,6 +52,11 @@ public:
 
     void RegisterDebugCallback(const DebugCallbackFunction& func);
 
+    /// See IRuntime::SetTensorObserver().
+    void SetTensorObserver(const TensorObserverFunction& observer, const std::vector<LayerGuid>& layers);
+
+    void EnableTensorObservation(bool enable);
+
 private:
     void AllocateWorkingMemory();
 
@@ -76,8 +82,17 @@ private:
 
     std::unique_ptr<OptimizedNetwork> m_OptimizedNetwork;
     WorkloadQueue m_InputQueue;
-    WorkloadQueue m_WorkloadQueue;
     WorkloadQueue m_OutputQueue;
+
+    /// Shared by the execution frames. Declared first so that it outlives them.
+    TensorObservation m_TensorObservation;
+    std::vector<ObservableTensor> m_ObservableInputs;
+
+    /// The workloads, in chained frames. Workloads that only run on one branch of a Switch layer are in frames
+    /// that are skipped when that branch is not taken.
+    std::vector<std::unique_ptr<ExecutionFrame>> m_ExecutionFrames;
+    BranchState  m_BranchState;
+    unsigned int m_NumSwitches = 0;
     std::shared_ptr<Profiler> m_Profiler;
 
     mutable std::mutex m_WorkingMemMutex;
@@ -6,6 +6,7 @@
 #include "Network.hpp"
 #include "Graph.hpp"
 #include "Layer.hpp"
+#include "LayerSupportCache.hpp"
 #include "DeviceSpec.hpp"
 #include "Optimizer.hpp"
 #include "SubgraphViewSelector.hpp"
@@ -146,6 +147,7 @@ bool CheckScaleSetOnQuantizedType(Layer* layer, Optional<std::vector<std::string
 
 OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
                                   BackendSettings& backendSettings,
+                                  LayerSupportCache& layerSupportCache,
                                   Graph::Iterator& firstLayer,
                                   Graph::Iterator& lastLayer,
                                   Optional<std::vector<std::string>&> errMessages)
@@ -193,11 +195,11 @@ OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
             // need to set the compute device on the layer
             // before we can check if it is supported
             layer->SetBackendId(backend);
-            if (!IWorkloadFactory::IsLayerSupported(*layer, dataType, reasonIfUnsupported))
+            if (!layerSupportCache.IsLayerSupported(*layer, dataType, reasonIfUnsupported))
             {
                 if (dataType == DataType::Float16)
                 {
-                    if (IWorkloadFactory::IsLayerSupported(*layer, DataType::Float32, reasonIfUnsupported)
+                    if (layerSupportCache.IsLayerSupported(*layer, DataType::Float32, reasonIfUnsupported)
                         && layer->GetType() != LayerType::ConvertFp32ToFp16
                         && layer->GetType() != LayerType::ConvertFp16ToFp32)
                     {
@@ -217,7 +219,7 @@ OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
 
                             // Try preferred backend first
                             layer->SetBackendId(preferredBackend);
-                            if (IWorkloadFactory::IsLayerSupported(*layer,
+                            if (layerSupportCache.IsLayerSupported(*layer,
                                                                    EmptyOptional(),
                                                                    reasonIfUnsupported))
                             {
@@ -234,7 +236,7 @@ OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
                                     }
 
                                     layer->SetBackendId(backend);
-                                    if (IWorkloadFactory::IsLayerSupported(*layer,
+                                    if (layerSupportCache.IsLayerSupported(*layer,
                                                                            EmptyOptional(),
                                                                            reasonIfUnsupported))
                                     {
@@ -311,6 +313,7 @@ OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
 
 OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
                                   BackendSettings& backendSettings,
+                                  LayerSupportCache& layerSupportCache,
                                   SubgraphView& subgraph,
                                   Optional<std::vector<std::string>&> errMessages)
 {
@@ -318,6 +321,7 @@ OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
     Graph::Iterator lastLayer  = subgraph.end();
     return AssignBackends(optNetObjPtr,
                           backendSettings,
+                          layerSupportCache,
                           firstLayer,
                           lastLayer,
                           errMessages);
@@ -325,6 +329,7 @@ OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
 
 OptimizationResult ApplyBackendOptimizations(OptimizedNetwork* optNetObjPtr,
                                              BackendSettings& backendSettings,
+                                             LayerSupportCache& layerSupportCache,
                                              Optional<std::vector<std::string>&> errMessages)
 {
     BOOST_ASSERT(optNetObjPtr);
@@ -338,12 +343,9 @@ OptimizationResult ApplyBackendOptimizations(OptimizedNetwork* optNetObjPtr,
     SubgraphView mainSubgraph(optGraph);
 
     // Run backend specific optimizations
-    auto const& backendRegistry = BackendRegistryInstance();
     for (auto&& selectedBackend : backendSettings.m_SelectedBackends)
     {
-        auto backendFactory = backendRegistry.GetFactory(selectedBackend);
-        auto backendObjPtr  = backendFactory();
-        BOOST_ASSERT(backendObjPtr);
+        IBackendInternal* backendObjPtr = &layerSupportCache.GetBackend(selectedBackend);
 
         // Select sub-graphs based on backend
         SubgraphViewSelector::Subgraphs subgraphs =
@@ -409,6 +411,7 @@ OptimizationResult ApplyBackendOptimizations(OptimizedNetwork* optNetObjPtr,
 
                     OptimizationResult reassignmentResult = AssignBackends(optNetObjPtr,
                                                                            settingsCopy,
+                                                                           layerSupportCache,
                                                                            *subgraph,
                                                                            errMessages);
                     if (reassignmentResult.m_Error)
@@ -452,6 +455,8 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
                                                 SquashEqualReshapeSiblings(),
                                                 OptimizeInversePermutes(),
                                                 MovePermuteUp(),
+                                                FoldPermutesIntoDataLayout(),
+                                                FoldPermuteIntoConstant(),
                                                 PermuteAsReshape(),
                                                 OptimizeConsecutiveReshapes(),
                                                 FoldPadIntoConvolution2d()));
@@ -476,11 +481,15 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
         return IOptimizedNetworkPtr(nullptr, &IOptimizedNetwork::Destroy);
     }
 
+    // Backends, and the answers to their layer support queries, are shared by all the steps below
+    LayerSupportCache layerSupportCache;
+
     // Assign an available backend to each layer
     Graph::Iterator firstLayer = optGraph.begin();
     Graph::Iterator lastLayer  = optGraph.end();
     OptimizationResult assigBackendsResult = AssignBackends(optNetObjPtr,
                                                             backendSettings,
+                                                            layerSupportCache,
                                                             firstLayer,
                                                             lastLayer,
                                                             errMessages);
@@ -496,6 +505,7 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
     // Apply the backend-specific optimizations
     OptimizationResult backendOptimizationResult = ApplyBackendOptimizations(optNetObjPtr,
                                                                              backendSettings,
+                                                                             layerSupportCache,
                                                                              errMessages);
     if (backendOptimizationResult.m_Error)
     {
@@ -7,8 +7,8 @@
 #include <armnn/INetwork.hpp>
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
+#include <ParallelFor.hpp>
 #include <TensorUtils.hpp>
-#include <TensorIOUtils.hpp>
 
 #include "Graph.hpp"
 #include "Layer.hpp"
@@ -21,18 +21,16 @@
 #include "QuantizerVisitor.hpp"
 #include "OverrideInputRangeVisitor.hpp"
 
+#include <algorithm>
 #include <vector>
 #include <cmath>
 
-#include <boost/variant.hpp>
+#include <boost/numeric/conversion/cast.hpp>
 
 
 namespace armnn
 {
 
-using TContainer = boost::variant<std::vector<float>, std::vector<int>, std::vector<unsigned char>>;
-
-
 INetworkQuantizer* INetworkQuantizer::CreateRaw(INetwork* inputNetwork, const QuantizerOptions& options)
 {
     return new NetworkQuantizer(inputNetwork, options);
@@ -60,78 +58,156 @@ void NetworkQuantizer::OverrideInputRange(LayerBindingId layerId, float min, flo
 
 void NetworkQuantizer::Refine(const InputTensors& inputTensors)
 {
-    // The first time Refine is called the m_Runtime and the DynamicQuantizationVisitor
-    // will not have been created. Need to get the environment set up, Runtime loaded,
-    // DynamicQuantizationVisitor created and run over the network to initialise itself
-    // and the RangeTracker the Debug callback registered and an initial inference
-    // done to set up the first min/max values
+    RefineBatch(std::vector<InputTensors>{ inputTensors });
+}
+
+void NetworkQuantizer::RefineBatch(const std::vector<InputTensors>& inputTensorsBatch)
+{
+    if (inputTensorsBatch.empty())
+    {
+        return;
+    }
+
+    // The first time calibration data is given the m_Runtime and the DynamicQuantizationVisitor
+    // will not have been created.
     if (!m_Runtime)
     {
-        m_RefineCount = 0;
-        m_Ranges.SetDynamicMode(true);
-        const Graph& cGraph = boost::polymorphic_downcast<const Network*>(m_InputNetwork)->GetGraph().TopologicalSort();
-
-        // need to insert Debug layers in the DynamicQuantizationVisitor
-        Graph& graph = const_cast<Graph&>(cGraph);
-
-        // Initialize RangeTracker to the default values for each layer.
-        // The default values are overwritten by the min/max that is
-        // recorded during the first dataset min/max calibration. This
-        // initialisation is only required for the first call of Refine().
-        m_DynamicQuantizationVisitor = DynamicQuantizationVisitor(m_Ranges, graph);
-        VisitLayers(cGraph, m_DynamicQuantizationVisitor.value());
-
-        IRuntime::CreationOptions options;
-        m_Runtime = IRuntime::Create(options);
-
-        // Optimize network - debug already enabled for layers that require quantization
-        OptimizerOptions optimizerOptions(false, false);
-        std::vector<BackendId> backends = {"CpuRef"};
-        IOptimizedNetworkPtr optimizedNet = Optimize(*m_InputNetwork,
-                                                     backends,
-                                                     m_Runtime->GetDeviceSpec(),
-                                                     optimizerOptions);
-
-        m_Runtime->LoadNetwork(m_NetworkId, std::move(optimizedNet));
-
-        // Debug callback function to refine min/max in RangeTracker
-        auto rangeTrackerCallback = [&](LayerGuid guid, unsigned int slotIndex, ITensorHandle *tensorHandle) {
-            // Get min/max pair from tensor data
-            std::pair<float, float> minMax = armnnUtils::FindMinMax(tensorHandle);
-
-            // For first calibration dataset, set min/max range in RangeTracker to
-            // min/max ranges gathered during inference
-            if (m_RefineCount == 0)
-            {
-                m_Ranges.ResetMinMax(guid, slotIndex, minMax.first, minMax.second);
-            }
-            else
+        PrepareCalibration();
+    }
+
+    const unsigned int batchSize = boost::numeric_cast<unsigned int>(inputTensorsBatch.size());
+    const unsigned int maxInstances = m_Options.m_NumCalibrationThreads == 0 ?
+                                      armnnUtils::GetParallelForThreadCount() : m_Options.m_NumCalibrationThreads;
+    const unsigned int numInstances = std::min(batchSize, std::max(1u, maxInstances));
+    while (m_CalibrationInstances.size() < numInstances)
+    {
+        AddCalibrationInstance();
+    }
+
+    // Each instance runs every numInstances-th input of the batch. The ranges it observes are kept apart from the
+    // other instances' until they are all merged below.
+    armnnUtils::ParallelFor(numInstances, 1, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int instanceIndex = begin; instanceIndex < end; ++instanceIndex)
+        {
+            CalibrationInstance& instance = *m_CalibrationInstances[instanceIndex];
+            for (unsigned int inputIndex = instanceIndex; inputIndex < batchSize; inputIndex += numInstances)
             {
-                // For every other calibration dataset, only set min/max range if the
-                // values gathered are less than / greater than originally recorded.
-                m_Ranges.RefineMin(guid, slotIndex, minMax.first);
-                m_Ranges.RefineMax(guid, slotIndex, minMax.second);
+                m_Runtime->EnqueueWorkload(instance.m_NetworkId,
+                                           inputTensorsBatch[inputIndex],
+                                           instance.m_OutputTensors);
             }
-        };
+        }
+    });
 
-        m_Runtime->RegisterDebugCallback(m_NetworkId, rangeTrackerCallback);
+    MergeObservedRanges(batchSize);
+}
+
+void NetworkQuantizer::PrepareCalibration()
+{
+    // Need to get the environment set up and the DynamicQuantizationVisitor
+    // created and run over the network to initialise itself and the RangeTracker.
+    // The copies of the network the calibration data is run through are loaded
+    // as they are needed.
+    m_RefineCount = 0;
+    m_Ranges.SetDynamicMode(true);
+    const Graph& graph = boost::polymorphic_downcast<const Network*>(m_InputNetwork)->GetGraph().TopologicalSort();
+
+    // Initialize RangeTracker to the default values for each layer.
+    // The default values are overwritten by the min/max that is
+    // recorded during the first dataset min/max calibration. This
+    // initialisation is only required for the first call of Refine().
+    m_DynamicQuantizationVisitor = DynamicQuantizationVisitor(m_Ranges);
+    VisitLayers(graph, m_DynamicQuantizationVisitor.value());
+
+    IRuntime::CreationOptions options;
+    m_Runtime = IRuntime::Create(options);
+}
+
+void NetworkQuantizer::AddCalibrationInstance()
+{
+    auto instance = std::make_unique<CalibrationInstance>();
+
+    OptimizerOptions optimizerOptions(false, false);
+    std::vector<BackendId> backends = {"CpuRef"};
+    IOptimizedNetworkPtr optimizedNet = Optimize(*m_InputNetwork,
+                                                 backends,
+                                                 m_Runtime->GetDeviceSpec(),
+                                                 optimizerOptions);
+
+    m_Runtime->LoadNetwork(instance->m_NetworkId, std::move(optimizedNet));
+
+    // Tensor observer to record the min/max of each tensor of the layers to calibrate seen by this instance
+    CalibrationInstance* instancePtr = instance.get();
+    auto rangeTrackerCallback = [instancePtr](LayerGuid guid, unsigned int slotIndex, const ConstTensor& tensor) {
+        // Get min/max pair from tensor data
+        std::pair<float, float> minMax = armnnUtils::FindMinMax(static_cast<const float*>(tensor.GetMemoryArea()),
+                                                                tensor.GetNumElements());
+
+        auto inserted = instancePtr->m_ObservedRanges.emplace(std::make_pair(guid, slotIndex), minMax);
+        if (!inserted.second)
+        {
+            RangeTracker::MinMaxRange& observed = inserted.first->second;
+            observed.first = std::min(observed.first, minMax.first);
+            observed.second = std::max(observed.second, minMax.second);
+        }
+    };
+
+    m_Runtime->SetTensorObserver(instance->m_NetworkId,
+                                 rangeTrackerCallback,
+                                 m_DynamicQuantizationVisitor.value().GetLayersToCalibrate());
+
+    // Create output tensors for EnqueueWorkload
+    for (auto outputLayerBindingId : m_DynamicQuantizationVisitor.value().GetOutputLayers())
+    {
+        auto outputTensorInfo = m_Runtime->GetOutputTensorInfo(instance->m_NetworkId, outputLayerBindingId);
+        instance->m_OutputData.push_back(std::vector<float>(outputTensorInfo.GetNumElements(), 0));
+        instance->m_OutputTensors.push_back(
+            std::make_pair(outputLayerBindingId, Tensor(outputTensorInfo, instance->m_OutputData.back().data())));
     }
 
-    // Create output tensor for EnqueueWorkload
-    std::vector<armnn::BindingPointInfo> outputBindings;
-    auto outputLayers = m_DynamicQuantizationVisitor.value().GetOutputLayers();
-    std::vector<TContainer> outputVectors;
-    for (auto outputLayerBindingId : outputLayers)
+    m_CalibrationInstances.push_back(std::move(instance));
+}
+
+void NetworkQuantizer::MergeObservedRanges(unsigned int numInputs)
+{
+    std::map<std::pair<LayerGuid, unsigned int>, RangeTracker::MinMaxRange> observedRanges;
+    for (auto& instance : m_CalibrationInstances)
     {
-        auto outputTensorInfo = m_Runtime->GetOutputTensorInfo(m_NetworkId, outputLayerBindingId);
-        outputBindings.push_back(std::make_pair(outputLayerBindingId, outputTensorInfo));
-        outputVectors.push_back(std::vector<float>(outputTensorInfo.GetNumElements(), 0));
+        for (auto& observed : instance->m_ObservedRanges)
+        {
+            auto inserted = observedRanges.insert(observed);
+            if (!inserted.second)
+            {
+                RangeTracker::MinMaxRange& range = inserted.first->second;
+                range.first = std::min(range.first, observed.second.first);
+                range.second = std::max(range.second, observed.second.second);
+            }
+        }
+        instance->m_ObservedRanges.clear();
     }
-    OutputTensors outputTensors = armnnUtils::MakeOutputTensors<TContainer>(outputBindings, outputVectors);
 
-    // Execute EnqueueWorkload with calibration image
-    m_Runtime->EnqueueWorkload(m_NetworkId, inputTensors, outputTensors);
-    ++m_RefineCount;
+    for (auto& observed : observedRanges)
+    {
+        const LayerGuid guid = observed.first.first;
+        const unsigned int slotIndex = observed.first.second;
+        const RangeTracker::MinMaxRange& minMax = observed.second;
+
+        // For first calibration dataset, set min/max range in RangeTracker to
+        // min/max ranges gathered during inference
+        if (m_RefineCount == 0)
+        {
+            m_Ranges.ResetMinMax(guid, slotIndex, minMax.first, minMax.second);
+        }
+        else
+        {
+            // For every other calibration dataset, only set min/max range if the
+            // values gathered are less than / greater than originally recorded.
+            m_Ranges.RefineMin(guid, slotIndex, minMax.first);
+            m_Ranges.RefineMax(guid, slotIndex, minMax.second);
+        }
+    }
+    m_RefineCount += numInputs;
 }
 
 INetworkPtr NetworkQuantizer::ExportNetwork()
@@ -152,6 +228,7 @@ INetworkPtr NetworkQuantizer::ExportNetwork()
         // Set min/max range of non-calibrated layers to parent layer's range
         m_DynamicQuantizationVisitor.value().VisitNonCalibratedLayers();
         // now tear down the runtime and the dynamic visitor.
+        m_CalibrationInstances.clear();
         m_Runtime.reset(nullptr);
         m_DynamicQuantizationVisitor = EmptyOptional();
         m_RefineCount = 0;
@@ -14,6 +14,10 @@
 #include "DynamicQuantizationVisitor.hpp"
 #include "RangeTracker.hpp"
 
+#include <map>
+#include <memory>
+#include <vector>
+
 namespace armnn
 {
 
@@ -22,30 +26,49 @@ class NetworkQuantizer : public INetworkQuantizer
 public:
     NetworkQuantizer(INetwork* inputNetwork, const QuantizerOptions& options)
     : m_InputNetwork(inputNetwork),
-      m_NetworkId(0),
       m_Runtime(nullptr, &IRuntime::Destroy),
       m_RefineCount(0),
       m_Options(options) {}
 
     void OverrideInputRange(LayerBindingId layerId, float min, float max) override;
     void Refine(const InputTensors& inputTensors) override;
+    void RefineBatch(const std::vector<InputTensors>& inputTensorsBatch) override;
 
     // Required for testing? Need some way to get min/max in RangeTracker (m_Ranges)
     std::pair<float, float> GetMinMaxRange(LayerGuid guid, unsigned int idx) { return m_Ranges.GetRange(guid, idx); }
     INetworkPtr ExportNetwork() override;
 
 private:
+    /// A copy of the network loaded for calibration, and the ranges its tensor observer has seen since they
+    /// were last merged into m_Ranges. Each instance runs one calibration input at a time.
+    struct CalibrationInstance
+    {
+        NetworkId m_NetworkId;
+        std::vector<std::vector<float>> m_OutputData;
+        OutputTensors m_OutputTensors;
+        std::map<std::pair<LayerGuid, unsigned int>, RangeTracker::MinMaxRange> m_ObservedRanges;
+    };
+
+    /// Sets up the runtime and the RangeTracker the first time calibration data is given
+    void PrepareCalibration();
+
+    /// Optimizes and loads one more copy of the network
+    void AddCalibrationInstance();
+
+    /// Folds the ranges observed by every instance into m_Ranges, for @a numInputs more calibration inputs
+    void MergeObservedRanges(unsigned int numInputs);
+
     /// Original input network to quantize
     INetwork* m_InputNetwork;
 
-    NetworkId m_NetworkId;
-
     // if we are run in dynamic mode this unique pointer will hold
     // the runtime between invocations of the Refine method.
     IRuntimePtr m_Runtime;
 
     Optional<DynamicQuantizationVisitor> m_DynamicQuantizationVisitor;
 
+    std::vector<std::unique_ptr<CalibrationInstance>> m_CalibrationInstances;
+
     // counts the number of times refine is called
     unsigned int m_RefineCount;
 
@@ -0,0 +1,300 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "NetworkScheduler.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/ignore_unused.hpp>
+#include <boost/format.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace armnn
+{
+
+namespace
+{
+
+void PinCurrentThreadToCore(unsigned int core)
+{
+#if defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(core, &cpuSet);
+    if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "NetworkScheduler: failed to pin worker thread to core " << core;
+    }
+#else
+    boost::ignore_unused(core);
+    BOOST_LOG_TRIVIAL(warning) << "NetworkScheduler: thread pinning is not supported on this platform";
+#endif
+}
+
+double ToMicroseconds(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+} // anonymous namespace
+
+NetworkScheduler::NetworkScheduler(unsigned int numThreads, bool pinThreads)
+    : m_NumQueuedRequests(0)
+    , m_NextWorkerOffset(0)
+    , m_VirtualClock(0.0)
+    , m_Stopping(false)
+{
+    BOOST_ASSERT(numThreads > 0);
+
+    const unsigned int numCores = std::max(1u, std::thread::hardware_concurrency());
+    m_Workers.reserve(numThreads);
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        m_Workers.emplace_back([this, i, pinThreads, numCores]()
+        {
+            if (pinThreads)
+            {
+                PinCurrentThreadToCore(i % numCores);
+            }
+            WorkerLoop(i);
+        });
+    }
+}
+
+NetworkScheduler::~NetworkScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_Condition.notify_all();
+
+    for (std::thread& worker : m_Workers)
+    {
+        worker.join();
+    }
+}
+
+std::vector<bool> NetworkScheduler::AssignWorkers(unsigned int coreBudget)
+{
+    const unsigned int numWorkers = GetNumThreads();
+    std::vector<bool> allowed(numWorkers, false);
+
+    if (coreBudget == 0 || coreBudget >= numWorkers)
+    {
+        std::fill(allowed.begin(), allowed.end(), true);
+        return allowed;
+    }
+
+    // Hand out consecutive workers, rotating the starting point so that budgeted networks spread over the pool.
+    for (unsigned int i = 0; i < coreBudget; ++i)
+    {
+        allowed[(m_NextWorkerOffset + i) % numWorkers] = true;
+    }
+    m_NextWorkerOffset = (m_NextWorkerOffset + coreBudget) % numWorkers;
+    return allowed;
+}
+
+NetworkScheduler::NetworkState& NetworkScheduler::GetNetworkState(NetworkId networkId)
+{
+    auto it = m_Networks.find(networkId);
+    if (it == m_Networks.end())
+    {
+        throw InvalidArgumentException(
+            boost::str(boost::format("NetworkScheduler: network %1% is not registered") % networkId));
+    }
+    return it->second;
+}
+
+const NetworkScheduler::NetworkState& NetworkScheduler::GetNetworkState(NetworkId networkId) const
+{
+    return const_cast<NetworkScheduler*>(this)->GetNetworkState(networkId);
+}
+
+void NetworkScheduler::AddNetwork(NetworkId networkId)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    NetworkState& state = m_Networks[networkId];
+    state.m_AllowedWorkers = AssignWorkers(state.m_Options.m_CoreBudget);
+    state.m_VirtualTime = m_VirtualClock;
+}
+
+void NetworkScheduler::RemoveNetwork(NetworkId networkId)
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+
+    auto it = m_Networks.find(networkId);
+    if (it == m_Networks.end())
+    {
+        return;
+    }
+
+    m_Condition.wait(lock, [&it]() { return it->second.m_Queue.empty() && !it->second.m_Running; });
+    m_Networks.erase(it);
+}
+
+void NetworkScheduler::SetNetworkOptions(NetworkId networkId, const NetworkSchedulingOptions& options)
+{
+    if (options.m_Priority == 0)
+    {
+        throw InvalidArgumentException("NetworkScheduler: network priority must be at least 1");
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        NetworkState& state = GetNetworkState(networkId);
+        state.m_Options = options;
+        state.m_AllowedWorkers = AssignWorkers(options.m_CoreBudget);
+    }
+    // The new budget may make queued requests eligible for idle workers.
+    m_Condition.notify_all();
+}
+
+Status NetworkScheduler::Run(NetworkId networkId, Job job)
+{
+    auto request = std::make_shared<Request>();
+    request->m_Job = std::move(job);
+    request->m_SubmitTime = Clock::now();
+    std::future<Status> result = request->m_Result.get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        auto it = m_Networks.find(networkId);
+        if (it == m_Networks.end())
+        {
+            // The network is being unloaded (or was never loaded).
+            BOOST_LOG_TRIVIAL(warning) << "NetworkScheduler: network " << networkId << " is not registered";
+            return Status::Failure;
+        }
+
+        NetworkState& state = it->second;
+        if (state.m_Queue.empty() && !state.m_Running)
+        {
+            // A network becoming active starts at the current virtual time, so idle periods earn no credit.
+            state.m_VirtualTime = std::max(state.m_VirtualTime, m_VirtualClock);
+        }
+        state.m_Queue.push_back(request);
+        ++m_NumQueuedRequests;
+    }
+    m_Condition.notify_all();
+
+    return result.get();
+}
+
+NetworkSchedulingCounters NetworkScheduler::GetCounters(NetworkId networkId) const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    const NetworkState& state = GetNetworkState(networkId);
+
+    NetworkSchedulingCounters counters;
+    counters.m_QueueDepth        = static_cast<unsigned int>(state.m_Queue.size());
+    counters.m_CompletedRequests = state.m_CompletedRequests;
+    counters.m_MaxQueueLatencyUs = state.m_MaxQueueLatencyUs;
+    if (state.m_CompletedRequests > 0)
+    {
+        const double completed = static_cast<double>(state.m_CompletedRequests);
+        counters.m_MeanQueueLatencyUs     = state.m_TotalQueueLatencyUs / completed;
+        counters.m_MeanExecutionLatencyUs = state.m_TotalExecutionLatencyUs / completed;
+    }
+    return counters;
+}
+
+std::map<NetworkId, NetworkScheduler::NetworkState>::iterator NetworkScheduler::PickNetwork(unsigned int workerIndex)
+{
+    auto best = m_Networks.end();
+    for (auto it = m_Networks.begin(); it != m_Networks.end(); ++it)
+    {
+        const NetworkState& state = it->second;
+        if (state.m_Running || state.m_Queue.empty() || !state.m_AllowedWorkers[workerIndex])
+        {
+            continue;
+        }
+        if (best == m_Networks.end() || state.m_VirtualTime < best->second.m_VirtualTime)
+        {
+            best = it;
+        }
+    }
+    return best;
+}
+
+void NetworkScheduler::WorkerLoop(unsigned int workerIndex)
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        auto network = m_Networks.end();
+        m_Condition.wait(lock, [&]()
+        {
+            network = PickNetwork(workerIndex);
+            return network != m_Networks.end() || (m_Stopping && m_NumQueuedRequests == 0);
+        });
+
+        if (network == m_Networks.end())
+        {
+            // Stopping and every queue has been drained.
+            break;
+        }
+
+        NetworkState& state = network->second;
+        std::shared_ptr<Request> request = state.m_Queue.front();
+        state.m_Queue.pop_front();
+        state.m_Running = true;
+        --m_NumQueuedRequests;
+        m_VirtualClock = std::max(m_VirtualClock, state.m_VirtualTime);
+
+        lock.unlock();
+
+        const Clock::time_point startTime = Clock::now();
+        Status status = Status::Failure;
+        std::exception_ptr error;
+        try
+        {
+            status = request->m_Job();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        const Clock::time_point endTime = Clock::now();
+
+        lock.lock();
+
+        // The network cannot have been removed: RemoveNetwork() waits for m_Running to clear.
+        const double queueLatencyUs = ToMicroseconds(startTime - request->m_SubmitTime);
+        const double executionLatencyUs = ToMicroseconds(endTime - startTime);
+
+        state.m_Running = false;
+        state.m_VirtualTime += executionLatencyUs / static_cast<double>(state.m_Options.m_Priority);
+        state.m_CompletedRequests++;
+        state.m_TotalQueueLatencyUs += queueLatencyUs;
+        state.m_MaxQueueLatencyUs = std::max(state.m_MaxQueueLatencyUs, queueLatencyUs);
+        state.m_TotalExecutionLatencyUs += executionLatencyUs;
+
+        // Complete the request only after the counters are updated, so the caller observes them.
+        if (error)
+        {
+            request->m_Result.set_exception(error);
+        }
+        else
+        {
+            request->m_Result.set_value(status);
+        }
+
+        // Wake workers that may now run this network's next request, and any RemoveNetwork() waiting for idle.
+        m_Condition.notify_all();
+    }
+}
+
+} // namespace armnn
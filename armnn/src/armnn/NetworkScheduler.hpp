@@ -0,0 +1,109 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/IRuntime.hpp>
+#include <armnn/Types.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+
+/// Runs the requests of several loaded networks on one shared pool of worker threads.
+///
+/// Requests are queued per network. A network executes at most one request at a time (a LoadedNetwork is not
+/// re-entrant), and only on the workers in its core budget. When a worker becomes free it picks the eligible
+/// network with the smallest virtual time (start-time fair queuing): after each request a network's virtual time
+/// advances by the request's execution time divided by its priority, so under contention networks receive worker
+/// time in proportion to their priorities and an idle network cannot bank credit.
+class NetworkScheduler
+{
+public:
+    using Job = std::function<Status()>;
+
+    NetworkScheduler(unsigned int numThreads, bool pinThreads);
+
+    /// Executes every request still queued, then joins the workers.
+    ~NetworkScheduler();
+
+    NetworkScheduler(const NetworkScheduler&) = delete;
+    NetworkScheduler& operator=(const NetworkScheduler&) = delete;
+
+    void AddNetwork(NetworkId networkId);
+
+    /// Waits for all requests queued for the network to complete, then forgets it.
+    void RemoveNetwork(NetworkId networkId);
+
+    /// Throws InvalidArgumentException for unknown networks or a zero priority.
+    void SetNetworkOptions(NetworkId networkId, const NetworkSchedulingOptions& options);
+
+    /// Queues @a job for the given network and blocks until a worker has executed it.
+    /// Exceptions thrown by the job are rethrown on the calling thread. Returns Status::Failure without running
+    /// the job if the network is not registered, e.g. because it is being unloaded concurrently.
+    Status Run(NetworkId networkId, Job job);
+
+    NetworkSchedulingCounters GetCounters(NetworkId networkId) const;
+
+    unsigned int GetNumThreads() const { return static_cast<unsigned int>(m_Workers.size()); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Request
+    {
+        Job                  m_Job;
+        std::promise<Status> m_Result;
+        Clock::time_point    m_SubmitTime;
+    };
+
+    struct NetworkState
+    {
+        NetworkSchedulingOptions m_Options;
+        std::vector<bool>        m_AllowedWorkers;
+        std::deque<std::shared_ptr<Request>> m_Queue;
+        bool                     m_Running = false;
+        double                   m_VirtualTime = 0.0;
+
+        unsigned long m_CompletedRequests = 0;
+        double        m_TotalQueueLatencyUs = 0.0;
+        double        m_MaxQueueLatencyUs = 0.0;
+        double        m_TotalExecutionLatencyUs = 0.0;
+    };
+
+    void WorkerLoop(unsigned int workerIndex);
+
+    /// Returns the network whose next request should run on the given worker, or m_Networks.end() if none is
+    /// eligible. Must be called with m_Mutex held.
+    std::map<NetworkId, NetworkState>::iterator PickNetwork(unsigned int workerIndex);
+
+    /// Chooses which workers a network with the given core budget may run on. Must be called with m_Mutex held.
+    std::vector<bool> AssignWorkers(unsigned int coreBudget);
+
+    NetworkState& GetNetworkState(NetworkId networkId);
+    const NetworkState& GetNetworkState(NetworkId networkId) const;
+
+    mutable std::mutex      m_Mutex;
+    std::condition_variable m_Condition;
+
+    std::map<NetworkId, NetworkState> m_Networks;
+    unsigned int m_NumQueuedRequests;
+    unsigned int m_NextWorkerOffset;
+    double       m_VirtualClock;
+    bool         m_Stopping;
+
+    std::vector<std::thread> m_Workers;
+};
+
+} // namespace armnn
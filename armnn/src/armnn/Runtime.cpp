@@ -74,6 +74,11 @@ Status Runtime::LoadNetwork(NetworkId& networkIdOut,
         m_LoadedNetworks[networkIdOut] = std::move(loadedNetwork);
     }
 
+    if (m_Scheduler)
+    {
+        m_Scheduler->AddNetwork(networkIdOut);
+    }
+
     for (auto&& context : m_BackendContexts)
     {
         context.second->AfterLoadNetwork(networkIdOut);
@@ -97,6 +102,12 @@ Status Runtime::UnloadNetwork(NetworkId networkId)
         return Status::Failure;
     }
 
+    if (m_Scheduler)
+    {
+        // Lets requests already queued for the network complete before it goes away.
+        m_Scheduler->RemoveNetwork(networkId);
+    }
+
     {
         std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
@@ -153,6 +164,12 @@ Runtime::Runtime(const CreationOptions& options)
             }
         }
     }
+
+    if (options.m_NumSchedulerThreads > 0)
+    {
+        m_Scheduler = std::make_unique<NetworkScheduler>(options.m_NumSchedulerThreads,
+                                                         options.m_PinSchedulerThreads);
+    }
 }
 
 Runtime::~Runtime()
@@ -218,6 +235,16 @@ Status Runtime::EnqueueWorkload(NetworkId networkId,
 {
     LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
 
+    if (m_Scheduler)
+    {
+        // Networks sharing the scheduler run concurrently on behalf of different callers, so each keeps its
+        // working memory: freeing it on a switch of network by one caller would free it under another.
+        return m_Scheduler->Run(networkId, [loadedNetwork, &inputTensors, &outputTensors]()
+            {
+                return loadedNetwork->EnqueueWorkload(inputTensors, outputTensors);
+            });
+    }
+
     static thread_local NetworkId lastId = networkId;
     if (lastId != networkId)
     {
@@ -237,4 +264,62 @@ void Runtime::RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunc
     loadedNetwork->RegisterDebugCallback(func);
 }
 
+Status Runtime::SetTensorObserver(NetworkId networkId,
+                                  const TensorObserverFunction& observer,
+                                  const std::vector<LayerGuid>& layers)
+{
+    LoadedNetwork* loadedNetwork = nullptr;
+    LoadedNetworkFuncSafe(networkId, [&loadedNetwork](LoadedNetwork* network) { loadedNetwork = network; });
+    if (!loadedNetwork)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "Runtime::SetTensorObserver(): network " << networkId << " is not loaded";
+        return Status::Failure;
+    }
+    loadedNetwork->SetTensorObserver(observer, layers);
+    return Status::Success;
+}
+
+Status Runtime::EnableTensorObservation(NetworkId networkId, bool enable)
+{
+    LoadedNetwork* loadedNetwork = nullptr;
+    LoadedNetworkFuncSafe(networkId, [&loadedNetwork](LoadedNetwork* network) { loadedNetwork = network; });
+    if (!loadedNetwork)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "Runtime::EnableTensorObservation(): network " << networkId << " is not loaded";
+        return Status::Failure;
+    }
+    loadedNetwork->EnableTensorObservation(enable);
+    return Status::Success;
+}
+
+Status Runtime::SetNetworkSchedulingOptions(NetworkId networkId, const NetworkSchedulingOptions& options)
+{
+    if (!m_Scheduler)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "Runtime::SetNetworkSchedulingOptions(): the runtime was created "
+                                      "without scheduler threads";
+        return Status::Failure;
+    }
+
+    try
+    {
+        m_Scheduler->SetNetworkOptions(networkId, options);
+    }
+    catch (const InvalidArgumentException& e)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "Runtime::SetNetworkSchedulingOptions(): " << e.what();
+        return Status::Failure;
+    }
+    return Status::Success;
+}
+
+NetworkSchedulingCounters Runtime::GetNetworkSchedulingCounters(NetworkId networkId) const
+{
+    if (!m_Scheduler)
+    {
+        return NetworkSchedulingCounters();
+    }
+    return m_Scheduler->GetCounters(networkId);
+}
+
 }
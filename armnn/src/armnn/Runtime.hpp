@@ -6,6 +6,7 @@
 
 #include "LoadedNetwork.hpp"
 #include "DeviceSpec.hpp"
+#include "NetworkScheduler.hpp"
 #include <armnn/INetwork.hpp>
 #include <armnn/IRuntime.hpp>
 #include <armnn/Tensor.hpp>
@@ -64,6 +65,23 @@ public:
     /// @param func callback function to pass to the debug layer.
     virtual void RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func) override;
 
+    virtual Status SetTensorObserver(NetworkId networkId,
+                                     const TensorObserverFunction& observer,
+                                     const std::vector<LayerGuid>& layers = {}) override;
+
+    virtual Status EnableTensorObservation(NetworkId networkId, bool enable) override;
+
+    /// Sets the priority and core budget the scheduler uses for the given network.
+    /// @param networkId The id of the network to configure.
+    /// @param options The new scheduling parameters.
+    /// @return armnn::Status Failure if the network is not loaded or the runtime has no scheduler.
+    virtual Status SetNetworkSchedulingOptions(NetworkId networkId,
+                                               const NetworkSchedulingOptions& options) override;
+
+    /// Gets the queue depth and latency counters the scheduler has collected for the given network.
+    /// @param networkId The id of the network to query.
+    virtual NetworkSchedulingCounters GetNetworkSchedulingCounters(NetworkId networkId) const override;
+
     /// Creates a runtime for workload execution.
     /// May throw a ClRuntimeUnavailableException if @a defaultComputeDevice requires a CL runtime but
     /// it cannot be setup for some reason.
@@ -97,6 +115,9 @@ private:
     int m_NetworkIdCounter;
 
     DeviceSpec m_DeviceSpec;
+
+    /// Shared worker pool that executes EnqueueWorkload() requests, or nullptr if requests run on the caller thread.
+    std::unique_ptr<NetworkScheduler> m_Scheduler;
 };
 
 }
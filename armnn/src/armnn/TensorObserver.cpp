@@ -0,0 +1,177 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include <armnn/TensorObserver.hpp>
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/TypesUtils.hpp>
+
+#include <Half.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace armnn
+{
+
+namespace
+{
+
+uint32_t Fnv1aHash(const void* data, unsigned int numBytes)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint32_t hash = 2166136261u;
+    for (unsigned int i = 0; i < numBytes; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/// Calls @a func with the value of each element of @a tensor as a float.
+template <typename Func>
+void ForEachValue(const ConstTensor& tensor, Func func)
+{
+    const TensorInfo& info = tensor.GetInfo();
+    const unsigned int numElements = info.GetNumElements();
+    const float scale = info.GetQuantizationScale();
+    const int32_t offset = info.GetQuantizationOffset();
+
+    switch (info.GetDataType())
+    {
+        case DataType::Float32:
+        {
+            const float* data = static_cast<const float*>(tensor.GetMemoryArea());
+            std::for_each(data, data + numElements, func);
+            break;
+        }
+        case DataType::Float16:
+        {
+            const Half* data = static_cast<const Half*>(tensor.GetMemoryArea());
+            std::for_each(data, data + numElements, [&func](Half value) { func(static_cast<float>(value)); });
+            break;
+        }
+        case DataType::QuantisedAsymm8:
+        {
+            const uint8_t* data = static_cast<const uint8_t*>(tensor.GetMemoryArea());
+            std::for_each(data, data + numElements, [&](uint8_t value) { func(Dequantize(value, scale, offset)); });
+            break;
+        }
+        case DataType::QuantisedSymm16:
+        {
+            const int16_t* data = static_cast<const int16_t*>(tensor.GetMemoryArea());
+            std::for_each(data, data + numElements, [&](int16_t value) { func(Dequantize(value, scale, offset)); });
+            break;
+        }
+        case DataType::Signed32:
+        {
+            const int32_t* data = static_cast<const int32_t*>(tensor.GetMemoryArea());
+            std::for_each(data, data + numElements, [&func](int32_t value) { func(static_cast<float>(value)); });
+            break;
+        }
+        case DataType::Boolean:
+        {
+            const uint8_t* data = static_cast<const uint8_t*>(tensor.GetMemoryArea());
+            std::for_each(data, data + numElements, [&func](uint8_t value) { func(value ? 1.0f : 0.0f); });
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+} // anonymous namespace
+
+TensorStatisticsCollector::TensorStatisticsCollector(unsigned int numHistogramBins,
+                                                     float histogramMin,
+                                                     float histogramMax)
+    : m_NumHistogramBins(numHistogramBins)
+    , m_HistogramMin(histogramMin)
+    , m_HistogramMax(histogramMax)
+{
+    if (numHistogramBins != 0 && !(histogramMax > histogramMin))
+    {
+        throw InvalidArgumentException("TensorStatisticsCollector: the histogram range must not be empty");
+    }
+}
+
+TensorObserverFunction TensorStatisticsCollector::GetObserver()
+{
+    return [this](LayerGuid guid, unsigned int slotIndex, const ConstTensor& tensor)
+    {
+        Observe(guid, slotIndex, tensor);
+    };
+}
+
+void TensorStatisticsCollector::Observe(LayerGuid guid, unsigned int slotIndex, const ConstTensor& tensor)
+{
+    // The statistics of the tensor are computed before taking the lock, so that networks observed concurrently
+    // only wait for each other to merge them.
+    TensorStatistics observed;
+    observed.m_NumObservations = 1;
+    observed.m_Checksum = Fnv1aHash(tensor.GetMemoryArea(), tensor.GetNumBytes());
+    observed.m_Histogram.assign(m_NumHistogramBins, 0);
+
+    float min = std::numeric_limits<float>::infinity();
+    float max = -std::numeric_limits<float>::infinity();
+    const float binScale = m_NumHistogramBins == 0 ? 0.0f :
+                           static_cast<float>(m_NumHistogramBins) / (m_HistogramMax - m_HistogramMin);
+    ForEachValue(tensor, [&](float value)
+    {
+        min = std::min(min, value);
+        max = std::max(max, value);
+        if (m_NumHistogramBins != 0)
+        {
+            const float bin = std::floor((value - m_HistogramMin) * binScale);
+            const float lastBin = static_cast<float>(m_NumHistogramBins - 1);
+            ++observed.m_Histogram[static_cast<size_t>(std::min(std::max(bin, 0.0f), lastBin))];
+        }
+    });
+    observed.m_Min = min;
+    observed.m_Max = max;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto inserted = m_Statistics.emplace(std::make_pair(guid, slotIndex), observed);
+    if (inserted.second)
+    {
+        return;
+    }
+
+    TensorStatistics& statistics = inserted.first->second;
+    ++statistics.m_NumObservations;
+    statistics.m_Min = std::min(statistics.m_Min, observed.m_Min);
+    statistics.m_Max = std::max(statistics.m_Max, observed.m_Max);
+    for (size_t i = 0; i < observed.m_Histogram.size(); ++i)
+    {
+        statistics.m_Histogram[i] += observed.m_Histogram[i];
+    }
+    statistics.m_Checksum = observed.m_Checksum;
+}
+
+TensorStatistics TensorStatisticsCollector::GetStatistics(LayerGuid guid, unsigned int slotIndex) const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = m_Statistics.find(std::make_pair(guid, slotIndex));
+    return it == m_Statistics.end() ? TensorStatistics() : it->second;
+}
+
+std::vector<std::pair<LayerGuid, unsigned int>> TensorStatisticsCollector::GetObservedTensors() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::vector<std::pair<LayerGuid, unsigned int>> observedTensors;
+    for (auto&& statistics : m_Statistics)
+    {
+        observedTensors.push_back(statistics.first);
+    }
+    return observedTensors;
+}
+
+void TensorStatisticsCollector::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Statistics.clear();
+}
+
+} // namespace armnn
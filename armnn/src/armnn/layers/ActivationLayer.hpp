@@ -26,6 +26,8 @@ public:
     /// Check if the input tensor shape(s) will lead to a valid configuration of @ref ActivationLayer.
     void ValidateTensorShapesFromInputs() override;
 
+    bool SupportsInPlaceExecution() const override { return true; }
+
     void Accept(ILayerVisitor& visitor) const override;
 
 
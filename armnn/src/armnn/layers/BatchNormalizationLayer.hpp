@@ -39,6 +39,8 @@ public:
     /// will lead to a valid configuration of @ref BatchNormalizationLayer.
     void ValidateTensorShapesFromInputs() override;
 
+    bool SupportsInPlaceExecution() const override { return true; }
+
     void Accept(ILayerVisitor& visitor) const override;
 
 protected:
@@ -26,6 +26,9 @@ public:
     /// @return A vector to the inferred output shape.
     std::vector<TensorShape> InferOutputShapes(const std::vector<TensorShape>& inputShapes) const override;
 
+    /// The output can overwrite an input that is not broadcast, and has the type of the output.
+    bool SupportsInPlaceExecution() const override { return true; }
+
 protected:
     /// @param numInputSlots The number of input slots for the layer.
     /// @param numOutputSlots The number of output slots for the layer.
@@ -25,6 +25,34 @@ std::unique_ptr<IWorkload> ReshapeLayer::CreateWorkload(const Graph& graph,
     return factory.CreateReshape(descriptor, PrepInfoAndDesc(descriptor, graph));
 }
 
+void ReshapeLayer::CreateTensorHandles(Graph& graph, const IWorkloadFactory& factory)
+{
+    const OutputSlot* input = GetInputSlot(0).GetConnectedOutputSlot();
+    ITensorHandle* inputHandle = input->GetOutputHandler().GetData();
+    const TensorInfo& outputInfo = GetOutputSlot(0).GetTensorInfo();
+
+    // Only tensors of the same backend can be aliased, and the data must mean the same in both shapes.
+    if (inputHandle && input->GetOwningLayer().GetBackendId() == GetBackendId() &&
+        input->GetTensorInfo().IsTypeSpaceMatch(outputInfo))
+    {
+        std::unique_ptr<ITensorHandle> view = factory.CreateAliasTensorHandle(*inputHandle, outputInfo);
+        if (view)
+        {
+            m_OutputHandlers[0].SetData(std::move(view));
+            return;
+        }
+    }
+
+    Layer::CreateTensorHandles(graph, factory);
+}
+
+bool ReshapeLayer::IsViewOfInput() const
+{
+    const ITensorHandle* outputHandle = GetOutputHandler(0).GetData();
+    return outputHandle && outputHandle->GetParent() &&
+           outputHandle->GetParent() == GetInputSlot(0).GetConnectedOutputSlot()->GetOutputHandler().GetData();
+}
+
 ReshapeLayer* ReshapeLayer::Clone(Graph& graph) const
 {
     return CloneBase<ReshapeLayer>(graph, m_Param, GetName());
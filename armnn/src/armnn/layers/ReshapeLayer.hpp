@@ -20,6 +20,15 @@ public:
     virtual std::unique_ptr<IWorkload> CreateWorkload(const Graph& graph,
                                                       const IWorkloadFactory& factory) const override;
 
+    /// Makes the output a view of the input if the backend can alias it, in which case no workload needs to run
+    /// for the layer, otherwise creates tensor handlers.
+    /// @param [in] graph The graph where this layer can be found.
+    /// @param [in] factory The workload factory which will create the workload.
+    virtual void CreateTensorHandles(Graph& graph, const IWorkloadFactory& factory) override;
+
+    /// Indicates if the output has been made a view of the input by CreateTensorHandles().
+    bool IsViewOfInput() const;
+
     /// Creates a dynamically-allocated copy of this layer.
     /// @param [in] graph The graph into which this layer is being cloned.
     ReshapeLayer* Clone(Graph& graph) const override;
@@ -14,3 +14,5 @@
 #include "ConvertFp32NetworkToFp16.hpp"
 #include "AddDebug.hpp"
 #include "FoldPadIntoConvolution2d.hpp"
+#include "FoldPermuteIntoConstant.hpp"
+#include "FoldPermutesIntoDataLayout.hpp"
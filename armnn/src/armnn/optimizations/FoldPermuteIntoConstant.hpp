@@ -0,0 +1,57 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+#include "Permute.hpp"
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+class FoldPermuteIntoConstantImpl
+{
+public:
+    /// Run for every connection between a base ConstantLayer and a child PermuteLayer.
+    /// Permutes the constant data once, at optimization time, into a new constant layer that replaces the permute.
+    /// The original constant is left in place for its other consumers, and is removed if left unconnected.
+    void Run(Graph& graph, InputSlot& connection) const
+    {
+        auto base = boost::polymorphic_downcast<ConstantLayer*>(&connection.GetConnectedOutputSlot()->GetOwningLayer());
+        auto permute = boost::polymorphic_downcast<PermuteLayer*>(&connection.GetOwningLayer());
+
+        BOOST_ASSERT_MSG(base->m_LayerOutput != nullptr, "FoldPermuteIntoConstant: Constant data should not be null.");
+
+        const TensorInfo& constantInfo = base->m_LayerOutput->GetTensorInfo();
+        const TensorInfo permutedInfo = armnnUtils::Permuted(constantInfo, permute->GetPermutation());
+
+        std::vector<unsigned char> permutedData(permutedInfo.GetNumBytes());
+        armnnUtils::Permute(permutedInfo.GetShape(), permute->GetPermutation(),
+                            base->m_LayerOutput->GetConstTensor<void>(), permutedData.data(),
+                            GetDataTypeSize(permutedInfo.GetDataType()));
+
+        const std::string name = std::string("folded-") + permute->GetName() + std::string("-into-") + base->GetName();
+        ConstantLayer& folded = *graph.AddLayer<ConstantLayer>(name.c_str());
+        folded.m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(permutedInfo, permutedData.data()));
+        folded.GetOutputHandler().SetTensorInfo(permute->GetOutputHandler().GetTensorInfo());
+
+        // Bypasses the permute. It will be removed as it's left unconnected.
+        permute->GetOutputSlot().MoveAllConnections(folded.GetOutputSlot());
+    }
+
+protected:
+    FoldPermuteIntoConstantImpl() = default;
+    ~FoldPermuteIntoConstantImpl() = default;
+};
+
+using FoldPermuteIntoConstant = OptimizeForConnection<ConstantLayer, PermuteLayer, FoldPermuteIntoConstantImpl>;
+
+} // namespace optimizations
+} // namespace armnn
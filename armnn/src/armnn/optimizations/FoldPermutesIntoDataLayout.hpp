@@ -0,0 +1,235 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+#include "Permute.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+class FoldPermutesIntoDataLayoutImpl
+{
+public:
+    /// Run for every PermuteLayer. Follows the chain of single consumers after the permute through layout agnostic
+    /// layers and at most one layer with a DataLayout parameter. If the chain ends in the inverse permute, and the
+    /// permutes convert between NHWC and NCHW around the layout aware layer, the layer is switched to the other
+    /// data layout and both permutes are removed, so that the data is never transposed at runtime.
+    void Run(Graph& graph, PermuteLayer& permute) const
+    {
+        const PermutationVector& perm = permute.GetPermutation();
+        std::vector<Layer*> chain;
+        Layer* layoutLayer = nullptr;
+
+        OutputSlot* output = &permute.GetOutputSlot();
+        PermuteLayer* inverse = nullptr;
+        while (inverse == nullptr)
+        {
+            if (output->GetNumConnections() != 1U)
+            {
+                return;
+            }
+            Layer& next = output->GetConnection(0)->GetOwningLayer();
+            if (next.GetType() == LayerType::Permute)
+            {
+                inverse = boost::polymorphic_downcast<PermuteLayer*>(&next);
+                if (!inverse->IsInverse(permute))
+                {
+                    return;
+                }
+                continue;
+            }
+
+            if (IsLayoutAware(next))
+            {
+                if (layoutLayer != nullptr)
+                {
+                    return;
+                }
+                layoutLayer = &next;
+            }
+            else if (!IsLayoutAgnostic(next))
+            {
+                return;
+            }
+            chain.push_back(&next);
+            output = &next.GetOutputSlot(0);
+        }
+
+        if (chain.empty())
+        {
+            return;
+        }
+
+        if (layoutLayer != nullptr)
+        {
+            const PermutationVector nhwcToNchw({ 0, 2, 3, 1 });
+            const PermutationVector nchwToNhwc({ 0, 3, 1, 2 });
+            const DataLayout dataLayout = GetDataLayout(*layoutLayer);
+            if (perm.IsEqual(nhwcToNchw) && dataLayout == DataLayout::NCHW)
+            {
+                ReplaceDataLayout(graph, chain, *layoutLayer, DataLayout::NHWC);
+            }
+            else if (perm.IsEqual(nchwToNhwc) && dataLayout == DataLayout::NHWC)
+            {
+                ReplaceDataLayout(graph, chain, *layoutLayer, DataLayout::NCHW);
+            }
+            else
+            {
+                return;
+            }
+        }
+
+        // Every layer in the chain now works on unpermuted data.
+        for (Layer* layer : chain)
+        {
+            const TensorInfo& info = layer->GetOutputHandler().GetTensorInfo();
+            layer->GetOutputHandler().SetTensorInfo(armnnUtils::Permuted(info, inverse->GetPermutation()));
+        }
+
+        // Bypasses both permutes. The base permute is removed by the optimizer as it's left unconnected.
+        permute.GetOutputSlot().MoveAllConnections(*permute.GetInputSlot(0).GetConnectedOutputSlot());
+        inverse->GetOutputSlot().MoveAllConnections(chain.back()->GetOutputSlot(0));
+        graph.EraseLayer(inverse);
+    }
+
+protected:
+    FoldPermutesIntoDataLayoutImpl() = default;
+    ~FoldPermutesIntoDataLayoutImpl() = default;
+
+private:
+    /// Layers computing each output element from the input element at the same index only.
+    static bool IsLayoutAgnostic(const Layer& layer)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::Activation:
+            case LayerType::FakeQuantization:
+            case LayerType::Floor:
+            case LayerType::MemCopy:
+                return layer.GetNumInputSlots() == 1U && layer.GetNumOutputSlots() == 1U;
+            default:
+                return false;
+        }
+    }
+
+    /// Layers that support both NHWC and NCHW and hold no layout dependent weights.
+    static bool IsLayoutAware(const Layer& layer)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::BatchNormalization:
+            case LayerType::BatchToSpaceNd:
+            case LayerType::L2Normalization:
+            case LayerType::Pooling2d:
+            case LayerType::ResizeBilinear:
+            case LayerType::SpaceToBatchNd:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    template <typename LayerT>
+    static DataLayout GetDataLayoutOf(const Layer& layer)
+    {
+        return boost::polymorphic_downcast<const LayerT*>(&layer)->GetParameters().m_DataLayout;
+    }
+
+    static DataLayout GetDataLayout(const Layer& layer)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::BatchNormalization:
+                return GetDataLayoutOf<BatchNormalizationLayer>(layer);
+            case LayerType::BatchToSpaceNd:
+                return GetDataLayoutOf<BatchToSpaceNdLayer>(layer);
+            case LayerType::L2Normalization:
+                return GetDataLayoutOf<L2NormalizationLayer>(layer);
+            case LayerType::Pooling2d:
+                return GetDataLayoutOf<Pooling2dLayer>(layer);
+            case LayerType::ResizeBilinear:
+                return GetDataLayoutOf<ResizeBilinearLayer>(layer);
+            case LayerType::SpaceToBatchNd:
+                return GetDataLayoutOf<SpaceToBatchNdLayer>(layer);
+            default:
+                BOOST_ASSERT_MSG(false, "FoldPermutesIntoDataLayout: Unexpected layer type");
+                return DataLayout::NCHW;
+        }
+    }
+
+    static void MoveConstants(Layer&, Layer&) {}
+
+    static void MoveConstants(BatchNormalizationLayer& from, BatchNormalizationLayer& to)
+    {
+        to.m_Mean = std::move(from.m_Mean);
+        to.m_Variance = std::move(from.m_Variance);
+        to.m_Beta = std::move(from.m_Beta);
+        to.m_Gamma = std::move(from.m_Gamma);
+    }
+
+    template <typename LayerT>
+    static Layer& AddWithDataLayout(Graph& graph, Layer& layer, DataLayout dataLayout)
+    {
+        LayerT& original = *boost::polymorphic_downcast<LayerT*>(&layer);
+        auto descriptor = original.GetParameters();
+        descriptor.m_DataLayout = dataLayout;
+
+        LayerT& replacement = *graph.AddLayer<LayerT>(descriptor, layer.GetName());
+        MoveConstants(original, replacement);
+        return replacement;
+    }
+
+    /// Replaces @a layer in the graph and in @a chain with a copy using @a dataLayout.
+    static void ReplaceDataLayout(Graph& graph, std::vector<Layer*>& chain, Layer& layer, DataLayout dataLayout)
+    {
+        Layer* replacement = nullptr;
+        switch (layer.GetType())
+        {
+            case LayerType::BatchNormalization:
+                replacement = &AddWithDataLayout<BatchNormalizationLayer>(graph, layer, dataLayout);
+                break;
+            case LayerType::BatchToSpaceNd:
+                replacement = &AddWithDataLayout<BatchToSpaceNdLayer>(graph, layer, dataLayout);
+                break;
+            case LayerType::L2Normalization:
+                replacement = &AddWithDataLayout<L2NormalizationLayer>(graph, layer, dataLayout);
+                break;
+            case LayerType::Pooling2d:
+                replacement = &AddWithDataLayout<Pooling2dLayer>(graph, layer, dataLayout);
+                break;
+            case LayerType::ResizeBilinear:
+                replacement = &AddWithDataLayout<ResizeBilinearLayer>(graph, layer, dataLayout);
+                break;
+            case LayerType::SpaceToBatchNd:
+                replacement = &AddWithDataLayout<SpaceToBatchNdLayer>(graph, layer, dataLayout);
+                break;
+            default:
+                BOOST_ASSERT_MSG(false, "FoldPermutesIntoDataLayout: Unexpected layer type");
+                return;
+        }
+
+        replacement->GetOutputHandler().SetTensorInfo(layer.GetOutputHandler().GetTensorInfo());
+
+        OutputSlot& parentOutput = *layer.GetInputSlot(0).GetConnectedOutputSlot();
+        parentOutput.Disconnect(layer.GetInputSlot(0));
+        parentOutput.Connect(replacement->GetInputSlot(0));
+        layer.GetOutputSlot(0).MoveAllConnections(replacement->GetOutputSlot(0));
+
+        std::replace(chain.begin(), chain.end(), &layer, replacement);
+        Layer* erased = &layer;
+        graph.EraseLayer(erased);
+    }
+};
+
+using FoldPermutesIntoDataLayout = OptimizeForType<PermuteLayer, FoldPermutesIntoDataLayoutImpl>;
+
+} // namespace optimizations
+} // namespace armnn
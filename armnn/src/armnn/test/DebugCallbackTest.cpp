@@ -6,6 +6,7 @@
 #include <armnn/Descriptors.hpp>
 #include <armnn/IRuntime.hpp>
 #include <armnn/INetwork.hpp>
+#include <armnn/TensorObserver.hpp>
 #include <armnn/Types.hpp>
 #include <Runtime.hpp>
 
@@ -93,6 +94,77 @@ BOOST_AUTO_TEST_CASE(RuntimeRegisterDebugCallback)
     BOOST_TEST(slotIndexes == expectedSlotIndexes);
 }
 
+BOOST_AUTO_TEST_CASE(RuntimeTensorObserver)
+{
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0, "Input");
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = ActivationFunction::ReLu;
+    IConnectableLayer* activationLayer = net->AddActivationLayer(descriptor, "Activation:ReLu");
+    IConnectableLayer* output = net->AddOutputLayer(0);
+    input->GetOutputSlot(0).Connect(activationLayer->GetInputSlot(0));
+    activationLayer->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 1, 1, 5 }, DataType::Float32));
+    activationLayer->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 1, 1, 5 }, DataType::Float32));
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // No Debug layers: the observer is attached to the loaded network
+    std::vector<BackendId> backends = { "CpuRef" };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    std::vector<float> inputData({-2, -1, 0, 1, 2});
+    std::vector<float> outputData(5);
+    InputTensors inputTensors
+    {
+        {0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data())}
+    };
+    OutputTensors outputTensors
+    {
+        {0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data())}
+    };
+
+    TensorStatisticsCollector collector(4, -2.0f, 2.0f);
+    BOOST_TEST(runtime->SetTensorObserver(netId, collector.GetObserver()) == Status::Success);
+    runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+
+    const TensorStatistics inputStatistics = collector.GetStatistics(input->GetGuid(), 0);
+    BOOST_TEST(inputStatistics.m_NumObservations == 1);
+    BOOST_TEST(inputStatistics.m_Min == -2.0f);
+    BOOST_TEST(inputStatistics.m_Max == 2.0f);
+    const std::vector<uint64_t> expectedHistogram({ 1, 1, 1, 2 });
+    BOOST_TEST(inputStatistics.m_Histogram == expectedHistogram);
+
+    const TensorStatistics activationStatistics = collector.GetStatistics(activationLayer->GetGuid(), 0);
+    BOOST_TEST(activationStatistics.m_NumObservations == 1);
+    BOOST_TEST(activationStatistics.m_Min == 0.0f);
+    BOOST_TEST(activationStatistics.m_Max == 2.0f);
+    BOOST_TEST(collector.GetObservedTensors().size() == 2);
+
+    // Disabled, then enabled again, without reloading the network
+    BOOST_TEST(runtime->EnableTensorObservation(netId, false) == Status::Success);
+    runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+    BOOST_TEST(collector.GetStatistics(activationLayer->GetGuid(), 0).m_NumObservations == 1);
+
+    BOOST_TEST(runtime->EnableTensorObservation(netId, true) == Status::Success);
+    runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+    BOOST_TEST(collector.GetStatistics(activationLayer->GetGuid(), 0).m_NumObservations == 2);
+    BOOST_TEST(collector.GetStatistics(activationLayer->GetGuid(), 0).m_Checksum == activationStatistics.m_Checksum);
+
+    // Only the layers asked for are observed
+    collector.Reset();
+    runtime->SetTensorObserver(netId, collector.GetObserver(), { activationLayer->GetGuid() });
+    runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+    BOOST_TEST(collector.GetObservedTensors().size() == 1);
+    BOOST_TEST(collector.GetStatistics(activationLayer->GetGuid(), 0).m_NumObservations == 1);
+
+    BOOST_TEST(runtime->EnableTensorObservation(netId + 1, true) == Status::Failure);
+}
+
 } // anonymous namespace
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: MIT
 //
 
+#include <armnn/ArmNN.hpp>
 #include <armnn/Descriptors.hpp>
 #include <armnn/IRuntime.hpp>
 #include <armnn/INetwork.hpp>
@@ -10,9 +11,117 @@
 #include <boost/test/unit_test.hpp>
 
 #include <set>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+
+using namespace armnn;
+
+const TensorInfo g_DataInfo({ 4 }, DataType::Float32);
+const TensorInfo g_ConditionInfo({ 1 }, DataType::Float32);
+
+// Builds the equivalent of 'output = condition ? input * input : input + input'.
+INetworkPtr CreateSwitchNetwork()
+{
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* condition = net->AddInputLayer(1);
+    IConnectableLayer* switchLayer = net->AddSwitchLayer("switch");
+    IConnectableLayer* addition = net->AddAdditionLayer("addition");
+    IConnectableLayer* multiplication = net->AddMultiplicationLayer("multiplication");
+    IConnectableLayer* mergeLayer = net->AddMergeLayer("merge");
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(switchLayer->GetInputSlot(0));
+    condition->GetOutputSlot(0).Connect(switchLayer->GetInputSlot(1));
+    switchLayer->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    switchLayer->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    switchLayer->GetOutputSlot(1).Connect(multiplication->GetInputSlot(0));
+    switchLayer->GetOutputSlot(1).Connect(multiplication->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(mergeLayer->GetInputSlot(0));
+    multiplication->GetOutputSlot(0).Connect(mergeLayer->GetInputSlot(1));
+    mergeLayer->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(g_DataInfo);
+    condition->GetOutputSlot(0).SetTensorInfo(g_ConditionInfo);
+    switchLayer->GetOutputSlot(0).SetTensorInfo(g_DataInfo);
+    switchLayer->GetOutputSlot(1).SetTensorInfo(g_DataInfo);
+    addition->GetOutputSlot(0).SetTensorInfo(g_DataInfo);
+    multiplication->GetOutputSlot(0).SetTensorInfo(g_DataInfo);
+    mergeLayer->GetOutputSlot(0).SetTensorInfo(g_DataInfo);
+
+    return net;
+}
+
+// Runs the network with profiling enabled, and returns the profile to tell which workloads ran. The profiler only
+// reports the workloads of the first inference.
+std::string RunSwitchNetwork(IRuntime& runtime, NetworkId netId, float condition, std::vector<float>& outputData)
+{
+    std::vector<float> inputData = { 1.0f, 2.0f, 3.0f, -4.0f };
+    std::vector<float> conditionData = { condition };
+    InputTensors inputTensors
+    {
+        { 0, ConstTensor(runtime.GetInputTensorInfo(netId, 0), inputData.data()) },
+        { 1, ConstTensor(runtime.GetInputTensorInfo(netId, 1), conditionData.data()) }
+    };
+    OutputTensors outputTensors
+    {
+        { 0, Tensor(runtime.GetOutputTensorInfo(netId, 0), outputData.data()) }
+    };
+
+    std::shared_ptr<IProfiler> profiler = runtime.GetProfiler(netId);
+    profiler->EnableProfiling(true);
+    BOOST_TEST(runtime.EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    profiler->EnableProfiling(false);
+
+    std::stringstream profile;
+    profiler->Print(profile);
+    return profile.str();
+}
+
+} // anonymous namespace
 
 BOOST_AUTO_TEST_SUITE(FlowControl)
 
+BOOST_AUTO_TEST_CASE(SwitchRunsOnlyTheBranchTaken)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<BackendId> backends = {Compute::CpuRef};
+    std::vector<float> outputData(4);
+
+    for (float condition : { 0.0f, 1.0f })
+    {
+        IOptimizedNetworkPtr optNet = Optimize(*CreateSwitchNetwork(), backends, runtime->GetDeviceSpec());
+        BOOST_TEST_REQUIRE(optNet.get() != nullptr);
+
+        NetworkId netId;
+        BOOST_TEST_REQUIRE(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+        std::string profile = RunSwitchNetwork(*runtime, netId, condition, outputData);
+        const bool additionRan = profile.find("RefAdditionWorkload_Execute") != std::string::npos;
+        const bool multiplicationRan = profile.find("RefMultiplicationWorkload_Execute") != std::string::npos;
+        BOOST_TEST(additionRan == (condition == 0.0f));
+        BOOST_TEST(multiplicationRan == (condition != 0.0f));
+
+        // Runs both branches, the other one for the first time, on the same loaded network.
+        std::vector<float> expectedFalse = { 2.0f, 4.0f, 6.0f, -8.0f };
+        std::vector<float> expectedTrue = { 1.0f, 4.0f, 9.0f, 16.0f };
+        BOOST_TEST(outputData == (condition == 0.0f ? expectedFalse : expectedTrue), boost::test_tools::per_element());
+
+        RunSwitchNetwork(*runtime, netId, 1.0f - condition, outputData);
+        BOOST_TEST(outputData == (condition == 0.0f ? expectedTrue : expectedFalse), boost::test_tools::per_element());
+
+        runtime->UnloadNetwork(netId);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(ErrorOnLoadNetwork)
 {
     using namespace armnn;
@@ -23,31 +132,39 @@ BOOST_AUTO_TEST_CASE(ErrorOnLoadNetwork)
 
     // build up the structure of the network
     // It's equivalent to something like
-    // if (0) {} else {}
+    // input + input, where each operand is taken from a different branch of the switch
     INetworkPtr net(INetwork::Create());
 
-    std::vector<uint8_t> falseData = {0};
-    ConstTensor falseTensor(armnn::TensorInfo({1}, armnn::DataType::Boolean), falseData);
-    IConnectableLayer* constLayer = net->AddConstantLayer(falseTensor, "const");    
-    constLayer->GetOutputSlot(0).SetTensorInfo(armnn::TensorInfo({1}, armnn::DataType::Boolean));
-
     IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* condition = net->AddInputLayer(1);
 
     IConnectableLayer* switchLayer = net->AddSwitchLayer("switch");
-    IConnectableLayer* mergeLayer = net->AddMergeLayer("merge");
+    IConnectableLayer* addition = net->AddAdditionLayer("addition");
 
     IConnectableLayer* output = net->AddOutputLayer(0);
 
     input->GetOutputSlot(0).Connect(switchLayer->GetInputSlot(0));
-    constLayer->GetOutputSlot(0).Connect(switchLayer->GetInputSlot(1));
-    switchLayer->GetOutputSlot(0).Connect(mergeLayer->GetInputSlot(0));
-    switchLayer->GetOutputSlot(1).Connect(mergeLayer->GetInputSlot(1));
-    mergeLayer->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    condition->GetOutputSlot(0).Connect(switchLayer->GetInputSlot(1));
+    switchLayer->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    switchLayer->GetOutputSlot(1).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(g_DataInfo);
+    condition->GetOutputSlot(0).SetTensorInfo(g_ConditionInfo);
+    switchLayer->GetOutputSlot(0).SetTensorInfo(g_DataInfo);
+    switchLayer->GetOutputSlot(1).SetTensorInfo(g_DataInfo);
+    addition->GetOutputSlot(0).SetTensorInfo(g_DataInfo);
 
     // optimize the network
     std::vector<BackendId> backends = {Compute::CpuRef};
     IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
-    BOOST_CHECK(!optNet); // Should have failed to optimise, as flow control is not yet implemented
+    BOOST_TEST_REQUIRE(optNet.get() != nullptr);
+
+    // Only one of the operands of the addition is ever computed, so the network cannot be loaded.
+    NetworkId netId;
+    std::string errorMessage;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet), errorMessage) == Status::Failure);
+    BOOST_TEST(errorMessage.find("different branches") != std::string::npos);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
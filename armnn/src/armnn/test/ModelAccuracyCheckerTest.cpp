@@ -14,6 +14,8 @@
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
 
+#include <thread>
+
 using namespace armnnUtils;
 
 struct TestHelper {
@@ -95,4 +97,47 @@ BOOST_FIXTURE_TEST_CASE(TestFloat32OutputTensorAccuracy, TestHelper)
     BOOST_CHECK(totalAccuracy == 100.0f);
 }
 
+BOOST_FIXTURE_TEST_CASE(TestConcurrentResultsAreAllCounted, TestHelper)
+{
+    ModelAccuracyChecker checker(GetValidationLabelSet());
+
+    // The label of image 4 is class 6. Each thread adds it ranked first, then ranked eleventh, which is outside
+    // the Top 10 and so never counted.
+    std::vector<float> rankedFirst(1001, 0.0f);
+    rankedFirst[6] = 0.9f;
+    rankedFirst[100] = 0.1f;
+    std::vector<float> rankedEleventh(1001, 0.0f);
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        rankedEleventh[200 + i] = 0.5f;
+    }
+    rankedEleventh[6] = 0.4f;
+
+    const std::vector<TContainer> outputFirst = { TContainer(rankedFirst) };
+    const std::vector<TContainer> outputEleventh = { TContainer(rankedEleventh) };
+
+    constexpr unsigned int numThreads = 4;
+    constexpr unsigned int imagesPerThread = 50;
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&]()
+        {
+            for (unsigned int i = 0; i < imagesPerThread; ++i)
+            {
+                checker.AddImageResult<TContainer>("ILSVRC2012_val_00000004.JPEG", outputFirst);
+                checker.AddImageResult<TContainer>("ILSVRC2012_val_00000004.JPEG", outputEleventh);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    BOOST_CHECK(checker.GetImagesProcessed() == 2 * numThreads * imagesPerThread);
+    BOOST_CHECK(checker.GetAccuracy(1) == 50.0f);
+    BOOST_CHECK(checker.GetAccuracy(10) == 50.0f);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
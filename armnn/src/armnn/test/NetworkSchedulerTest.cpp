@@ -0,0 +1,198 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <boost/test/unit_test.hpp>
+
+#include <NetworkScheduler.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace armnn;
+
+namespace
+{
+
+/// A job that blocks its worker until released, so that tests control when contention starts.
+class Gate
+{
+public:
+    Status Wait()
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Entered = true;
+        m_Condition.notify_all();
+        m_Condition.wait(lock, [this]() { return m_Open; });
+        return Status::Success;
+    }
+
+    /// Blocks until a worker is inside Wait().
+    void WaitUntilEntered()
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Condition.wait(lock, [this]() { return m_Entered; });
+    }
+
+    void Open()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Open = true;
+        }
+        m_Condition.notify_all();
+    }
+
+private:
+    std::mutex              m_Mutex;
+    std::condition_variable m_Condition;
+    bool                    m_Entered = false;
+    bool                    m_Open = false;
+};
+
+void WaitForQueueDepth(const NetworkScheduler& scheduler, NetworkId networkId, unsigned int depth)
+{
+    while (scheduler.GetCounters(networkId).m_QueueDepth < depth)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(NetworkSchedulerTests)
+
+BOOST_AUTO_TEST_CASE(SchedulerRejectsInvalidOptions)
+{
+    NetworkScheduler scheduler(1, false);
+    scheduler.AddNetwork(0);
+
+    NetworkSchedulingOptions options;
+    options.m_Priority = 0;
+    BOOST_CHECK_THROW(scheduler.SetNetworkOptions(0, options), InvalidArgumentException);
+
+    // Unknown networks.
+    BOOST_CHECK_THROW(scheduler.SetNetworkOptions(1, NetworkSchedulingOptions()), InvalidArgumentException);
+    BOOST_TEST(scheduler.Run(1, []() { return Status::Success; }) == Status::Failure);
+
+    scheduler.RemoveNetwork(0);
+    BOOST_TEST(scheduler.Run(0, []() { return Status::Success; }) == Status::Failure);
+}
+
+BOOST_AUTO_TEST_CASE(SchedulerKeepsNetworkOnItsCoreBudget)
+{
+    const unsigned int numWorkers = 3;
+    const unsigned int numCallers = 6;
+    const unsigned int numRequestsPerCaller = 20;
+
+    NetworkScheduler scheduler(numWorkers, false);
+    scheduler.AddNetwork(0);
+    scheduler.AddNetwork(1);
+
+    NetworkSchedulingOptions budgeted;
+    budgeted.m_CoreBudget = 1;
+    scheduler.SetNetworkOptions(0, budgeted);
+
+    std::mutex mutex;
+    std::set<std::thread::id> budgetedWorkers;
+    std::set<std::thread::id> unbudgetedWorkers;
+
+    std::vector<std::thread> callers;
+    for (unsigned int i = 0; i < numCallers; ++i)
+    {
+        const NetworkId networkId = i % 2;
+        std::set<std::thread::id>& workers = networkId == 0 ? budgetedWorkers : unbudgetedWorkers;
+        callers.emplace_back([&, networkId]()
+        {
+            for (unsigned int r = 0; r < numRequestsPerCaller; ++r)
+            {
+                scheduler.Run(networkId, [&]()
+                {
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+                    std::lock_guard<std::mutex> lock(mutex);
+                    workers.insert(std::this_thread::get_id());
+                    return Status::Success;
+                });
+            }
+        });
+    }
+    for (std::thread& caller : callers)
+    {
+        caller.join();
+    }
+
+    BOOST_TEST(budgetedWorkers.size() == 1u);
+    BOOST_TEST(unbudgetedWorkers.size() <= numWorkers);
+    BOOST_TEST(scheduler.GetCounters(0).m_CompletedRequests == numCallers / 2 * numRequestsPerCaller);
+    BOOST_TEST(scheduler.GetCounters(1).m_CompletedRequests == numCallers / 2 * numRequestsPerCaller);
+}
+
+BOOST_AUTO_TEST_CASE(SchedulerSharesWorkerTimeByPriority)
+{
+    // One worker, held by a blocking job on network 2 until networks 0 and 1 both have a full queue. From then on
+    // every request takes the same time, so the order in which the worker serves the queues is decided by the
+    // priorities alone: network 0 (priority 3) should get three requests for each one of network 1 (priority 1).
+    const unsigned int numRequests = 8;
+
+    NetworkScheduler scheduler(1, false);
+    for (NetworkId networkId : { 0, 1, 2 })
+    {
+        scheduler.AddNetwork(networkId);
+    }
+
+    NetworkSchedulingOptions highPriority;
+    highPriority.m_Priority = 3;
+    scheduler.SetNetworkOptions(0, highPriority);
+
+    Gate gate;
+    std::thread blocker([&]() { scheduler.Run(2, [&gate]() { return gate.Wait(); }); });
+    gate.WaitUntilEntered();
+
+    std::mutex mutex;
+    std::vector<NetworkId> executionOrder;
+
+    std::vector<std::thread> callers;
+    for (NetworkId networkId : { 0, 1 })
+    {
+        for (unsigned int i = 0; i < numRequests; ++i)
+        {
+            callers.emplace_back([&, networkId]()
+            {
+                scheduler.Run(networkId, [&, networkId]()
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                    std::lock_guard<std::mutex> lock(mutex);
+                    executionOrder.push_back(networkId);
+                    return Status::Success;
+                });
+            });
+        }
+    }
+    WaitForQueueDepth(scheduler, 0, numRequests);
+    WaitForQueueDepth(scheduler, 1, numRequests);
+
+    gate.Open();
+    blocker.join();
+    for (std::thread& caller : callers)
+    {
+        caller.join();
+    }
+
+    BOOST_REQUIRE(executionOrder.size() == 2 * numRequests);
+
+    // While both networks are backlogged, the high priority network gets about three quarters of the worker time.
+    // The exact split would be 6 of the first 8; allow one for timer jitter in the measured execution times.
+    const auto highPriorityShare = std::count(executionOrder.begin(), executionOrder.begin() + numRequests, 0);
+    BOOST_TEST(highPriorityShare >= 5);
+    BOOST_TEST(highPriorityShare <= 7);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,8 +6,10 @@
 
 #include <armnn/ArmNN.hpp>
 #include <Graph.hpp>
+#include <LayerSupportCache.hpp>
 #include <Optimizer.hpp>
 #include <backendsCommon/CpuTensorHandle.hpp>
+#include <backendsCommon/WorkloadFactory.hpp>
 #include <FloatingPointConverter.hpp>
 
 namespace
@@ -1174,4 +1176,193 @@ BOOST_AUTO_TEST_CASE(FoldPadLayerIntoConvolution2dLayer)
         &IsLayerOfType<armnn::OutputLayer>));
 }
 
+BOOST_AUTO_TEST_CASE(FoldPermutesIntoPooling2dDataLayout)
+{
+    Graph graph;
+    const TensorInfo inputInfo({ 1, 4, 6, 3 }, DataType::Float32);
+    const TensorInfo nchwInputInfo({ 1, 3, 4, 6 }, DataType::Float32);
+    const TensorInfo nchwOutputInfo({ 1, 3, 2, 3 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 2, 3, 3 }, DataType::Float32);
+
+    Pooling2dDescriptor poolingDescriptor;
+    poolingDescriptor.m_PoolType = PoolingAlgorithm::Max;
+    poolingDescriptor.m_PoolWidth = 2;
+    poolingDescriptor.m_PoolHeight = 2;
+    poolingDescriptor.m_StrideX = 2;
+    poolingDescriptor.m_StrideY = 2;
+    poolingDescriptor.m_DataLayout = DataLayout::NCHW;
+
+    // input (NHWC) -> permute to NCHW -> activation -> pooling (NCHW) -> permute to NHWC -> output
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+    Layer* toNchw = graph.AddLayer<PermuteLayer>(PermuteDescriptor({ 0, 2, 3, 1 }), "toNchw");
+    toNchw->GetOutputSlot().SetTensorInfo(nchwInputInfo);
+    Layer* activation = graph.AddLayer<ActivationLayer>(ActivationDescriptor(), "activation");
+    activation->GetOutputSlot().SetTensorInfo(nchwInputInfo);
+    Layer* pooling = graph.AddLayer<Pooling2dLayer>(poolingDescriptor, "pooling");
+    pooling->GetOutputSlot().SetTensorInfo(nchwOutputInfo);
+    Layer* toNhwc = graph.AddLayer<PermuteLayer>(PermuteDescriptor({ 0, 3, 1, 2 }), "toNhwc");
+    toNhwc->GetOutputSlot().SetTensorInfo(outputInfo);
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(toNchw->GetInputSlot(0));
+    toNchw->GetOutputSlot().Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot().Connect(pooling->GetInputSlot(0));
+    pooling->GetOutputSlot().Connect(toNhwc->GetInputSlot(0));
+    toNhwc->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FoldPermutesIntoDataLayout()));
+
+    auto checkActivation = [&inputInfo](const armnn::Layer* const layer) -> bool
+    {
+        return IsLayerOfType<armnn::ActivationLayer>(layer) &&
+               layer->GetOutputSlot(0).GetTensorInfo() == inputInfo;
+    };
+    auto checkNhwcPooling = [&outputInfo](const armnn::Layer* const layer) -> bool
+    {
+        const auto poolingLayer = static_cast<const armnn::Pooling2dLayer*>(layer);
+        return IsLayerOfType<armnn::Pooling2dLayer>(layer) &&
+               (layer->GetNameStr() == "pooling") &&
+               (poolingLayer->GetParameters().m_DataLayout == DataLayout::NHWC) &&
+               (poolingLayer->GetParameters().m_PoolType == PoolingAlgorithm::Max) &&
+               layer->GetOutputSlot(0).GetTensorInfo() == outputInfo;
+    };
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+                             graph.cend(),
+                             &IsLayerOfType<armnn::InputLayer>,
+                             checkActivation,
+                             checkNhwcPooling,
+                             &IsLayerOfType<armnn::OutputLayer>));
+    BOOST_CHECK_NO_THROW(graph.InferTensorInfos());
+}
+
+BOOST_AUTO_TEST_CASE(FoldPermutesIntoDataLayoutKeepsMismatchedPermutes)
+{
+    Graph graph;
+    const TensorInfo inputInfo({ 1, 4, 6, 3 }, DataType::Float32);
+    const TensorInfo nchwInfo({ 1, 3, 4, 6 }, DataType::Float32);
+
+    // The pooling layer is already NHWC, so running it on the permuted data is not the same as dropping the permutes.
+    Pooling2dDescriptor poolingDescriptor;
+    poolingDescriptor.m_PoolWidth = 1;
+    poolingDescriptor.m_PoolHeight = 1;
+    poolingDescriptor.m_StrideX = 1;
+    poolingDescriptor.m_StrideY = 1;
+    poolingDescriptor.m_DataLayout = DataLayout::NHWC;
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+    Layer* toNchw = graph.AddLayer<PermuteLayer>(PermuteDescriptor({ 0, 2, 3, 1 }), "toNchw");
+    toNchw->GetOutputSlot().SetTensorInfo(nchwInfo);
+    Layer* pooling = graph.AddLayer<Pooling2dLayer>(poolingDescriptor, "pooling");
+    pooling->GetOutputSlot().SetTensorInfo(nchwInfo);
+    Layer* toNhwc = graph.AddLayer<PermuteLayer>(PermuteDescriptor({ 0, 3, 1, 2 }), "toNhwc");
+    toNhwc->GetOutputSlot().SetTensorInfo(inputInfo);
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(toNchw->GetInputSlot(0));
+    toNchw->GetOutputSlot().Connect(pooling->GetInputSlot(0));
+    pooling->GetOutputSlot().Connect(toNhwc->GetInputSlot(0));
+    toNhwc->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FoldPermutesIntoDataLayout()));
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+                             graph.cend(),
+                             &IsLayerOfType<armnn::InputLayer>,
+                             &IsLayerOfType<armnn::PermuteLayer>,
+                             &IsLayerOfType<armnn::Pooling2dLayer>,
+                             &IsLayerOfType<armnn::PermuteLayer>,
+                             &IsLayerOfType<armnn::OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(FoldPermuteIntoConstantLayer)
+{
+    Graph graph;
+    const TensorInfo constantInfo({ 2, 3 }, DataType::Float32);
+    const TensorInfo permutedInfo({ 3, 2 }, DataType::Float32);
+
+    const std::vector<float> constantData = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+    ConstantLayer* constant = graph.AddLayer<ConstantLayer>("constant");
+    constant->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(constantInfo, constantData));
+    constant->GetOutputSlot().SetTensorInfo(constantInfo);
+    Layer* permute = graph.AddLayer<PermuteLayer>(PermuteDescriptor({ 1, 0 }), "permute");
+    permute->GetOutputSlot().SetTensorInfo(permutedInfo);
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    constant->GetOutputSlot().Connect(permute->GetInputSlot(0));
+    permute->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FoldPermuteIntoConstant()));
+
+    auto checkFoldedConstant = [&permutedInfo](const armnn::Layer* const layer) -> bool
+    {
+        const auto constantLayer = static_cast<const armnn::ConstantLayer*>(layer);
+        if (!IsLayerOfType<armnn::ConstantLayer>(layer) ||
+            layer->GetNameStr() != "folded-permute-into-constant" ||
+            layer->GetOutputSlot(0).GetTensorInfo() != permutedInfo ||
+            constantLayer->m_LayerOutput->GetTensorInfo() != permutedInfo)
+        {
+            return false;
+        }
+        const float* data = constantLayer->m_LayerOutput->GetConstTensor<float>();
+        const std::vector<float> expected = { 0.0f, 3.0f, 1.0f, 4.0f, 2.0f, 5.0f };
+        return std::equal(expected.begin(), expected.end(), data);
+    };
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+                             graph.cend(),
+                             checkFoldedConstant,
+                             &IsLayerOfType<armnn::OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(LayerSupportCacheAnswersRepeatedLayers)
+{
+    Graph graph;
+    const TensorInfo info({ 1, 8 }, DataType::Float32);
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(info);
+
+    // Three identical activations, then one with a different function.
+    ActivationDescriptor sigmoid;
+    sigmoid.m_Function = ActivationFunction::Sigmoid;
+    ActivationDescriptor boundedReLu;
+    boundedReLu.m_Function = ActivationFunction::BoundedReLu;
+    boundedReLu.m_A = 6.0f;
+
+    std::vector<Layer*> activations;
+    Layer* previous = input;
+    for (const ActivationDescriptor& descriptor : { sigmoid, sigmoid, sigmoid, boundedReLu })
+    {
+        Layer* activation = graph.AddLayer<ActivationLayer>(descriptor, "activation");
+        activation->GetOutputSlot().SetTensorInfo(info);
+        activation->SetBackendId(Compute::CpuRef);
+        previous->GetOutputSlot().Connect(activation->GetInputSlot(0));
+        activations.push_back(activation);
+        previous = activation;
+    }
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+    previous->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    LayerSupportCache cache;
+    for (Optional<DataType> dataType : { Optional<DataType>(), Optional<DataType>(DataType::Signed32) })
+    {
+        for (Layer* activation : activations)
+        {
+            std::string cachedReason;
+            std::string expectedReason;
+            const bool cached = cache.IsLayerSupported(*activation, dataType, cachedReason);
+            const bool expected = IWorkloadFactory::IsLayerSupported(*activation, dataType, expectedReason);
+            BOOST_TEST(cached == expected);
+            BOOST_TEST(cachedReason == (expected ? std::string() : expectedReason));
+        }
+    }
+
+    // Two of the sigmoids are answered from the cache, for each data type.
+    BOOST_TEST(cache.GetNumCacheHits() == 4);
+    BOOST_TEST(&cache.GetBackend(Compute::CpuRef) == &cache.GetBackend(Compute::CpuRef));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
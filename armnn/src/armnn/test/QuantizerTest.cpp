@@ -11,14 +11,17 @@
 #include "armnn/LayerVisitorBase.hpp"
 #include "../Graph.hpp"
 #include "../Network.hpp"
+#include "../NetworkQuantizer.hpp"
 #include "../NetworkQuantizerUtils.hpp"
 #include "../OverrideInputRangeVisitor.hpp"
 #include "../RangeTracker.hpp"
 #include "../backends/backendsCommon/test/QuantizeHelper.hpp"
+#include "../../armnnUtils/TensorUtils.hpp"
 #include "../../armnnQuantizer/CommandLineProcessor.hpp"
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <unordered_map>
 
 namespace armnn
@@ -238,6 +241,75 @@ TensorInfo GetInputTensorInfo(const Network* network)
     throw InvalidArgumentException("Network has no input layers");
 }
 
+BOOST_AUTO_TEST_CASE(FindMinMaxScansEveryElement)
+{
+    // Lengths either side of the 8 lanes of the vectorized loop, with the extremes in the tail and in the lanes
+    for (unsigned int numElements : { 1u, 7u, 8u, 9u, 37u })
+    {
+        std::vector<float> data(numElements, 0.5f);
+        data[numElements / 2] = -4.0f;
+        data[numElements - 1] = 3.0f;
+        const MinMaxRange minMax = armnnUtils::FindMinMax(data.data(), numElements);
+        BOOST_TEST(minMax.first == *std::min_element(data.begin(), data.end()));
+        BOOST_TEST(minMax.second == *std::max_element(data.begin(), data.end()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RefineBatchMatchesSequentialRefine)
+{
+    const std::vector<std::vector<float>> inputData =
+    {
+        { 0, 0, 0, -56, 98, 0, 0, 0 },
+        { 0, -77, 0, -56, 65, 0, 0, 0 },
+        { 1, 2, 3, 4, 5, 6, 7, 8 },
+        { -3, 0, 0, 0, 0, 0, 0, 120 },
+        { 0, 0, 0, 0, 0, 0, 0, 0 }
+    };
+
+    auto getInputRange = [&inputData](unsigned int numCalibrationThreads, bool batched)
+    {
+        INetworkPtr network = CreateNetworkWithInputOutputLayers();
+        const Network* networkPtr = boost::polymorphic_downcast<const Network*>(network.get());
+        const TensorInfo tensorInfo = GetInputTensorInfo(networkPtr);
+        const LayerGuid inputGuid = (*networkPtr->GetGraph().GetInputLayers().begin())->GetGuid();
+
+        std::vector<InputTensors> inputTensorsBatch;
+        for (const std::vector<float>& data : inputData)
+        {
+            inputTensorsBatch.push_back({ std::make_pair(0, ConstTensor(tensorInfo, data.data())) });
+        }
+
+        QuantizerOptions options;
+        options.m_NumCalibrationThreads = numCalibrationThreads;
+        NetworkQuantizer quantizer(network.get(), options);
+        if (batched)
+        {
+            // Split in two, to check the ranges of later batches refine those of the first
+            quantizer.RefineBatch({ inputTensorsBatch.begin() + 2, inputTensorsBatch.end() });
+            quantizer.RefineBatch({ inputTensorsBatch.begin(), inputTensorsBatch.begin() + 2 });
+        }
+        else
+        {
+            for (const InputTensors& inputTensors : inputTensorsBatch)
+            {
+                quantizer.Refine(inputTensors);
+            }
+        }
+        return quantizer.GetMinMaxRange(inputGuid, 0);
+    };
+
+    const MinMaxRange expectedRange = getInputRange(1, false);
+    BOOST_TEST(expectedRange.first == -77.0f);
+    BOOST_TEST(expectedRange.second == 120.0f);
+
+    for (unsigned int numCalibrationThreads : { 1u, 2u, 3u, 0u })
+    {
+        const MinMaxRange range = getInputRange(numCalibrationThreads, true);
+        BOOST_TEST(range.first == expectedRange.first);
+        BOOST_TEST(range.second == expectedRange.second);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(InputOutputLayerDynamicQuant)
 {
     INetworkPtr network = CreateNetworkWithInputOutputLayers();
@@ -18,6 +18,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
+#include <thread>
+
 namespace armnn
 {
 
@@ -284,4 +287,119 @@ BOOST_AUTO_TEST_CASE(IVGCVSW_1929_QuantizedSoftmaxIssue)
     BOOST_TEST(!optNet);
 }
 
+namespace
+{
+
+armnn::IOptimizedNetworkPtr CreateSchedulerTestNetwork(armnn::IRuntime& runtime)
+{
+    using namespace armnn;
+
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = ActivationFunction::ReLu;
+    IConnectableLayer* relu = net->AddActivationLayer(descriptor);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 4 }, DataType::Float32));
+    relu->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 4 }, DataType::Float32));
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    return Optimize(*net, backends, runtime.GetDeviceSpec());
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(RuntimeSchedulerRunsSharedNetworks)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    options.m_NumSchedulerThreads = 2;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    const unsigned int numNetworks = 3;
+    std::vector<NetworkId> networkIds(numNetworks);
+    for (unsigned int i = 0; i < numNetworks; ++i)
+    {
+        BOOST_TEST(runtime->LoadNetwork(networkIds[i], CreateSchedulerTestNetwork(*runtime)) == Status::Success);
+    }
+
+    NetworkSchedulingOptions schedulingOptions;
+    schedulingOptions.m_Priority = 2;
+    schedulingOptions.m_CoreBudget = 1;
+    BOOST_TEST(runtime->SetNetworkSchedulingOptions(networkIds[0], schedulingOptions) == Status::Success);
+
+    NetworkSchedulingOptions zeroPriority;
+    zeroPriority.m_Priority = 0;
+    BOOST_TEST(runtime->SetNetworkSchedulingOptions(networkIds[1], zeroPriority) == Status::Failure);
+
+    // Every network is driven from its own caller threads; the scheduler serialises each network's requests.
+    const unsigned int requestsPerThread = 20;
+    std::atomic<unsigned int> mismatches(0);
+    std::vector<std::thread> callers;
+    for (unsigned int i = 0; i < numNetworks * 2; ++i)
+    {
+        callers.emplace_back([&, i]()
+        {
+            const NetworkId networkId = networkIds[i % numNetworks];
+            for (unsigned int r = 0; r < requestsPerThread; ++r)
+            {
+                const float value = static_cast<float>(r);
+                std::vector<float> inputData{ -value, value, -1.0f, 2.0f };
+                std::vector<float> outputData(4);
+
+                InputTensors inputTensors
+                {
+                    { 0, ConstTensor(runtime->GetInputTensorInfo(networkId, 0), inputData.data()) }
+                };
+                OutputTensors outputTensors
+                {
+                    { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) }
+                };
+
+                if (runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) != Status::Success ||
+                    outputData != std::vector<float>{ 0.0f, value, 0.0f, 2.0f })
+                {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (std::thread& caller : callers)
+    {
+        caller.join();
+    }
+
+    BOOST_TEST(mismatches.load() == 0);
+    for (NetworkId networkId : networkIds)
+    {
+        NetworkSchedulingCounters counters = runtime->GetNetworkSchedulingCounters(networkId);
+        BOOST_TEST(counters.m_CompletedRequests == 2 * requestsPerThread);
+        BOOST_TEST(counters.m_QueueDepth == 0);
+        BOOST_TEST(counters.m_MaxQueueLatencyUs >= counters.m_MeanQueueLatencyUs);
+    }
+
+    BOOST_TEST(runtime->UnloadNetwork(networkIds[1]) == Status::Success);
+    BOOST_TEST(runtime->SetNetworkSchedulingOptions(networkIds[1], schedulingOptions) == Status::Failure);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeSchedulingOptionsRequireScheduler)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    NetworkId networkId;
+    BOOST_TEST(runtime->LoadNetwork(networkId, CreateSchedulerTestNetwork(*runtime)) == Status::Success);
+
+    BOOST_TEST(runtime->SetNetworkSchedulingOptions(networkId, NetworkSchedulingOptions()) == Status::Failure);
+    BOOST_TEST(runtime->GetNetworkSchedulingCounters(networkId).m_CompletedRequests == 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -11,6 +11,7 @@
 #include <armnnOnnxParser/IOnnxParser.hpp>
 #endif
 #if defined(ARMNN_SERIALIZER)
+#include <armnnDeserializer/IDeserializer.hpp>
 #include <armnnSerializer/ISerializer.hpp>
 #endif
 #if defined(ARMNN_TF_PARSER)
@@ -28,9 +29,11 @@
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/program_options.hpp>
 
+#include <chrono>
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 
 namespace
 {
@@ -119,8 +122,12 @@ int ParseCommandLineArgs(int argc, const char* argv[],
                          std::vector<std::string>& inputNames,
                          std::vector<std::string>& inputTensorShapeStrs,
                          std::vector<std::string>& outputNames,
-                         std::string& outputPath, bool& isModelBinary)
+                         std::string& outputPath, bool& isModelBinary,
+                         armnnSerializer::SerializerOptions& serializerOptions,
+                         bool& benchmarkLoad)
 {
+    std::string compression;
+
     po::options_description desc("Options");
 
     desc.add_options()
@@ -148,7 +155,15 @@ int ParseCommandLineArgs(int argc, const char* argv[],
          " This parameter is optional, depending on the network.")
         ("output-name,o", po::value<std::vector<std::string>>()->multitoken(),
          "Identifier of the output tensor in the network.")
-        ("output-path,p", po::value(&outputPath)->required(), "Path to serialize the network to.");
+        ("output-path,p", po::value(&outputPath)->required(), "Path to serialize the network to.")
+        ("compression,c", po::value(&compression)->default_value("none"),
+         "Compression of the constant tensors (weights): none, palette, run-length or smallest."
+         " Compressed tensors are decompressed when the network is deserialized.")
+        ("tensor-alignment,a", po::value(&serializerOptions.m_TensorDataAlignment)->default_value(0),
+         "Alignment in bytes, a power of two, of the uncompressed constant tensor data; e.g. 64 for a file"
+         " that is memory-mapped. 0 keeps the natural alignment.")
+        ("benchmark-load,b", po::bool_switch(&benchmarkLoad)->default_value(false),
+         "Deserializes the serialized network and reports how long that takes.");
 
     po::variables_map vm;
     try
@@ -196,6 +211,28 @@ int ParseCommandLineArgs(int argc, const char* argv[],
         return EXIT_FAILURE;
     }
 
+    if (compression == "none")
+    {
+        serializerOptions.m_TensorCompression = armnnSerializer::TensorCompression::None;
+    }
+    else if (compression == "palette")
+    {
+        serializerOptions.m_TensorCompression = armnnSerializer::TensorCompression::Palette;
+    }
+    else if (compression == "run-length")
+    {
+        serializerOptions.m_TensorCompression = armnnSerializer::TensorCompression::RunLength;
+    }
+    else if (compression == "smallest")
+    {
+        serializerOptions.m_TensorCompression = armnnSerializer::TensorCompression::Smallest;
+    }
+    else
+    {
+        BOOST_LOG_TRIVIAL(fatal) << "Unknown compression: '" << compression << "'";
+        return EXIT_FAILURE;
+    }
+
     if (!vm["input-tensor-shape"].empty())
     {
         inputTensorShapeStrs = vm["input-tensor-shape"].as<std::vector<std::string>>();
@@ -221,14 +258,16 @@ public:
                    const std::vector<armnn::TensorShape>& inputShapes,
                    const std::vector<std::string>& outputNames,
                    const std::string& outputPath,
-                   bool isModelBinary)
+                   bool isModelBinary,
+                   const armnnSerializer::SerializerOptions& serializerOptions)
     : m_NetworkPtr(armnn::INetworkPtr(nullptr, [](armnn::INetwork *){})),
     m_ModelPath(modelPath),
     m_InputNames(inputNames),
     m_InputShapes(inputShapes),
     m_OutputNames(outputNames),
     m_OutputPath(outputPath),
-    m_IsModelBinary(isModelBinary) {}
+    m_IsModelBinary(isModelBinary),
+    m_SerializerOptions(serializerOptions) {}
 
     bool Serialize()
     {
@@ -237,7 +276,7 @@ public:
             return false;
         }
 
-        auto serializer(armnnSerializer::ISerializer::Create());
+        auto serializer(armnnSerializer::ISerializer::Create(m_SerializerOptions));
 
         serializer->Serialize(*m_NetworkPtr);
 
@@ -245,9 +284,25 @@ public:
 
         bool retVal = serializer->SaveSerializedToStream(file);
 
+        BOOST_LOG_TRIVIAL(info) << "Serialized network size: " << file.tellp() << " bytes";
+
         return retVal;
     }
 
+    /// Deserializes the file written by Serialize(), as a measure of how long loading the network takes.
+    bool BenchmarkLoad() const
+    {
+        std::ifstream file(m_OutputPath, std::ios::in | std::ios::binary);
+        std::vector<uint8_t> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        const auto start = std::chrono::steady_clock::now();
+        armnn::INetworkPtr network = armnnDeserializer::IDeserializer::Create()->CreateNetworkFromBinary(content);
+        const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+        BOOST_LOG_TRIVIAL(info) << "Deserialized " << content.size() << " bytes in " << duration.count() << " ms";
+        return network.get() != nullptr;
+    }
+
     template <typename IParser>
     bool CreateNetwork ()
     {
@@ -262,6 +317,7 @@ private:
     std::vector<std::string>        m_OutputNames;
     std::string                     m_OutputPath;
     bool                            m_IsModelBinary;
+    armnnSerializer::SerializerOptions m_SerializerOptions;
 
     template <typename IParser>
     bool CreateNetwork (ParserType<IParser>)
@@ -394,8 +450,12 @@ int main(int argc, const char* argv[])
 
     bool isModelBinary = true;
 
+    armnnSerializer::SerializerOptions serializerOptions;
+    bool benchmarkLoad = false;
+
     if (ParseCommandLineArgs(
-        argc, argv, modelFormat, modelPath, inputNames, inputTensorShapeStrs, outputNames, outputPath, isModelBinary)
+        argc, argv, modelFormat, modelPath, inputNames, inputTensorShapeStrs, outputNames, outputPath, isModelBinary,
+        serializerOptions, benchmarkLoad)
         != EXIT_SUCCESS)
     {
         return EXIT_FAILURE;
@@ -420,7 +480,8 @@ int main(int argc, const char* argv[])
         }
     }
 
-    ArmnnConverter converter(modelPath, inputNames, inputTensorShapes, outputNames, outputPath, isModelBinary);
+    ArmnnConverter converter(modelPath, inputNames, inputTensorShapes, outputNames, outputPath, isModelBinary,
+                             serializerOptions);
 
     if (modelFormat.find("caffe") != std::string::npos)
     {
@@ -493,5 +554,11 @@ int main(int argc, const char* argv[])
         return EXIT_FAILURE;
     }
 
+    if (benchmarkLoad && !converter.BenchmarkLoad())
+    {
+        BOOST_LOG_TRIVIAL(fatal) << "Failed to deserialize the serialized model";
+        return EXIT_FAILURE;
+    }
+
     return EXIT_SUCCESS;
 }
@@ -4,6 +4,7 @@
 //
 
 #include "Deserializer.hpp"
+#include "../armnnSerializer/TensorCompression.hpp"
 
 #include <armnn/ArmNN.hpp>
 #include <armnn/Exceptions.hpp>
@@ -432,7 +433,7 @@ armnn::TensorInfo ToTensorInfo(Deserializer::TensorRawPtr tensorPtr)
     return result;
 }
 
-armnn::ConstTensor ToConstTensor(Deserializer::ConstTensorRawPtr constTensorPtr)
+armnn::ConstTensor Deserializer::ToConstTensor(ConstTensorRawPtr constTensorPtr)
 {
     CHECK_CONST_TENSOR_PTR(constTensorPtr);
     armnn::TensorInfo tensorInfo = ToTensorInfo(constTensorPtr->info());
@@ -463,6 +464,49 @@ armnn::ConstTensor ToConstTensor(Deserializer::ConstTensorRawPtr constTensorPtr)
             CHECK_CONST_TENSOR_SIZE(longData->size(), tensorInfo.GetNumElements());
             return armnn::ConstTensor(tensorInfo, longData->data());
         }
+        case ConstTensorData_CompressedData:
+        {
+            auto compressedData = constTensorPtr->data_as_CompressedData();
+            if (compressedData->elementSize() != armnn::GetDataTypeSize(tensorInfo.GetDataType()) ||
+                compressedData->data() == nullptr)
+            {
+                throw ParseException(boost::str(boost::format("Invalid compressed data of %1% byte elements. %2%") %
+                                                compressedData->elementSize() %
+                                                CHECK_LOCATION().AsString()));
+            }
+
+            std::vector<uint8_t> decompressed(tensorInfo.GetNumBytes());
+            auto data = compressedData->data();
+            switch (compressedData->scheme())
+            {
+                case CompressionScheme_Palette:
+                {
+                    auto codebook = compressedData->codebook();
+                    if (codebook == nullptr)
+                    {
+                        throw ParseException(boost::str(boost::format("Palettized data without a codebook. %1%") %
+                                                        CHECK_LOCATION().AsString()));
+                    }
+                    PaletteDecode(codebook->data(), codebook->size(), data->data(), data->size(),
+                                  compressedData->indexBits(), compressedData->elementSize(),
+                                  decompressed.data(), tensorInfo.GetNumBytes());
+                    break;
+                }
+                case CompressionScheme_RunLength:
+                    RunLengthDecode(data->data(), data->size(), compressedData->elementSize(),
+                                    decompressed.data(), tensorInfo.GetNumBytes());
+                    break;
+                default:
+                    throw ParseException(boost::str(boost::format("Unsupported compression scheme %1% = %2%. %3%") %
+                                                    compressedData->scheme() %
+                                                    EnumNameCompressionScheme(compressedData->scheme()) %
+                                                    CHECK_LOCATION().AsString()));
+            }
+
+            // Moving the vector keeps its data where the returned tensor points to.
+            m_DecompressedTensorData.push_back(std::move(decompressed));
+            return armnn::ConstTensor(tensorInfo, m_DecompressedTensorData.back().data());
+        }
         default:
         {
             CheckLocation location = CHECK_LOCATION();
@@ -526,6 +570,7 @@ void Deserializer::ParseUnsupportedLayer(GraphPtr graph, unsigned int layerIndex
 void Deserializer::ResetParser()
 {
     m_Network = armnn::INetworkPtr(nullptr, nullptr);
+    m_DecompressedTensorData.clear();
     m_InputBindings.clear();
     m_OutputBindings.clear();
 }
@@ -592,6 +637,9 @@ INetworkPtr Deserializer::CreateNetworkFromGraph(GraphPtr graph)
             // lookup and call the parser function
             auto& parserFunction = m_ParserFunctions[layer->layer_type()];
             (this->*parserFunction)(graph, layerIndex);
+
+            // The layer holds its own copy of its constant tensors.
+            m_DecompressedTensorData.clear();
         }
         ++layerIndex;
     }
@@ -1987,6 +2035,7 @@ armnn::LstmDescriptor Deserializer::GetLstmDescriptor(Deserializer::LstmDescript
     desc.m_CifgEnabled = lstmDescriptor->cifgEnabled();
     desc.m_PeepholeEnabled = lstmDescriptor->peepholeEnabled();
     desc.m_ProjectionEnabled = lstmDescriptor->projectionEnabled();
+    desc.m_SequenceMode = lstmDescriptor->sequenceMode();
 
     return desc;
 }
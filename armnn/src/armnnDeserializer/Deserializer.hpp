@@ -72,6 +72,10 @@ private:
     /// Create the network from an already loaded flatbuffers graph
     armnn::INetworkPtr CreateNetworkFromGraph(GraphPtr graph);
 
+    /// Returns a view of the data of the serialized constant tensor, decompressing it first if needed. Decompressed
+    /// data is only kept until the layer being parsed has been added to the network, which copies it.
+    armnn::ConstTensor ToConstTensor(ConstTensorRawPtr constTensorPtr);
+
     // signature for the parser functions
     using LayerParsingFunction = void(Deserializer::*)(GraphPtr graph, unsigned int layerIndex);
 
@@ -133,6 +137,8 @@ private:
 
     /// The network we're building. Gets cleared after it is passed to the user
     armnn::INetworkPtr                    m_Network;
+    /// Decompressed data of the constant tensors of the layer being parsed
+    std::vector<std::vector<uint8_t>>     m_DecompressedTensorData;
     std::vector<LayerParsingFunction>     m_ParserFunctions;
 
     using NameToBindingInfo = std::pair<std::string, BindingPointInfo >;
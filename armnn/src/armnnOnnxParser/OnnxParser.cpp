@@ -13,6 +13,7 @@
 
 #include <google/protobuf/text_format.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/unknown_field_set.h>
 
 #include <numeric>
 
@@ -57,7 +58,7 @@ void ReadMandatoryNodeAttributeImpl(const onnx::NodeProto& node,
                                     onnx::AttributeProto::AttributeType expectedType,
                                     Callable callable)
 {
-  auto attribs = node.attribute();
+  const auto& attribs = node.attribute();
   int attriNum = 0;
   while (attriNum < node.attribute_size())
   {
@@ -95,7 +96,7 @@ void ReadOptionalNodeAttributeImpl(const onnx::NodeProto& node,
                                    onnx::AttributeProto::AttributeType expectedType,
                                    Callable callable)
 {
-    auto attribs = node.attribute();
+    const auto& attribs = node.attribute();
     for (int attriNum = 0; attriNum < node.attribute_size(); ++attriNum)
     {
         if (attribs.Get(attriNum).name() == attribName)
@@ -312,6 +313,137 @@ TensorInfo ComputeReshapeInfo(const onnx::TensorProto& targetShapeTensor,
     return TensorInfo(outShape, DataType::Float32);
 }
 
+// Field numbers of the external data of a TensorProto, which the onnx.proto of ONNX versions before 1.3 does not
+// define. The parser reads them by number so that it supports external data whichever onnx.proto it is built with.
+constexpr int g_ExternalDataFieldNumber = 13;
+constexpr int g_DataLocationFieldNumber = 14;
+constexpr int g_ExternalDataKeyFieldNumber = 1;
+constexpr int g_ExternalDataValueFieldNumber = 2;
+constexpr uint64_t g_DataLocationExternal = 1;
+
+struct ExternalDataFields
+{
+    ExternalDataFields() : m_IsExternal(false), m_Offset(0), m_HasLength(false), m_Length(0) { }
+
+    bool        m_IsExternal;
+    std::string m_Location;
+    uint64_t    m_Offset;
+    bool        m_HasLength;
+    uint64_t    m_Length;
+};
+
+uint64_t ParseExternalDataNumber(const std::string& key, const std::string& value)
+{
+    if (value.empty() || value.size() > 19 || value.find_first_not_of("0123456789") != std::string::npos)
+    {
+        throw ParseException(boost::str(
+            boost::format("Invalid external data %1% '%2%' %3%") % key % value % CHECK_LOCATION().AsString()));
+    }
+    return std::stoull(value);
+}
+
+void SetExternalDataEntry(ExternalDataFields& fields, const std::string& key, const std::string& value)
+{
+    if (key == "location")
+    {
+        fields.m_Location = value;
+    }
+    else if (key == "offset")
+    {
+        fields.m_Offset = ParseExternalDataNumber(key, value);
+    }
+    else if (key == "length")
+    {
+        fields.m_HasLength = true;
+        fields.m_Length = ParseExternalDataNumber(key, value);
+    }
+}
+
+/// Reads the external data fields through reflection when the onnx.proto defines them, and from the unknown fields
+/// of the message otherwise.
+ExternalDataFields ReadExternalDataFields(const onnx::TensorProto& tensor)
+{
+    using namespace google::protobuf;
+
+    ExternalDataFields fields;
+    const Descriptor* descriptor = tensor.GetDescriptor();
+    const Reflection* reflection = tensor.GetReflection();
+
+    const FieldDescriptor* locationField = descriptor->FindFieldByNumber(g_DataLocationFieldNumber);
+    if (locationField != nullptr && reflection->HasField(tensor, locationField))
+    {
+        fields.m_IsExternal =
+            static_cast<uint64_t>(reflection->GetEnumValue(tensor, locationField)) == g_DataLocationExternal;
+    }
+
+    const FieldDescriptor* entriesField = descriptor->FindFieldByNumber(g_ExternalDataFieldNumber);
+    if (entriesField != nullptr)
+    {
+        for (int i = 0; i < reflection->FieldSize(tensor, entriesField); ++i)
+        {
+            const Message& entry = reflection->GetRepeatedMessage(tensor, entriesField, i);
+            const FieldDescriptor* keyField = entry.GetDescriptor()->FindFieldByNumber(g_ExternalDataKeyFieldNumber);
+            const FieldDescriptor* valueField =
+                entry.GetDescriptor()->FindFieldByNumber(g_ExternalDataValueFieldNumber);
+            SetExternalDataEntry(fields,
+                                 entry.GetReflection()->GetString(entry, keyField),
+                                 entry.GetReflection()->GetString(entry, valueField));
+        }
+    }
+
+    const UnknownFieldSet& unknownFields = reflection->GetUnknownFields(tensor);
+    for (int i = 0; i < unknownFields.field_count(); ++i)
+    {
+        const UnknownField& field = unknownFields.field(i);
+        if (field.number() == g_DataLocationFieldNumber && field.type() == UnknownField::TYPE_VARINT)
+        {
+            fields.m_IsExternal = field.varint() == g_DataLocationExternal;
+        }
+        else if (field.number() == g_ExternalDataFieldNumber && field.type() == UnknownField::TYPE_LENGTH_DELIMITED)
+        {
+            UnknownFieldSet entry;
+            if (!entry.ParseFromString(field.length_delimited()))
+            {
+                continue;
+            }
+            std::string key;
+            std::string value;
+            for (int j = 0; j < entry.field_count(); ++j)
+            {
+                const UnknownField& entryField = entry.field(j);
+                if (entryField.type() != UnknownField::TYPE_LENGTH_DELIMITED)
+                {
+                    continue;
+                }
+                if (entryField.number() == g_ExternalDataKeyFieldNumber)
+                {
+                    key = entryField.length_delimited();
+                }
+                else if (entryField.number() == g_ExternalDataValueFieldNumber)
+                {
+                    value = entryField.length_delimited();
+                }
+            }
+            SetExternalDataEntry(fields, key, value);
+        }
+    }
+    return fields;
+}
+
+bool IsExternalData(const onnx::TensorProto& tensor)
+{
+    return ReadExternalDataFields(tensor).m_IsExternal;
+}
+
+/// The locations of external data files are relative to the directory of the model file. The directory is returned
+/// with its trailing separator, and is empty for a model in the working directory.
+std::string GetModelDirectory(const char* graphFile)
+{
+    const std::string path = graphFile == nullptr ? "" : graphFile;
+    const size_t separator = path.find_last_of("/\\");
+    return separator == std::string::npos ? "" : path.substr(0, separator + 1);
+}
+
 } //namespace
 
 const std::map<std::string, OnnxParser::OperationParsingFunction> OnnxParser::m_ParserFunctions = {
@@ -403,6 +535,7 @@ void OnnxParser::ResetParser()
 {
     m_Network = armnn::INetworkPtr(nullptr, nullptr);
     m_Graph = nullptr;
+    m_ModelDirectory.clear();
 }
 
 void OnnxParser::Cleanup()
@@ -411,18 +544,79 @@ void OnnxParser::Cleanup()
     m_TensorsInfo.clear();
     m_OutputsMap.clear();
     m_OutputsFusedAndUsed.clear();
+    m_ExternalDataFiles.clear();
+
+    // The network holds its own copy of the constant tensors. Only the inputs and outputs of the graph are needed
+    // from now on, to answer the binding info queries.
+    if (m_Graph)
+    {
+        m_Graph->clear_initializer();
+        m_Graph->clear_node();
+        m_Graph->clear_value_info();
+    }
+}
+
+const void* OnnxParser::GetExternalTensorData(const std::string& name,
+                                              const onnx::TensorProto& onnxTensor,
+                                              size_t numBytes)
+{
+    const ExternalDataFields fields = ReadExternalDataFields(onnxTensor);
+    if (fields.m_Location.empty())
+    {
+        throw ParseException(boost::str(
+            boost::format("No location given for the external data of tensor '%1%' %2%")
+                          % name
+                          % CHECK_LOCATION().AsString()));
+    }
+
+    auto it = m_ExternalDataFiles.find(fields.m_Location);
+    if (it == m_ExternalDataFiles.end())
+    {
+        const std::string path = m_ModelDirectory + fields.m_Location;
+        try
+        {
+            it = m_ExternalDataFiles.emplace(fields.m_Location, std::make_unique<armnnUtils::MappedFile>(path)).first;
+        }
+        catch (const FileNotFoundException&)
+        {
+            throw ParseException(boost::str(
+                boost::format("Cannot open the external data file '%1%' of tensor '%2%' %3%")
+                              % path
+                              % name
+                              % CHECK_LOCATION().AsString()));
+        }
+    }
+    const armnnUtils::MappedFile& file = *it->second;
+
+    const uint64_t length = fields.m_HasLength ? fields.m_Length : numBytes;
+    if (length != numBytes || fields.m_Offset > file.GetSize() || file.GetSize() - fields.m_Offset < length)
+    {
+        throw ParseException(boost::str(
+            boost::format("The external data of tensor '%1%' (%2% bytes at offset %3%) does not match its %4% bytes, "
+                          "or is not within the %5% bytes of '%6%' %7%")
+                          % name
+                          % length
+                          % fields.m_Offset
+                          % numBytes
+                          % file.GetSize()
+                          % fields.m_Location
+                          % CHECK_LOCATION().AsString()));
+    }
+    return file.GetData() + fields.m_Offset;
 }
 
 std::pair<ConstTensor, std::unique_ptr<float[]>> OnnxParser::CreateConstTensor(const std::string name)
 {
     const TensorInfo tensorInfo = *m_TensorsInfo[name].m_info;
-    onnx::TensorProto onnxTensor = *m_TensorsInfo[name].m_tensor;
+    const onnx::TensorProto& onnxTensor = *m_TensorsInfo[name].m_tensor;
 
-    auto srcData = onnxTensor.float_data().data();
-    std::unique_ptr<float[]> tensorData(new float[tensorInfo.GetNumElements()]);
     const size_t tensorSizeInBytes = tensorInfo.GetNumBytes();
-    // Copy the value list entries into the destination
-    if (!onnxTensor.has_raw_data())
+    const void* srcData = nullptr;
+    if (IsExternalData(onnxTensor))
+    {
+        srcData = GetExternalTensorData(name, onnxTensor, tensorSizeInBytes);
+    }
+    else if (!onnxTensor.has_raw_data())
     {
         if(tensorInfo.GetNumElements() != static_cast<uint>(onnxTensor.float_data_size()))
         {
@@ -434,11 +628,20 @@ std::pair<ConstTensor, std::unique_ptr<float[]>> OnnxParser::CreateConstTensor(c
                           % tensorInfo.GetNumElements()
                           % CHECK_LOCATION().AsString()));
         }
-        ::memcpy(tensorData.get(), srcData, tensorSizeInBytes);
+        srcData = onnxTensor.float_data().data();
     }
     else
     {
-        ::memcpy(tensorData.get(), onnxTensor.raw_data().c_str(), tensorSizeInBytes);
+        if (onnxTensor.raw_data().size() != tensorSizeInBytes)
+        {
+            throw ParseException(boost::str(
+                boost::format("The size of the raw data provided (%1%) does not match the tensor '%2%' size (%3%) %4%")
+                              % onnxTensor.raw_data().size()
+                              % name
+                              % tensorSizeInBytes
+                              % CHECK_LOCATION().AsString()));
+        }
+        srcData = onnxTensor.raw_data().data();
     }
 
     // Const tensors requires at least a list of values
@@ -449,7 +652,18 @@ std::pair<ConstTensor, std::unique_ptr<float[]>> OnnxParser::CreateConstTensor(c
                           % name
                           % CHECK_LOCATION().AsString()));
     }
-    return std::make_pair(ConstTensor(tensorInfo, tensorData.get()), std::move(tensorData));
+
+    // The tensor references the data held by the model, or mapped from its external data file, which the network
+    // copies when the layer is added. It is only copied here when it is not aligned for floats, which can happen
+    // for raw data and external data.
+    std::unique_ptr<float[]> tensorData;
+    if (reinterpret_cast<uintptr_t>(srcData) % alignof(float) != 0)
+    {
+        tensorData.reset(new float[tensorInfo.GetNumElements()]);
+        ::memcpy(tensorData.get(), srcData, tensorSizeInBytes);
+        srcData = tensorData.get();
+    }
+    return std::make_pair(ConstTensor(tensorInfo, srcData), std::move(tensorData));
 }
 
 ModelPtr OnnxParser::LoadModelFromTextFile(const char* graphFile)
@@ -482,6 +696,7 @@ ModelPtr OnnxParser::LoadModelFromTextFile(const char* graphFile)
 INetworkPtr OnnxParser::CreateNetworkFromTextFile(const char* graphFile)
 {
     ResetParser();
+    m_ModelDirectory = GetModelDirectory(graphFile);
     ModelPtr modelProto = LoadModelFromTextFile(graphFile);
     return CreateNetworkFromModel(*modelProto);
 }
@@ -520,6 +735,7 @@ ModelPtr OnnxParser::LoadModelFromBinaryFile(const char* graphFile)
 INetworkPtr OnnxParser::CreateNetworkFromBinaryFile(const char* graphFile)
 {
     ResetParser();
+    m_ModelDirectory = GetModelDirectory(graphFile);
     ModelPtr modelProto = LoadModelFromBinaryFile(graphFile);
     return CreateNetworkFromModel(*modelProto);
 }
@@ -556,7 +772,9 @@ INetworkPtr OnnxParser::CreateNetworkFromModel(onnx::ModelProto& model)
     m_Network = INetwork::Create();
     try
     {
-        m_Graph = std::make_unique<onnx::GraphProto>(*model.mutable_graph());
+        // The graph is moved out of the model rather than copied, as it holds the data of every initializer
+        m_Graph = std::make_unique<onnx::GraphProto>();
+        m_Graph->Swap(model.mutable_graph());
         LoadGraph();
     }
     catch (const ParseException& e)
@@ -577,9 +795,9 @@ void OnnxParser::LoadGraph()
     SetupInfo(m_Graph->mutable_input());
     SetupInfo(m_Graph->mutable_value_info());
 
-    for (auto tensor : m_Graph->initializer())
+    for (const auto& tensor : m_Graph->initializer())
     {
-        m_TensorsInfo[tensor.name()].m_tensor = std::make_unique<const onnx::TensorProto>(tensor);
+        m_TensorsInfo[tensor.name()].m_tensor = &tensor;
     }
 
     SetupInputLayers();
@@ -591,7 +809,7 @@ void OnnxParser::LoadGraph()
     //Parsing the graph
     for(size_t nodeIndex = 0; nodeIndex < static_cast<size_t>(m_Graph->node_size()); nodeIndex++)
     {
-        auto node = m_Graph->node(static_cast<int>(nodeIndex));
+        const auto& node = m_Graph->node(static_cast<int>(nodeIndex));
         const std::string& operation = node.op_type();
 
         // check which layers we handled already (add and matmul fused as FC)
@@ -642,7 +860,7 @@ void OnnxParser::LoadGraph()
 
 void OnnxParser::SetupInfo(const google::protobuf::RepeatedPtrField<onnx::ValueInfoProto >* list)
 {
-    for (auto tensor : *list)
+    for (const auto& tensor : *list)
     {
         m_TensorsInfo[tensor.name()] = OnnxTensor();
         m_TensorsInfo[tensor.name()].m_info = std::make_unique<TensorInfo>(ToTensorInfo(tensor));
@@ -700,7 +918,7 @@ void OnnxParser::DetectFullyConnected()
         }
     }
 
-    for (auto output: m_Graph->output()) { //Add usages as output of the graph in count of usages
+    for (const auto& output: m_Graph->output()) { //Add usages as output of the graph in count of usages
         auto matmulIt = m_OutputsMap.find(output.name());
         if(matmulIt != m_OutputsMap.end()){
             ++m_OutputsFusedAndUsed[static_cast<size_t>(matmulIt->second.second)].inputForNodes;
@@ -867,7 +1085,7 @@ void OnnxParser::ParseConstant(const onnx::NodeProto& node)
                          static_cast<onnx::TensorProto::DataType>(onnxTensor.data_type()), onnx::TensorProto::FLOAT);
 
     //Register this as a m_ConstParam so we know we can use it as a constant param in future layers.
-    m_TensorsInfo[node.output(0)].m_tensor = std::make_unique<const onnx::TensorProto>(onnxTensor);
+    m_TensorsInfo[node.output(0)].m_tensor = &onnxTensor;
 
     CreateConstantLayer(node.output(0), node.name());
 
@@ -1047,8 +1265,7 @@ void OnnxParser::ParseReshape(const onnx::NodeProto& node)
         {
             m_TensorsInfo[node.output(0)] = OnnxTensor();
         }
-        m_TensorsInfo[node.output(0)].m_tensor =
-            std::make_unique<onnx::TensorProto>(*m_TensorsInfo[node.input(0)].m_tensor);
+        m_TensorsInfo[node.output(0)].m_tensor = m_TensorsInfo[node.input(0)].m_tensor;
     }
     else
     {
@@ -1382,7 +1599,7 @@ void OnnxParser::PrependForBroadcast(const std::string& outputName,
     }
     else //make it constant and it will be create in Add
     {
-        m_TensorsInfo[outputName].m_tensor = std::make_unique<onnx::TensorProto>(*m_TensorsInfo[input0].m_tensor);
+        m_TensorsInfo[outputName].m_tensor = m_TensorsInfo[input0].m_tensor;
 
     }
 }
@@ -1522,7 +1739,7 @@ void OnnxParser::SetupInputLayers()
     //Find user input and add their layers
     for(int inputIndex = 0; inputIndex < m_Graph->input_size(); ++inputIndex)
     {
-        auto input = m_Graph->input(inputIndex);
+        const auto& input = m_Graph->input(inputIndex);
         if (! m_TensorsInfo[input.name()].isConstant())
         {
             IConnectableLayer* layer =
@@ -1624,7 +1841,7 @@ BindingPointInfo OnnxParser::GetNetworkInputBindingInfo(const std::string& name)
 {
     for(int i = 0; i < m_Graph->input_size(); ++i)
     {
-        auto input = m_Graph->input(i);
+        const auto& input = m_Graph->input(i);
         if(input.name() == name)
         {
             return std::make_pair(static_cast<armnn::LayerBindingId>(i), ToTensorInfo(input));
@@ -1638,7 +1855,7 @@ BindingPointInfo OnnxParser::GetNetworkOutputBindingInfo(const std::string& name
 {
     for(int i = 0; i < m_Graph->output_size(); ++i)
     {
-        auto output = m_Graph->output(i);
+        const auto& output = m_Graph->output(i);
         if(output.name() == name)
         {
             return std::make_pair(static_cast<armnn::LayerBindingId>(i), ToTensorInfo(output));
@@ -1658,11 +1875,11 @@ std::vector<std::string> OnnxParser::GetInputs(ModelPtr& model)
 
     std::vector<std::string> inputNames;
     std::map<std::string, bool> isConstant;
-    for(auto tensor : model->graph().initializer())
+    for(const auto& tensor : model->graph().initializer())
     {
         isConstant[tensor.name()] = true;
     }
-    for(auto input : model->graph().input())
+    for(const auto& input : model->graph().input())
     {
         auto it = isConstant.find(input.name());
         if(it == isConstant.end())
@@ -1682,7 +1899,7 @@ std::vector<std::string> OnnxParser::GetOutputs(ModelPtr& model)
     }
 
     std::vector<std::string> outputNames;
-    for(auto output : model->graph().output())
+    for(const auto& output : model->graph().output())
     {
         outputNames.push_back(output.name());
     }
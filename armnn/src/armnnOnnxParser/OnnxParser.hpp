@@ -6,6 +6,7 @@
 
 #include "armnnOnnxParser/IOnnxParser.hpp"
 #include "google/protobuf/repeated_field.h"
+#include <MappedFile.hpp>
 #include <unordered_map>
 
 #include <onnx/onnx.pb.h>
@@ -120,8 +121,13 @@ private:
     void ResetParser();
     void Cleanup();
 
+    /// The tensor references the data of the model where possible. The data is only copied, into the returned
+    /// buffer, when it is not suitably aligned.
     std::pair<armnn::ConstTensor, std::unique_ptr<float[]>> CreateConstTensor(const std::string name);
 
+    /// Returns the @a numBytes of data of a tensor stored in an external data file, which is mapped the first time.
+    const void* GetExternalTensorData(const std::string& name, const onnx::TensorProto& onnxTensor, size_t numBytes);
+
     template <typename TypeList, typename Location>
     void ValidateInputs(const onnx::NodeProto& node,
                         TypeList validInputs,
@@ -133,11 +139,18 @@ private:
     ///Ptr to the graph we're building the network from
     GraphPtr m_Graph;
 
+    /// Directory of the model file, which the locations of external data files are relative to
+    std::string m_ModelDirectory;
+
+    /// The external data files of the model, mapped while the network is built
+    std::unordered_map<std::string, std::unique_ptr<armnnUtils::MappedFile>> m_ExternalDataFiles;
+
     ///Map of the information for every tensor
     struct OnnxTensor
     {
         std::unique_ptr<armnn::TensorInfo>          m_info;
-        std::unique_ptr<const onnx::TensorProto>    m_tensor;
+        /// Points to the tensor in m_Graph, for constant tensors
+        const onnx::TensorProto*                    m_tensor;
         onnx::TensorProto::DataType                 m_dtype;
 
         OnnxTensor() : m_info(nullptr), m_tensor(nullptr), m_dtype(onnx::TensorProto::FLOAT) { }
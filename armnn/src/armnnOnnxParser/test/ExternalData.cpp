@@ -0,0 +1,213 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../OnnxParser.hpp"
+#include  "ParserPrototxtFixture.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <utility>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(OnnxParser)
+
+namespace
+{
+
+void AppendVarint(std::string& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void AppendVarintField(std::string& out, uint32_t fieldNumber, uint64_t value)
+{
+    AppendVarint(out, fieldNumber << 3);
+    AppendVarint(out, value);
+}
+
+void AppendBytesField(std::string& out, uint32_t fieldNumber, const std::string& bytes)
+{
+    AppendVarint(out, (fieldNumber << 3) | 2);
+    AppendVarint(out, bytes.size());
+    out += bytes;
+}
+
+} // anonymous namespace
+
+struct ExternalDataFixture : public armnnUtils::ParserPrototxtFixture<armnnOnnxParser::IOnnxParser>
+{
+    ExternalDataFixture()
+        : m_Directory(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%"))
+    {
+        boost::filesystem::create_directories(m_Directory);
+
+        // The data of the "Weight" initializer is added by SetupWithExternalData().
+        m_Prototext = R"(
+                   ir_version: 3
+                   producer_name:  "CNTK"
+                   producer_version:  "2.5.1"
+                   domain:  "ai.cntk"
+                   model_version: 1
+                   graph {
+                     name:  "CNTKGraph"
+                     input {
+                        name: "Input"
+                        type {
+                          tensor_type {
+                            elem_type: 1
+                            shape {
+                              dim {
+                                dim_value: 1
+                              }
+                              dim {
+                                dim_value: 4
+                              }
+                            }
+                          }
+                        }
+                      }
+                      input {
+                         name: "Weight"
+                         type {
+                           tensor_type {
+                             elem_type: 1
+                             shape {
+                               dim {
+                                 dim_value: 1
+                               }
+                               dim {
+                                 dim_value: 4
+                               }
+                             }
+                           }
+                         }
+                       }
+                       node {
+                            input: "Input"
+                            input: "Weight"
+                            output: "Output"
+                            name: "addition"
+                            op_type: "Add"
+                            doc_string: ""
+                            domain: ""
+                          }
+                          output {
+                              name: "Output"
+                              type {
+                                 tensor_type {
+                                   elem_type: 1
+                                   shape {
+                                       dim {
+                                           dim_value: 1
+                                       }
+                                       dim {
+                                           dim_value: 4
+                                       }
+                                   }
+                                }
+                            }
+                        }
+                    }
+                   opset_import {
+                      version: 7
+                    })";
+    }
+
+    ~ExternalDataFixture()
+    {
+        boost::filesystem::remove_all(m_Directory);
+    }
+
+    /// Writes the weights to "weights.bin", after @a offset bytes of padding.
+    void WriteWeights(size_t offset)
+    {
+        const std::vector<float> weights = { 10.0f, 20.0f, 30.0f, 40.0f };
+        const std::string padding(offset, '\0');
+        std::ofstream file((m_Directory / "weights.bin").string(), std::ios::binary);
+        file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+        file.write(reinterpret_cast<const char*>(weights.data()),
+                   static_cast<std::streamsize>(weights.size() * sizeof(float)));
+    }
+
+    /// Writes the model, with the "Weight" initializer stored in an external data file described by @a externalData,
+    /// and parses it from its file.
+    void SetupWithExternalData(const std::vector<std::pair<std::string, std::string>>& externalData)
+    {
+        // The onnx.proto the parser is built with may not define the external data fields, so the initializer is
+        // encoded by hand. It is added to the graph of the model as concatenated messages are merged.
+        std::string initializer;
+        AppendVarintField(initializer, 1, 1); // dims
+        AppendVarintField(initializer, 1, 4); // dims
+        AppendVarintField(initializer, 2, onnx::TensorProto::FLOAT); // data_type
+        AppendBytesField(initializer, 8, "Weight"); // name
+        for (const auto& entry : externalData)
+        {
+            std::string entryBytes;
+            AppendBytesField(entryBytes, 1, entry.first); // key
+            AppendBytesField(entryBytes, 2, entry.second); // value
+            AppendBytesField(initializer, 13, entryBytes); // external_data
+        }
+        AppendVarintField(initializer, 14, 1); // data_location: EXTERNAL
+
+        std::string graph;
+        AppendBytesField(graph, 5, initializer); // initializer
+
+        std::string model;
+        armnnOnnxParser::OnnxParser::LoadModelFromString(m_Prototext)->SerializeToString(&model);
+        AppendBytesField(model, 7, graph); // graph
+
+        const std::string modelPath = (m_Directory / "model.onnx").string();
+        std::ofstream(modelPath, std::ios::binary) << model;
+
+        std::string errorMessage;
+        armnn::INetworkPtr network = m_Parser->CreateNetworkFromBinaryFile(modelPath.c_str());
+        auto optimized = Optimize(*network, { armnn::Compute::CpuRef }, m_Runtime->GetDeviceSpec());
+        armnn::Status ret = m_Runtime->LoadNetwork(m_NetworkIdentifier, move(optimized), errorMessage);
+        if (ret != armnn::Status::Success)
+        {
+            throw armnn::Exception(boost::str(
+                boost::format("LoadNetwork failed with error: '%1%' %2%")
+                                % errorMessage
+                                % CHECK_LOCATION().AsString()));
+        }
+    }
+
+    boost::filesystem::path m_Directory;
+};
+
+BOOST_FIXTURE_TEST_CASE(ExternalData, ExternalDataFixture)
+{
+    WriteWeights(0);
+    SetupWithExternalData({ { "location", "weights.bin" } });
+    RunTest<2>({{"Input", { 1.0f, 2.0f, 3.0f, 4.0f }}}, {{"Output", { 11.0f, 22.0f, 33.0f, 44.0f }}});
+}
+
+BOOST_FIXTURE_TEST_CASE(UnalignedExternalData, ExternalDataFixture)
+{
+    WriteWeights(3);
+    SetupWithExternalData({ { "location", "weights.bin" }, { "offset", "3" }, { "length", "16" } });
+    RunTest<2>({{"Input", { 1.0f, 2.0f, 3.0f, 4.0f }}}, {{"Output", { 11.0f, 22.0f, 33.0f, 44.0f }}});
+}
+
+BOOST_FIXTURE_TEST_CASE(ExternalDataOutOfRange, ExternalDataFixture)
+{
+    WriteWeights(0);
+    BOOST_CHECK_THROW(SetupWithExternalData({ { "location", "weights.bin" }, { "offset", "4" } }),
+                      armnn::ParseException);
+}
+
+BOOST_FIXTURE_TEST_CASE(MissingExternalDataFile, ExternalDataFixture)
+{
+    BOOST_CHECK_THROW(SetupWithExternalData({ { "location", "weights.bin" } }), armnn::ParseException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
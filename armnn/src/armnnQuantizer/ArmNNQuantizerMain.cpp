@@ -11,6 +11,7 @@
 #include "QuantizationInput.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 
@@ -41,6 +42,7 @@ int main(int argc, char* argv[])
                                           : armnn::DataType::QuantisedAsymm8;
 
     quantizerOptions.m_PreserveType = cmdline.HasPreservedDataType();
+    quantizerOptions.m_NumCalibrationThreads = cmdline.GetNumThreads();
 
     armnn::INetworkPtr network = parser->CreateNetworkFromBinary(binaryContent);
     armnn::INetworkQuantizerPtr quantizer = armnn::INetworkQuantizer::Create(network.get(), quantizerOptions);
@@ -54,22 +56,45 @@ int main(int argc, char* argv[])
             armnnQuantizer::InputLayerVisitor inputLayerVisitor;
             network->Accept(inputLayerVisitor);
 
+            // Calibration inputs are read in batches, the inputs of each batch being run concurrently.
+            const size_t batchSize = 64;
+            std::vector<armnn::InputTensors> inputTensorsBatch;
+            std::vector<std::vector<float>> inputDataBatch;
+            unsigned int numCalibrationInputs = 0;
+            const auto startTime = std::chrono::steady_clock::now();
+
+            auto refineBatch = [&]()
+            {
+                quantizer->RefineBatch(inputTensorsBatch);
+                numCalibrationInputs += static_cast<unsigned int>(inputTensorsBatch.size());
+                inputTensorsBatch.clear();
+                inputDataBatch.clear();
+            };
+
             for (armnnQuantizer::QuantizationInput quantizationInput : dataSet)
             {
                 armnn::InputTensors inputTensors;
-                std::vector<std::vector<float>> inputData(quantizationInput.GetNumberOfInputs());
-                std::vector<armnn::LayerBindingId> layerBindingIds = quantizationInput.GetLayerBindingIds();
-                unsigned int count = 0;
                 for (armnn::LayerBindingId layerBindingId : quantizationInput.GetLayerBindingIds())
                 {
                     armnn::TensorInfo tensorInfo = inputLayerVisitor.GetTensorInfo(layerBindingId);
-                    inputData[count] = quantizationInput.GetDataForEntry(layerBindingId);
-                    armnn::ConstTensor inputTensor(tensorInfo, inputData[count].data());
+                    inputDataBatch.push_back(quantizationInput.GetDataForEntry(layerBindingId));
+                    armnn::ConstTensor inputTensor(tensorInfo, inputDataBatch.back().data());
                     inputTensors.push_back(std::make_pair(layerBindingId, inputTensor));
-                    count++;
                 }
-                quantizer->Refine(inputTensors);
+                inputTensorsBatch.push_back(inputTensors);
+                if (inputTensorsBatch.size() == batchSize)
+                {
+                    refineBatch();
+                }
+            }
+            if (!inputTensorsBatch.empty())
+            {
+                refineBatch();
             }
+
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTime;
+            std::cout << "Calibrated with " << numCalibrationInputs << " inputs in " << duration.count() << " s ("
+                      << numCalibrationInputs / duration.count() << " inputs/s)" << std::endl;
         }
     }
 
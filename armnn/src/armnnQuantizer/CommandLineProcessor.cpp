@@ -99,6 +99,9 @@ bool CommandLineProcessor::ProcessCommandLine(int argc, char* argv[])
                              "CSV file containing paths for RAW input tensors")
                 ("preserve-data-type,p", po::bool_switch(&m_PreserveDataType)->default_value(false),
                               "Preserve the input and output data types")
+                ("num-threads,t", po::value<unsigned int>(&m_NumThreads)->default_value(0),
+                              "Number of calibration inputs run concurrently, default value 0 (one per hardware "
+                              "thread)")
                 ("outdir,d", po::value<std::string>(&m_OutputDirectory)->required(),
                              "Directory that output file will be written to")
                 ("outfile,o", po::value<std::string>(&m_OutputFileName)->required(), "ArmNN output file name");
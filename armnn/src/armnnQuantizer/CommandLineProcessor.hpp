@@ -17,6 +17,7 @@ namespace armnnQuantizer
 // * the csv file -c <optional> detailing the paths for RAW input tensors to use for refinement
 // * the directory -d to place the output file into (must already exist and be writable)
 // * the name of the file -o the quantized ArmNN input graph will be written to (must not already exist)
+// * the number -t <optional> of calibration inputs to run concurrently
 // * LATER: the min and max overrides to be applied to the inputs
 //          specified as -i <int> (input id) -n <float> (minimum) -x <float> (maximum)
 //          multiple sets of -i, -n, -x can appear on the command line but they must match
@@ -35,6 +36,7 @@ public:
     std::string GetQuantizationScheme() {return m_QuantizationScheme;}
     QuantizationDataSet GetQuantizationDataSet() {return m_QuantizationDataSet;}
     bool HasPreservedDataType() {return m_PreserveDataType;}
+    unsigned int GetNumThreads() {return m_NumThreads;}
     bool HasQuantizationData() {return !m_QuantizationDataSet.IsEmpty();}
 
 protected:
@@ -46,6 +48,7 @@ protected:
     std::string m_QuantizationScheme;
     QuantizationDataSet m_QuantizationDataSet;
     bool m_PreserveDataType;
+    unsigned int m_NumThreads;
 };
 
 } // namespace armnnQuantizer
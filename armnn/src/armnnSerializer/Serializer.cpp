@@ -6,10 +6,12 @@
 #include "Serializer.hpp"
 
 #include "SerializerUtils.hpp"
+#include "TensorCompression.hpp"
 
 #include <armnn/ArmNN.hpp>
 
 #include <iostream>
+#include <limits>
 
 #include <ArmnnSchema_generated.h>
 
@@ -402,7 +404,8 @@ void SerializerVisitor::VisitLstmLayer(const armnn::IConnectableLayer* layer, co
         descriptor.m_ClippingThresProj,
         descriptor.m_CifgEnabled,
         descriptor.m_PeepholeEnabled,
-        descriptor.m_ProjectionEnabled);
+        descriptor.m_ProjectionEnabled,
+        descriptor.m_SequenceMode);
 
     // Get mandatory input parameters
     auto inputToForgetWeights = CreateConstTensorInfo(*params.m_InputToForgetWeights);
@@ -934,10 +937,59 @@ flatbuffers::Offset<flatbuffers::Vector<T>> SerializerVisitor::CreateDataVector(
 {
     const T* buffer = reinterpret_cast<const T*>(memory);
     std::vector<T> vector(buffer, buffer + (size / sizeof(T)));
+    if (m_Options.m_TensorDataAlignment > sizeof(T))
+    {
+        m_flatBufferBuilder.ForceVectorAlignment(vector.size(), sizeof(T), m_Options.m_TensorDataAlignment);
+    }
     auto fbVector = m_flatBufferBuilder.CreateVector(vector);
     return fbVector;
 }
 
+flatbuffers::Offset<serializer::CompressedData>
+    SerializerVisitor::CreateCompressedData(const armnn::ConstTensor& constTensor)
+{
+    const TensorCompression compression = m_Options.m_TensorCompression;
+    const unsigned int numBytes = constTensor.GetNumBytes();
+    const unsigned int elementSize = armnn::GetDataTypeSize(constTensor.GetDataType());
+
+    PaletteData palette;
+    size_t paletteBytes = std::numeric_limits<size_t>::max();
+    if ((compression == TensorCompression::Palette || compression == TensorCompression::Smallest) &&
+        PaletteEncode(constTensor.GetMemoryArea(), numBytes, elementSize, palette))
+    {
+        paletteBytes = palette.m_Codebook.size() + palette.m_Indices.size();
+    }
+
+    std::vector<uint8_t> runLength;
+    size_t runLengthBytes = std::numeric_limits<size_t>::max();
+    if (compression == TensorCompression::RunLength || compression == TensorCompression::Smallest)
+    {
+        runLength = RunLengthEncode(constTensor.GetMemoryArea(), numBytes, elementSize);
+        runLengthBytes = runLength.size();
+    }
+
+    if (std::min(paletteBytes, runLengthBytes) >= numBytes)
+    {
+        return flatbuffers::Offset<serializer::CompressedData>();
+    }
+
+    if (paletteBytes <= runLengthBytes)
+    {
+        return serializer::CreateCompressedData(m_flatBufferBuilder,
+                                                serializer::CompressionScheme::CompressionScheme_Palette,
+                                                elementSize,
+                                                m_flatBufferBuilder.CreateVector(palette.m_Codebook),
+                                                palette.m_IndexBits,
+                                                m_flatBufferBuilder.CreateVector(palette.m_Indices));
+    }
+    return serializer::CreateCompressedData(m_flatBufferBuilder,
+                                            serializer::CompressionScheme::CompressionScheme_RunLength,
+                                            elementSize,
+                                            flatbuffers::Offset<flatbuffers::Vector<uint8_t>>(),
+                                            8,
+                                            m_flatBufferBuilder.CreateVector(runLength));
+}
+
 flatbuffers::Offset<serializer::ConstTensor>
     SerializerVisitor::CreateConstTensorInfo(const armnn::ConstTensor& constTensor)
 {
@@ -959,6 +1011,19 @@ flatbuffers::Offset<serializer::ConstTensor>
                                                              tensorInfo.GetQuantizationOffset());
     flatbuffers::Offset<void> fbPayload;
 
+    flatbuffers::Offset<serializer::CompressedData> fbCompressedData;
+    if (m_Options.m_TensorCompression != TensorCompression::None)
+    {
+        fbCompressedData = CreateCompressedData(constTensor);
+    }
+    if (!fbCompressedData.IsNull())
+    {
+        return serializer::CreateConstTensor(m_flatBufferBuilder,
+                                             flatBufferTensorInfo,
+                                             serializer::ConstTensorData::ConstTensorData_CompressedData,
+                                             fbCompressedData.o);
+    }
+
     switch (tensorInfo.GetDataType())
     {
         case armnn::DataType::Float32:
@@ -1064,14 +1129,19 @@ std::vector<fb::Offset<serializer::OutputSlot>>
 }
 
 
-ISerializer* ISerializer::CreateRaw()
+ISerializer* ISerializer::CreateRaw(const SerializerOptions& options)
 {
-    return new Serializer();
+    const unsigned int alignment = options.m_TensorDataAlignment;
+    if ((alignment & (alignment - 1)) != 0)
+    {
+        throw InvalidArgumentException("The tensor data alignment must be a power of two, or 0");
+    }
+    return new Serializer(options);
 }
 
-ISerializerPtr ISerializer::Create()
+ISerializerPtr ISerializer::Create(const SerializerOptions& options)
 {
-    return ISerializerPtr(CreateRaw(), &ISerializer::Destroy);
+    return ISerializerPtr(CreateRaw(options), &ISerializer::Destroy);
 }
 
 void ISerializer::Destroy(ISerializer* serializer)
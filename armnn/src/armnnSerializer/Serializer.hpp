@@ -19,7 +19,8 @@ namespace armnnSerializer
 class SerializerVisitor : public armnn::ILayerVisitor
 {
 public:
-    SerializerVisitor() : m_layerId(0) {}
+    explicit SerializerVisitor(const SerializerOptions& options = SerializerOptions())
+        : m_Options(options), m_layerId(0) {}
     ~SerializerVisitor() {}
 
     flatbuffers::FlatBufferBuilder& GetFlatBufferBuilder()
@@ -208,6 +209,10 @@ private:
     flatbuffers::Offset<armnnSerializer::ConstTensor> CreateConstTensorInfo(
             const armnn::ConstTensor& constTensor);
 
+    /// Creates the compressed data of the armnn ConstTensor, or returns a null offset if compressing is disabled or
+    /// would not make the tensor smaller.
+    flatbuffers::Offset<armnnSerializer::CompressedData> CreateCompressedData(const armnn::ConstTensor& constTensor);
+
     template <typename T>
     flatbuffers::Offset<flatbuffers::Vector<T>> CreateDataVector(const void* memory, unsigned int size);
 
@@ -225,6 +230,9 @@ private:
     /// FlatBufferBuilder to create our layers' FlatBuffers.
     flatbuffers::FlatBufferBuilder m_flatBufferBuilder;
 
+    /// How constant tensors are stored.
+    SerializerOptions m_Options;
+
     /// AnyLayers required by the SerializedGraph.
     std::vector<flatbuffers::Offset<armnnSerializer::AnyLayer>> m_serializedLayers;
 
@@ -244,7 +252,7 @@ private:
 class Serializer : public ISerializer
 {
 public:
-    Serializer() {}
+    explicit Serializer(const SerializerOptions& options = SerializerOptions()) : m_SerializerVisitor(options) {}
     ~Serializer() {}
 
     /// Serializes the network to ArmNN SerializedGraph.
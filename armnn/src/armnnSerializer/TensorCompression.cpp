@@ -0,0 +1,242 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "TensorCompression.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+namespace armnnSerializer
+{
+
+namespace
+{
+
+// Run-length control bytes: values below g_RunControl are followed by (value + 1) literal bytes, the others by one
+// byte repeated (value - g_RunControl + g_MinRun) times.
+constexpr unsigned int g_RunControl = 128;
+constexpr unsigned int g_MinRun = 3;
+constexpr unsigned int g_MaxLiterals = g_RunControl;
+constexpr unsigned int g_MaxRun = 255 - g_RunControl + g_MinRun;
+
+void CheckElementSize(unsigned int elementSize)
+{
+    if (elementSize != 1 && elementSize != 2 && elementSize != 4 && elementSize != 8)
+    {
+        throw armnn::InvalidArgumentException(
+            boost::str(boost::format("Unsupported tensor element size %1% bytes") % elementSize));
+    }
+}
+
+uint64_t LoadElement(const uint8_t* element, unsigned int elementSize)
+{
+    uint64_t value = 0;
+    std::memcpy(&value, element, elementSize);
+    return value;
+}
+
+// Bytes are only regrouped by their position within an element when the data is made of whole elements.
+unsigned int GetShuffleStride(unsigned int numBytes, unsigned int elementSize)
+{
+    return (elementSize > 1 && numBytes % elementSize == 0) ? elementSize : 1;
+}
+
+} // anonymous namespace
+
+bool PaletteEncode(const void* data, unsigned int numBytes, unsigned int elementSize, PaletteData& outPalette)
+{
+    CheckElementSize(elementSize);
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    const unsigned int numElements = numBytes / elementSize;
+
+    std::unordered_map<uint64_t, unsigned int> codes;
+    std::vector<uint8_t> indices(numElements);
+    outPalette.m_Codebook.clear();
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        const uint8_t* element = bytes + i * elementSize;
+        auto inserted = codes.emplace(LoadElement(element, elementSize), static_cast<unsigned int>(codes.size()));
+        if (inserted.second)
+        {
+            if (codes.size() > 256)
+            {
+                return false;
+            }
+            outPalette.m_Codebook.insert(outPalette.m_Codebook.end(), element, element + elementSize);
+        }
+        indices[i] = static_cast<uint8_t>(inserted.first->second);
+    }
+
+    if (codes.size() > 16)
+    {
+        outPalette.m_IndexBits = 8;
+        outPalette.m_Indices = std::move(indices);
+        return true;
+    }
+
+    outPalette.m_IndexBits = 4;
+    outPalette.m_Indices.assign((numElements + 1) / 2, 0);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        outPalette.m_Indices[i / 2] = static_cast<uint8_t>(outPalette.m_Indices[i / 2] | (indices[i] << (4 * (i % 2))));
+    }
+    return true;
+}
+
+void PaletteDecode(const uint8_t* codebook,
+                   size_t codebookSize,
+                   const uint8_t* indices,
+                   size_t indicesSize,
+                   unsigned int indexBits,
+                   unsigned int elementSize,
+                   void* output,
+                   unsigned int numBytes)
+{
+    CheckElementSize(elementSize);
+    const size_t numElements = numBytes / elementSize;
+    const size_t numEntries = codebookSize / elementSize;
+    const size_t expectedIndicesSize = indexBits == 4 ? (numElements + 1) / 2 : numElements;
+    if ((indexBits != 4 && indexBits != 8) || codebookSize % elementSize != 0 || indicesSize != expectedIndicesSize)
+    {
+        throw armnn::ParseException(
+            boost::str(boost::format("Invalid palettized tensor data: %1% indices of %2% bits for %3% elements") %
+                       indicesSize % indexBits % numElements));
+    }
+
+    uint8_t* out = static_cast<uint8_t*>(output);
+    for (size_t i = 0; i < numElements; ++i)
+    {
+        const size_t index = indexBits == 4 ? (indices[i / 2] >> (4 * (i % 2))) & 0xF : indices[i];
+        if (index >= numEntries)
+        {
+            throw armnn::ParseException(
+                boost::str(boost::format("Invalid palettized tensor data: index %1% is out of a codebook of %2%") %
+                           index % numEntries));
+        }
+        std::memcpy(out + i * elementSize, codebook + index * elementSize, elementSize);
+    }
+}
+
+std::vector<uint8_t> RunLengthEncode(const void* data, unsigned int numBytes, unsigned int elementSize)
+{
+    CheckElementSize(elementSize);
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    const unsigned int stride = GetShuffleStride(numBytes, elementSize);
+    const unsigned int numElements = numBytes / stride;
+
+    std::vector<uint8_t> shuffled(numBytes);
+    for (unsigned int plane = 0; plane < stride; ++plane)
+    {
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            shuffled[plane * numElements + i] = bytes[i * stride + plane];
+        }
+    }
+
+    std::vector<uint8_t> encoded;
+    encoded.reserve(numBytes + numBytes / g_MaxLiterals + 1);
+    size_t literalStart = 0;
+    auto FlushLiterals = [&](size_t end)
+    {
+        while (literalStart < end)
+        {
+            const size_t count = std::min<size_t>(end - literalStart, g_MaxLiterals);
+            encoded.push_back(static_cast<uint8_t>(count - 1));
+            encoded.insert(encoded.end(), shuffled.begin() + static_cast<std::ptrdiff_t>(literalStart),
+                           shuffled.begin() + static_cast<std::ptrdiff_t>(literalStart + count));
+            literalStart += count;
+        }
+    };
+
+    size_t i = 0;
+    while (i < shuffled.size())
+    {
+        size_t run = 1;
+        while (i + run < shuffled.size() && run < g_MaxRun && shuffled[i + run] == shuffled[i])
+        {
+            ++run;
+        }
+
+        if (run < g_MinRun)
+        {
+            i += run;
+            continue;
+        }
+
+        FlushLiterals(i);
+        encoded.push_back(static_cast<uint8_t>(g_RunControl + run - g_MinRun));
+        encoded.push_back(shuffled[i]);
+        i += run;
+        literalStart = i;
+    }
+    FlushLiterals(shuffled.size());
+
+    return encoded;
+}
+
+void RunLengthDecode(const uint8_t* encoded,
+                     size_t encodedSize,
+                     unsigned int elementSize,
+                     void* output,
+                     unsigned int numBytes)
+{
+    CheckElementSize(elementSize);
+    const unsigned int stride = GetShuffleStride(numBytes, elementSize);
+    const unsigned int numElements = numBytes / stride;
+
+    auto ThrowMalformed = []()
+    {
+        throw armnn::ParseException("Invalid run-length encoded tensor data");
+    };
+
+    std::vector<uint8_t> shuffled(numBytes);
+    size_t in = 0;
+    size_t out = 0;
+    while (in < encodedSize)
+    {
+        const unsigned int control = encoded[in++];
+        if (control < g_RunControl)
+        {
+            const size_t count = control + 1;
+            if (in + count > encodedSize || out + count > shuffled.size())
+            {
+                ThrowMalformed();
+            }
+            std::memcpy(shuffled.data() + out, encoded + in, count);
+            in += count;
+            out += count;
+        }
+        else
+        {
+            const size_t count = control - g_RunControl + g_MinRun;
+            if (in >= encodedSize || out + count > shuffled.size())
+            {
+                ThrowMalformed();
+            }
+            std::memset(shuffled.data() + out, encoded[in++], count);
+            out += count;
+        }
+    }
+    if (out != shuffled.size())
+    {
+        ThrowMalformed();
+    }
+
+    uint8_t* bytes = static_cast<uint8_t*>(output);
+    for (unsigned int plane = 0; plane < stride; ++plane)
+    {
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            bytes[i * stride + plane] = shuffled[plane * numElements + i];
+        }
+    }
+}
+
+} // namespace armnnSerializer
@@ -0,0 +1,53 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace armnnSerializer
+{
+
+/// Palettized tensor data: every element is replaced by an index into a codebook of the distinct element values.
+/// Weights that were clustered during training only take a few distinct values, so they shrink to 4 or 8 bits each.
+struct PaletteData
+{
+    /// The distinct element values, elementSize bytes each.
+    std::vector<uint8_t> m_Codebook;
+    /// One index per element, packed two per byte (low nibble first) when m_IndexBits is 4.
+    std::vector<uint8_t> m_Indices;
+    unsigned int         m_IndexBits = 8;
+};
+
+/// Palettizes @a numBytes of data made of @a elementSize byte elements (1, 2, 4 or 8).
+/// @return false, leaving @a outPalette unspecified, if the data has more than 256 distinct element values.
+bool PaletteEncode(const void* data, unsigned int numBytes, unsigned int elementSize, PaletteData& outPalette);
+
+/// Expands palettized data back into @a numBytes of elements.
+/// @throws armnn::ParseException if the palette does not describe exactly that many elements.
+void PaletteDecode(const uint8_t* codebook,
+                   size_t codebookSize,
+                   const uint8_t* indices,
+                   size_t indicesSize,
+                   unsigned int indexBits,
+                   unsigned int elementSize,
+                   void* output,
+                   unsigned int numBytes);
+
+/// Losslessly compresses data made of @a elementSize byte elements. The bytes are first regrouped by their position
+/// in the element (so that e.g. the sign and exponent bytes of float weights, which vary little, become adjacent)
+/// and then run-length encoded.
+std::vector<uint8_t> RunLengthEncode(const void* data, unsigned int numBytes, unsigned int elementSize);
+
+/// Reverses RunLengthEncode() into @a numBytes of output.
+/// @throws armnn::ParseException if the encoded data is malformed or does not decode to exactly that many bytes.
+void RunLengthDecode(const uint8_t* encoded,
+                     size_t encodedSize,
+                     unsigned int elementSize,
+                     void* output,
+                     unsigned int numBytes);
+
+} // namespace armnnSerializer
@@ -129,9 +129,10 @@ armnn::INetworkPtr DeserializeNetwork(const std::string& serializerString)
     return IDeserializer::Create()->CreateNetworkFromBinary(serializerVector);
 }
 
-std::string SerializeNetwork(const armnn::INetwork& network)
+std::string SerializeNetwork(const armnn::INetwork& network,
+                             const armnnSerializer::SerializerOptions& options = armnnSerializer::SerializerOptions())
 {
-    armnnSerializer::Serializer serializer;
+    armnnSerializer::Serializer serializer(options);
     serializer.Serialize(network);
 
     std::stringstream stream;
@@ -412,6 +413,71 @@ BOOST_AUTO_TEST_CASE(SerializeConstant)
     deserializedNetwork->Accept(verifier);
 }
 
+BOOST_AUTO_TEST_CASE(SerializeCompressedConstant)
+{
+    class ConstantLayerVerifier : public LayerVerifierBase
+    {
+    public:
+        ConstantLayerVerifier(const std::string& layerName,
+                              const std::vector<armnn::TensorInfo>& inputInfos,
+                              const std::vector<armnn::TensorInfo>& outputInfos,
+                              const armnn::ConstTensor& layerInput)
+        : LayerVerifierBase(layerName, inputInfos, outputInfos)
+        , m_LayerInput(layerInput) {}
+
+        void VisitConstantLayer(const armnn::IConnectableLayer* layer,
+                                const armnn::ConstTensor& input,
+                                const char* name) override
+        {
+            VerifyNameAndConnections(layer, name);
+
+            CompareConstTensor(input, m_LayerInput);
+        }
+
+    private:
+        armnn::ConstTensor m_LayerInput;
+    };
+
+    // Weights clustered to a few distinct values, with many zeros, which both compression schemes shrink.
+    const std::string layerName("constant");
+    const armnn::TensorInfo info({ 64, 64 }, armnn::DataType::Float32);
+    std::vector<float> constantData(info.GetNumElements(), 0.0f);
+    for (unsigned int i = 0; i < constantData.size(); i += 5)
+    {
+        constantData[i] = 0.125f * static_cast<float>(i % 9);
+    }
+    armnn::ConstTensor constTensor(info, constantData);
+
+    armnn::INetworkPtr network(armnn::INetwork::Create());
+    armnn::IConnectableLayer* constant = network->AddConstantLayer(constTensor, layerName.c_str());
+    armnn::IConnectableLayer* output = network->AddOutputLayer(0);
+    constant->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    constant->GetOutputSlot(0).SetTensorInfo(info);
+
+    const size_t uncompressedSize = SerializeNetwork(*network).size();
+
+    using armnnSerializer::TensorCompression;
+    for (TensorCompression compression : { TensorCompression::None,
+                                           TensorCompression::Palette,
+                                           TensorCompression::RunLength,
+                                           TensorCompression::Smallest })
+    {
+        armnnSerializer::SerializerOptions options;
+        options.m_TensorCompression = compression;
+        options.m_TensorDataAlignment = 64;
+
+        const std::string serialized = SerializeNetwork(*network, options);
+        BOOST_TEST((compression == TensorCompression::None ?
+                    serialized.size() >= uncompressedSize : serialized.size() < uncompressedSize / 2));
+
+        armnn::INetworkPtr deserializedNetwork = DeserializeNetwork(serialized);
+        BOOST_CHECK(deserializedNetwork);
+
+        ConstantLayerVerifier verifier(layerName, {}, {info}, constTensor);
+        deserializedNetwork->Accept(verifier);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(SerializeConvolution2d)
 {
     class Convolution2dLayerVerifier : public LayerVerifierBase
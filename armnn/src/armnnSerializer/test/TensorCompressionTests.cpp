@@ -0,0 +1,104 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../TensorCompression.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace armnnSerializer;
+
+BOOST_AUTO_TEST_SUITE(TensorCompression)
+
+BOOST_AUTO_TEST_CASE(PaletteRoundTripsFewDistinctValues)
+{
+    std::vector<float> weights;
+    for (unsigned int i = 0; i < 101; ++i)
+    {
+        weights.push_back(0.25f * static_cast<float>(i % 7) - 0.5f);
+    }
+    const unsigned int numBytes = static_cast<unsigned int>(weights.size() * sizeof(float));
+
+    PaletteData palette;
+    BOOST_TEST_REQUIRE(PaletteEncode(weights.data(), numBytes, sizeof(float), palette));
+    BOOST_TEST(palette.m_IndexBits == 4);
+    BOOST_TEST(palette.m_Codebook.size() == 7 * sizeof(float));
+    BOOST_TEST(palette.m_Indices.size() == 51);
+
+    std::vector<float> decoded(weights.size());
+    PaletteDecode(palette.m_Codebook.data(), palette.m_Codebook.size(), palette.m_Indices.data(),
+                  palette.m_Indices.size(), palette.m_IndexBits, sizeof(float), decoded.data(), numBytes);
+    BOOST_TEST(decoded == weights, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(PaletteUsesByteIndicesAndRejectsTooManyValues)
+{
+    std::vector<int16_t> values(600);
+    for (unsigned int i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<int16_t>(i % 200);
+    }
+    const unsigned int numBytes = static_cast<unsigned int>(values.size() * sizeof(int16_t));
+
+    PaletteData palette;
+    BOOST_TEST_REQUIRE(PaletteEncode(values.data(), numBytes, sizeof(int16_t), palette));
+    BOOST_TEST(palette.m_IndexBits == 8);
+
+    std::vector<int16_t> decoded(values.size());
+    PaletteDecode(palette.m_Codebook.data(), palette.m_Codebook.size(), palette.m_Indices.data(),
+                  palette.m_Indices.size(), palette.m_IndexBits, sizeof(int16_t), decoded.data(), numBytes);
+    BOOST_TEST(decoded == values, boost::test_tools::per_element());
+
+    for (unsigned int i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<int16_t>(i);
+    }
+    BOOST_TEST(!PaletteEncode(values.data(), numBytes, sizeof(int16_t), palette));
+}
+
+BOOST_AUTO_TEST_CASE(RunLengthRoundTrips)
+{
+    // Sparse weights, with runs of zeros between literals, plus a tail shorter than a whole element.
+    std::vector<uint8_t> data(4 * 1000 + 3, 0);
+    for (unsigned int i = 0; i < data.size(); i += 37)
+    {
+        data[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    for (unsigned int numBytes : { static_cast<unsigned int>(data.size()), 4000u, 0u })
+    {
+        std::vector<uint8_t> encoded = RunLengthEncode(data.data(), numBytes, 4);
+        BOOST_TEST(encoded.size() < std::max(numBytes, 1u));
+
+        std::vector<uint8_t> decoded(numBytes);
+        RunLengthDecode(encoded.data(), encoded.size(), 4, decoded.data(), numBytes);
+        BOOST_TEST(std::equal(decoded.begin(), decoded.end(), data.begin()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MalformedDataIsRejected)
+{
+    std::vector<uint8_t> data(64, 7);
+    std::vector<uint8_t> encoded = RunLengthEncode(data.data(), 64, 1);
+    std::vector<uint8_t> decoded(64);
+
+    // Truncated, and decoding to the wrong size.
+    BOOST_CHECK_THROW(RunLengthDecode(encoded.data(), encoded.size() - 1, 1, decoded.data(), 64),
+                      armnn::ParseException);
+    BOOST_CHECK_THROW(RunLengthDecode(encoded.data(), encoded.size(), 1, decoded.data(), 32), armnn::ParseException);
+
+    // An index past the end of the codebook.
+    const std::vector<uint8_t> codebook = { 1, 2 };
+    const std::vector<uint8_t> indices = { 0, 2 };
+    BOOST_CHECK_THROW(PaletteDecode(codebook.data(), codebook.size(), indices.data(), indices.size(), 8, 1,
+                                    decoded.data(), 2),
+                      armnn::ParseException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,71 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "MappedFile.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <fstream>
+#include <iterator>
+
+#if defined(__unix__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace armnnUtils
+{
+
+MappedFile::MappedFile(const std::string& path)
+    : m_Data(nullptr)
+    , m_Size(0)
+    , m_IsMapped(false)
+{
+#if defined(__unix__)
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw armnn::FileNotFoundException("Cannot open file " + path);
+    }
+    struct stat status;
+    if (fstat(fd, &status) == 0 && status.st_size > 0)
+    {
+        m_Size = static_cast<size_t>(status.st_size);
+        void* mapped = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED)
+        {
+            m_Data = static_cast<const uint8_t*>(mapped);
+            m_IsMapped = true;
+        }
+    }
+    close(fd);
+#endif
+
+    if (!m_IsMapped)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            throw armnn::FileNotFoundException("Cannot open file " + path);
+        }
+        m_Buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        m_Data = m_Buffer.data();
+        m_Size = m_Buffer.size();
+    }
+}
+
+MappedFile::~MappedFile()
+{
+#if defined(__unix__)
+    if (m_IsMapped)
+    {
+        munmap(const_cast<uint8_t*>(m_Data), m_Size);
+    }
+#endif
+}
+
+} // namespace armnnUtils
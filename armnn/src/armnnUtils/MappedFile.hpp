@@ -0,0 +1,41 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace armnnUtils
+{
+
+/// The read-only contents of a whole file. The file is memory mapped where the platform supports it, so that pages
+/// are only read when first used and are shared with the page cache. Elsewhere it is read into memory.
+class MappedFile
+{
+public:
+    /// Throws armnn::FileNotFoundException if @a path cannot be opened.
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// The data is valid for the lifetime of the object. Mapped data starts on a page boundary.
+    const uint8_t* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+
+    bool IsMapped() const { return m_IsMapped; }
+
+private:
+    const uint8_t*       m_Data;
+    size_t               m_Size;
+    bool                 m_IsMapped;
+    std::vector<uint8_t> m_Buffer;
+};
+
+} // namespace armnnUtils
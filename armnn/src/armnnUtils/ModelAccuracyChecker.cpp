@@ -16,16 +16,16 @@ armnnUtils::ModelAccuracyChecker::ModelAccuracyChecker(const std::map<std::strin
 
 float ModelAccuracyChecker::GetAccuracy(unsigned int k)
 {
-    if(k > 10) {
+    if(k > g_MaxTopK) {
         BOOST_LOG_TRIVIAL(info) << "Accuracy Tool only supports a maximum of Top 10 Accuracy. "
                                    "Printing Top 10 Accuracy result!";
-        k = 10;
+        k = g_MaxTopK;
     }
     unsigned int total = 0;
     for (unsigned int i = k; i > 0; --i)
     {
         total += m_TopK[i];
     }
-    return static_cast<float>(total * 100) / static_cast<float>(m_ImagesProcessed);
+    return static_cast<float>(total * 100) / static_cast<float>(m_ImagesProcessed.load());
 }
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <string>
 #include <map>
@@ -20,6 +22,12 @@ namespace armnnUtils
 
 using namespace armnn;
 
+/// Maximum k for which GetAccuracy() reports the Top k accuracy.
+constexpr unsigned int g_MaxTopK = 10;
+
+/// Counts how often the ground truth label of an image is among the k highest predictions.
+/// AddImageResult() may be called concurrently from several threads: the counts are atomics and each call only
+/// reads the ground truth labels, so workers evaluating different images need no locking.
 class ModelAccuracyChecker
 {
 public:
@@ -27,57 +35,53 @@ public:
 
     float GetAccuracy(unsigned int k);
 
+    unsigned int GetImagesProcessed() const { return m_ImagesProcessed.load(); }
+
     template<typename TContainer>
-    void AddImageResult(const std::string& imageName, std::vector<TContainer> outputTensor)
+    void AddImageResult(const std::string& imageName, const std::vector<TContainer>& outputTensor)
     {
-        // Increment the total number of images processed
-        ++m_ImagesProcessed;
-
-        std::map<int, float> confidenceMap;
-        auto & output = outputTensor[0];
-
-        // Create a map of all predictions
+        // Only predictions with a positive confidence are ranked, as (confidence, class) pairs in a flat buffer.
+        std::vector<std::pair<float, int>> predictions;
         boost::apply_visitor([&](auto && value)
                              {
+                                 predictions.reserve(value.size());
                                  int index = 0;
                                  for (const auto & o : value)
                                  {
                                      if (o > 0)
                                      {
-                                         confidenceMap.insert(std::pair<int, float>(index, static_cast<float>(o)));
+                                         predictions.emplace_back(static_cast<float>(o), index);
                                      }
                                      ++index;
                                  }
                              },
-                             output);
-
-        // Create a comparator for sorting the map in order of highest probability
-        typedef std::function<bool(std::pair<int, float>, std::pair<int, float>)> Comparator;
-
-        Comparator compFunctor =
-            [](std::pair<int, float> element1, std::pair<int, float> element2)
-            {
-                return element1.second > element2.second;
-            };
-
-        // Do the sorting and store in an ordered set
-        std::set<std::pair<int, float>, Comparator> setOfPredictions(
-            confidenceMap.begin(), confidenceMap.end(), compFunctor);
+                             outputTensor[0]);
+
+        // Only the best g_MaxTopK predictions are ever needed, so they are the only ones sorted. Ties are ranked
+        // by class index.
+        const auto topEnd = predictions.begin() +
+                            static_cast<std::ptrdiff_t>(std::min<size_t>(g_MaxTopK, predictions.size()));
+        std::partial_sort(predictions.begin(), topEnd, predictions.end(),
+                          [](const std::pair<float, int>& a, const std::pair<float, int>& b)
+                          {
+                              return a.first > b.first || (a.first == b.first && a.second < b.second);
+                          });
 
         std::string trimmedName = GetTrimmedImageName(imageName);
         int value = m_GroundTruthLabelSet.find(trimmedName)->second;
 
-        unsigned int index = 1;
-        for (std::pair<int, float> element : setOfPredictions)
+        unsigned int rank = 1;
+        for (auto it = predictions.begin(); it != topEnd; ++it, ++rank)
         {
-            if(element.first == value)
+            if (it->second == value)
             {
-                ++m_TopK[index];
-            } else
-            {
-                ++index;
+                ++m_TopK[rank];
+                break;
             }
         }
+
+        // Counted last, so that a concurrent GetAccuracy() never sees an image whose rank is still missing.
+        ++m_ImagesProcessed;
     }
 
     std::string GetTrimmedImageName(const std::string& imageName) const
@@ -96,8 +100,9 @@ public:
 
 private:
     const std::map<std::string, int> m_GroundTruthLabelSet;
-    std::vector<unsigned int> m_TopK = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-    unsigned int m_ImagesProcessed = 0;
+    // m_TopK[r] counts the images whose label was the r-th best prediction; index 0 is unused.
+    std::array<std::atomic<unsigned int>, g_MaxTopK + 1> m_TopK = {};
+    std::atomic<unsigned int> m_ImagesProcessed{0};
 };
 } //namespace armnnUtils
 
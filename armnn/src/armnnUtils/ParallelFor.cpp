@@ -0,0 +1,223 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ParallelFor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnnUtils
+{
+
+namespace
+{
+
+// Set on pool workers, and on a caller for the duration of its ParallelFor, so that nested calls run inline
+// instead of waiting for workers that may all be busy with the outer call.
+thread_local bool t_InsideParallelFor = false;
+
+unsigned int GetHardwareThreadCount()
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+std::atomic<unsigned int> g_ThreadCount(0);
+
+/// One ParallelFor call: a fixed number of tasks that the caller and the pool workers claim one at a time.
+class Job
+{
+public:
+    Job(unsigned int numTasks, const std::function<void(unsigned int)>& task)
+        : m_NumTasks(numTasks)
+        , m_Task(task)
+        , m_NextTask(0)
+        , m_CompletedTasks(0)
+    {}
+
+    /// Claims and runs the next task. Returns false once every task has been claimed.
+    bool RunNextTask()
+    {
+        const unsigned int index = m_NextTask++;
+        if (index >= m_NumTasks)
+        {
+            return false;
+        }
+
+        try
+        {
+            m_Task(index);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!m_Error)
+            {
+                m_Error = std::current_exception();
+            }
+        }
+
+        if (++m_CompletedTasks == m_NumTasks)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Condition.notify_all();
+        }
+        return true;
+    }
+
+    bool AllTasksClaimed() const { return m_NextTask.load() >= m_NumTasks; }
+
+    void WaitAndRethrow()
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Condition.wait(lock, [this]() { return m_CompletedTasks.load() == m_NumTasks; });
+        if (m_Error)
+        {
+            std::rethrow_exception(m_Error);
+        }
+    }
+
+private:
+    const unsigned int                          m_NumTasks;
+    const std::function<void(unsigned int)>&    m_Task;
+    std::atomic<unsigned int>                   m_NextTask;
+    std::atomic<unsigned int>                   m_CompletedTasks;
+    std::mutex                                  m_Mutex;
+    std::condition_variable                     m_Condition;
+    std::exception_ptr                          m_Error;
+};
+
+class WorkerPool
+{
+public:
+    static WorkerPool& GetInstance()
+    {
+        static WorkerPool pool;
+        return pool;
+    }
+
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stopping = true;
+        }
+        m_Condition.notify_all();
+        for (std::thread& worker : m_Workers)
+        {
+            worker.join();
+        }
+    }
+
+    void Run(unsigned int numTasks, const std::function<void(unsigned int)>& task)
+    {
+        auto job = std::make_shared<Job>(numTasks, task);
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            // Grow the pool on demand; the caller counts as one of the threads.
+            while (m_Workers.size() < numTasks - 1)
+            {
+                m_Workers.emplace_back(&WorkerPool::WorkerLoop, this);
+            }
+            m_Jobs.push_back(job);
+        }
+        m_Condition.notify_all();
+
+        t_InsideParallelFor = true;
+        while (job->RunNextTask()) {}
+        t_InsideParallelFor = false;
+
+        {
+            // Workers drop fully claimed jobs lazily; make sure this one does not outlive the call.
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Jobs.erase(std::remove(m_Jobs.begin(), m_Jobs.end(), job), m_Jobs.end());
+        }
+        job->WaitAndRethrow();
+    }
+
+private:
+    WorkerPool() : m_Stopping(false) {}
+
+    void WorkerLoop()
+    {
+        t_InsideParallelFor = true;
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        while (true)
+        {
+            m_Condition.wait(lock, [this]() { return m_Stopping || !m_Jobs.empty(); });
+            if (m_Stopping)
+            {
+                return;
+            }
+
+            std::shared_ptr<Job> job = m_Jobs.front();
+            if (job->AllTasksClaimed())
+            {
+                m_Jobs.pop_front();
+                continue;
+            }
+
+            lock.unlock();
+            while (job->RunNextTask()) {}
+            lock.lock();
+        }
+    }
+
+    std::mutex                        m_Mutex;
+    std::condition_variable           m_Condition;
+    std::deque<std::shared_ptr<Job>>  m_Jobs;
+    std::vector<std::thread>          m_Workers;
+    bool                              m_Stopping;
+};
+
+} // anonymous namespace
+
+unsigned int GetParallelForThreadCount()
+{
+    const unsigned int threadCount = g_ThreadCount.load();
+    return threadCount == 0 ? GetHardwareThreadCount() : threadCount;
+}
+
+void SetParallelForThreadCount(unsigned int numThreads)
+{
+    g_ThreadCount.store(numThreads);
+}
+
+void ParallelFor(unsigned int numItems,
+                 unsigned int minItemsPerTask,
+                 const std::function<void(unsigned int begin, unsigned int end)>& func)
+{
+    if (numItems == 0)
+    {
+        return;
+    }
+
+    const unsigned int itemsPerTask = std::max(1u, minItemsPerTask);
+    const unsigned int numTasks = std::min(GetParallelForThreadCount(), numItems / itemsPerTask);
+    if (numTasks < 2 || t_InsideParallelFor)
+    {
+        func(0, numItems);
+        return;
+    }
+
+    auto task = [numItems, numTasks, &func](unsigned int index)
+    {
+        const unsigned int begin = static_cast<unsigned int>(
+            static_cast<unsigned long long>(numItems) * index / numTasks);
+        const unsigned int end = static_cast<unsigned int>(
+            static_cast<unsigned long long>(numItems) * (index + 1) / numTasks);
+        func(begin, end);
+    };
+    WorkerPool::GetInstance().Run(numTasks, task);
+}
+
+} // namespace armnnUtils
@@ -0,0 +1,30 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <functional>
+
+namespace armnnUtils
+{
+
+/// Splits the range [0, numItems) into contiguous chunks and runs @a func(begin, end) on each of them, using a
+/// process-wide pool of worker threads as well as the calling thread. Returns once every chunk has completed.
+///
+/// Ranges with fewer than 2 * @a minItemsPerTask items, and calls made from inside another ParallelFor, run inline
+/// on the calling thread. Chunks are disjoint, so @a func may write to per-item outputs without synchronisation.
+/// The first exception thrown by @a func is rethrown on the calling thread.
+void ParallelFor(unsigned int numItems,
+                 unsigned int minItemsPerTask,
+                 const std::function<void(unsigned int begin, unsigned int end)>& func);
+
+/// Returns the number of threads (including the caller) ParallelFor distributes work over.
+unsigned int GetParallelForThreadCount();
+
+/// Limits the number of threads ParallelFor uses. 0 restores the default (the number of hardware threads).
+/// Only affects calls made after it returns.
+void SetParallelForThreadCount(unsigned int numThreads);
+
+} // namespace armnnUtils
@@ -6,87 +6,313 @@
 #include "Permute.hpp"
 
 #include "Half.hpp"
+#include "ParallelFor.hpp"
 #include <armnn/Tensor.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <vector>
 
 namespace
 {
 
-class PermuteLoop
+// Side of the square tiles in which a transposed plane is copied. A tile of 32 x 32 four-byte elements reads from 32
+// source lines and writes 32 destination lines, which together fit comfortably in L1.
+constexpr unsigned int g_TileSize = 32;
+
+// Permutes run at memory bandwidth, so a task is only worth scheduling for a few hundred kilobytes.
+constexpr size_t g_MinBytesPerTask = 256 * 1024;
+
+struct PermuteDimension
+{
+    unsigned int   m_Size;
+    std::ptrdiff_t m_SrcStride;
+    std::ptrdiff_t m_DstStride;
+};
+
+/// Walks the outer dimensions of a permute plan, starting from a linear index, and tracks the matching source and
+/// destination offsets.
+class Odometer
 {
 public:
-    using size_type = unsigned int;
+    Odometer(const std::vector<PermuteDimension>& dimensions, unsigned int start)
+        : m_Dimensions(dimensions)
+        , m_Index(dimensions.size())
+        , m_SrcOffset(0)
+        , m_DstOffset(0)
+    {
+        for (size_t d = m_Dimensions.size(); d-- > 0;)
+        {
+            m_Index[d] = start % m_Dimensions[d].m_Size;
+            start /= m_Dimensions[d].m_Size;
+            m_SrcOffset += static_cast<std::ptrdiff_t>(m_Index[d]) * m_Dimensions[d].m_SrcStride;
+            m_DstOffset += static_cast<std::ptrdiff_t>(m_Index[d]) * m_Dimensions[d].m_DstStride;
+        }
+    }
 
-    PermuteLoop(const armnn::TensorShape& dstShape, const armnn::PermutationVector& mappings)
-        : m_DstShape(dstShape)
+    std::ptrdiff_t GetSrcOffset() const { return m_SrcOffset; }
+    std::ptrdiff_t GetDstOffset() const { return m_DstOffset; }
+
+    void Next()
     {
-        assert(dstShape.GetNumDimensions() == mappings.GetSize());
+        for (size_t d = m_Dimensions.size(); d-- > 0;)
+        {
+            m_SrcOffset += m_Dimensions[d].m_SrcStride;
+            m_DstOffset += m_Dimensions[d].m_DstStride;
+            if (++m_Index[d] < m_Dimensions[d].m_Size)
+            {
+                return;
+            }
+            const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(m_Dimensions[d].m_Size);
+            m_SrcOffset -= size * m_Dimensions[d].m_SrcStride;
+            m_DstOffset -= size * m_Dimensions[d].m_DstStride;
+            m_Index[d] = 0;
+        }
+    }
 
-        const size_type numDims = dstShape.GetNumDimensions();
+private:
+    const std::vector<PermuteDimension>& m_Dimensions;
+    std::vector<unsigned int>            m_Index;
+    std::ptrdiff_t                       m_SrcOffset;
+    std::ptrdiff_t                       m_DstOffset;
+};
 
-        size_type srcStride = 1U;
-        size_type dstStride = 1U;
+/// Copies a rows x cols block in which the source is contiguous along the rows and the destination along the cols,
+/// one tile at a time. Each destination line of a tile is written contiguously while its source elements come from
+/// lines that stay cached for the whole tile.
+template <typename T>
+void TransposeBlock(const T* src, T* dst,
+                    unsigned int rows, unsigned int cols,
+                    std::ptrdiff_t srcColStride, std::ptrdiff_t dstRowStride)
+{
+    for (unsigned int rowTile = 0; rowTile < rows; rowTile += g_TileSize)
+    {
+        const unsigned int rowEnd = std::min(rows, rowTile + g_TileSize);
+        for (unsigned int colTile = 0; colTile < cols; colTile += g_TileSize)
+        {
+            const unsigned int colEnd = std::min(cols, colTile + g_TileSize);
+            for (unsigned int row = rowTile; row < rowEnd; ++row)
+            {
+                const T* srcRow = src + row;
+                T* dstRow = dst + static_cast<std::ptrdiff_t>(row) * dstRowStride;
+                for (unsigned int col = colTile; col < colEnd; ++col)
+                {
+                    dstRow[col] = srcRow[static_cast<std::ptrdiff_t>(col) * srcColStride];
+                }
+            }
+        }
+    }
+}
 
-        for (size_type i = numDims - 1U, k = 0U; k < numDims; ++k, --i)
+/// Element types without a native integer of the same size are moved with memcpy.
+void TransposeBlockBytes(const unsigned char* src, unsigned char* dst,
+                         unsigned int rows, unsigned int cols,
+                         std::ptrdiff_t srcColStride, std::ptrdiff_t dstRowStride, size_t dataTypeSize)
+{
+    const std::ptrdiff_t bytes = static_cast<std::ptrdiff_t>(dataTypeSize);
+    for (unsigned int rowTile = 0; rowTile < rows; rowTile += g_TileSize)
+    {
+        const unsigned int rowEnd = std::min(rows, rowTile + g_TileSize);
+        for (unsigned int colTile = 0; colTile < cols; colTile += g_TileSize)
         {
-            m_SrcStrides[mappings[i]] = srcStride;
-            m_DstStrides[i] = dstStride;
+            const unsigned int colEnd = std::min(cols, colTile + g_TileSize);
+            for (unsigned int row = rowTile; row < rowEnd; ++row)
+            {
+                for (unsigned int col = colTile; col < colEnd; ++col)
+                {
+                    std::memcpy(dst + (static_cast<std::ptrdiff_t>(row) * dstRowStride + col) * bytes,
+                                src + (row + static_cast<std::ptrdiff_t>(col) * srcColStride) * bytes,
+                                dataTypeSize);
+                }
+            }
+        }
+    }
+}
+
+/// Transposes a block of elements of type T, or of any size with memcpy when T is void.
+template <typename T>
+void TransposeBand(const unsigned char* src, unsigned char* dst,
+                   unsigned int rows, unsigned int cols,
+                   std::ptrdiff_t srcColStride, std::ptrdiff_t dstRowStride, size_t)
+{
+    TransposeBlock(reinterpret_cast<const T*>(src), reinterpret_cast<T*>(dst), rows, cols, srcColStride, dstRowStride);
+}
 
+template <>
+void TransposeBand<void>(const unsigned char* src, unsigned char* dst,
+                         unsigned int rows, unsigned int cols,
+                         std::ptrdiff_t srcColStride, std::ptrdiff_t dstRowStride, size_t dataTypeSize)
+{
+    TransposeBlockBytes(src, dst, rows, cols, srcColStride, dstRowStride, dataTypeSize);
+}
+
+class PermutePlan
+{
+public:
+    PermutePlan(const armnn::TensorShape& dstShape, const armnn::PermutationVector& mappings)
+    {
+        assert(dstShape.GetNumDimensions() == mappings.GetSize());
+
+        const unsigned int numDims = dstShape.GetNumDimensions();
+
+        // Strides of every destination dimension, in the source and in the destination.
+        std::ptrdiff_t srcStrides[armnn::MaxNumOfTensorDimensions];
+        std::ptrdiff_t dstStrides[armnn::MaxNumOfTensorDimensions];
+        std::ptrdiff_t srcStride = 1;
+        std::ptrdiff_t dstStride = 1;
+        for (unsigned int i = numDims; i-- > 0;)
+        {
+            srcStrides[mappings[i]] = srcStride;
+            dstStrides[i] = dstStride;
             srcStride *= dstShape[mappings[i]];
             dstStride *= dstShape[i];
         }
+
+        // Drop size-1 dimensions and merge destination dimensions that are also adjacent in the source, so that
+        // e.g. NHWC -> NCHW becomes a transpose of [N, HW, C] into [N, C, HW].
+        for (unsigned int i = 0; i < numDims; ++i)
+        {
+            const unsigned int size = dstShape[i];
+            if (size == 1)
+            {
+                continue;
+            }
+            if (!m_Dimensions.empty() &&
+                m_Dimensions.back().m_SrcStride == srcStrides[i] * static_cast<std::ptrdiff_t>(size))
+            {
+                m_Dimensions.back() = { m_Dimensions.back().m_Size * size, srcStrides[i], dstStrides[i] };
+                continue;
+            }
+            m_Dimensions.push_back({ size, srcStrides[i], dstStrides[i] });
+        }
+        m_NumElements = dstShape.GetNumElements();
     }
 
-    void Unroll(const void* srcData, void* dstData, size_t dataTypeSize)
+    void Run(const void* srcData, void* dstData, size_t dataTypeSize) const
     {
+        if (m_NumElements == 0)
+        {
+            return;
+        }
+
         assert(srcData);
         assert(dstData);
         assert(dataTypeSize > 0);
 
-        const unsigned char* srcDataPtr = reinterpret_cast<const unsigned char*>(srcData);
-        unsigned char* dstDataPtr       = reinterpret_cast<unsigned char*>(dstData);
+        const unsigned char* src = static_cast<const unsigned char*>(srcData);
+        unsigned char* dst = static_cast<unsigned char*>(dstData);
 
-        const unsigned char* const srcEndPtr = srcDataPtr + m_DstShape.GetNumElements() * dataTypeSize;
-        unsigned char* const       dstEndPtr = dstDataPtr + m_DstShape.GetNumElements() * dataTypeSize;
+        if (m_Dimensions.size() <= 1)
+        {
+            // The permutation only moved size-1 dimensions: the data is unchanged.
+            std::memcpy(dst, src, m_NumElements * dataTypeSize);
+            return;
+        }
+
+        if (m_Dimensions.back().m_SrcStride == 1)
+        {
+            CopyRuns(src, dst, dataTypeSize);
+            return;
+        }
 
-        Unroll(0, srcDataPtr, dstDataPtr, srcEndPtr, dstEndPtr, dataTypeSize);
+        switch (dataTypeSize)
+        {
+            case 1:
+                Transpose<uint8_t>(src, dst, dataTypeSize);
+                break;
+            case 2:
+                Transpose<uint16_t>(src, dst, dataTypeSize);
+                break;
+            case 4:
+                Transpose<uint32_t>(src, dst, dataTypeSize);
+                break;
+            case 8:
+                Transpose<uint64_t>(src, dst, dataTypeSize);
+                break;
+            default:
+                Transpose<void>(src, dst, dataTypeSize);
+                break;
+        }
     }
 
 private:
-    void Unroll(size_type dimension,
-                const unsigned char* srcData, unsigned char* dstData,
-                const unsigned char* srcEnd, unsigned char* dstEnd,
-                size_t dataTypeSize)
+    /// The innermost destination dimension is contiguous in the source too: copy whole runs of it.
+    void CopyRuns(const unsigned char* src, unsigned char* dst, size_t dataTypeSize) const
     {
-        assert(srcData);
-        assert(dstData);
-        assert(srcEnd);
-        assert(dstEnd);
-        assert(srcData < srcEnd);
-        assert(dstData < dstEnd);
-        assert(dataTypeSize > 0);
+        const std::vector<PermuteDimension> outer(m_Dimensions.begin(), m_Dimensions.end() - 1);
+        const size_t runBytes = m_Dimensions.back().m_Size * dataTypeSize;
+        const std::ptrdiff_t bytes = static_cast<std::ptrdiff_t>(dataTypeSize);
 
-        if (dimension >= m_DstShape.GetNumDimensions())
+        unsigned int numRuns = 1;
+        for (const PermuteDimension& dimension : outer)
         {
-            ::memcpy(dstData, srcData, dataTypeSize);
+            numRuns *= dimension.m_Size;
         }
-        else
+
+        const unsigned int minRunsPerTask = static_cast<unsigned int>(std::max<size_t>(1, g_MinBytesPerTask / runBytes));
+        armnnUtils::ParallelFor(numRuns, minRunsPerTask, [&](unsigned int begin, unsigned int end)
         {
-            for (size_type i = 0; i < m_DstShape[dimension]; i++)
+            Odometer odometer(outer, begin);
+            for (unsigned int run = begin; run < end; ++run, odometer.Next())
             {
-                Unroll(dimension + 1, srcData, dstData, srcEnd, dstEnd, dataTypeSize);
+                std::memcpy(dst + odometer.GetDstOffset() * bytes, src + odometer.GetSrcOffset() * bytes, runBytes);
+            }
+        });
+    }
+
+    /// Transposes, for every index of the other dimensions, the plane formed by the innermost destination dimension
+    /// (the cols) and the dimension that is innermost in the source (the rows).
+    template <typename T>
+    void Transpose(const unsigned char* src, unsigned char* dst, size_t dataTypeSize) const
+    {
+        const PermuteDimension& cols = m_Dimensions.back();
+        const auto rowsIt = std::find_if(m_Dimensions.begin(), m_Dimensions.end(),
+                                         [](const PermuteDimension& dimension) { return dimension.m_SrcStride == 1; });
+        assert(rowsIt != m_Dimensions.end());
+        const PermuteDimension& rows = *rowsIt;
 
-                srcData += m_SrcStrides[dimension] * dataTypeSize;
-                dstData += m_DstStrides[dimension] * dataTypeSize;
+        std::vector<PermuteDimension> outer;
+        for (auto it = m_Dimensions.begin(); it + 1 != m_Dimensions.end(); ++it)
+        {
+            if (it != rowsIt)
+            {
+                outer.push_back(*it);
             }
         }
+        unsigned int numPlanes = 1;
+        for (const PermuteDimension& dimension : outer)
+        {
+            numPlanes *= dimension.m_Size;
+        }
+
+        // Split each plane into bands of whole row tiles, so that a single large plane is threaded too.
+        const unsigned int numBands = (rows.m_Size + g_TileSize - 1) / g_TileSize;
+        const size_t bandBytes = static_cast<size_t>(g_TileSize) * cols.m_Size * dataTypeSize;
+        const unsigned int minBandsPerTask =
+            static_cast<unsigned int>(std::max<size_t>(1, g_MinBytesPerTask / bandBytes));
+        const std::ptrdiff_t bytes = static_cast<std::ptrdiff_t>(dataTypeSize);
+
+        armnnUtils::ParallelFor(numPlanes * numBands, minBandsPerTask, [&](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int item = begin; item < end; ++item)
+            {
+                const Odometer plane(outer, item / numBands);
+                const unsigned int firstRow = (item % numBands) * g_TileSize;
+                const unsigned int numRows = std::min(g_TileSize, rows.m_Size - firstRow);
+
+                const unsigned char* bandSrc = src + (plane.GetSrcOffset() + firstRow) * bytes;
+                unsigned char* bandDst = dst + (plane.GetDstOffset() + firstRow * rows.m_DstStride) * bytes;
+                TransposeBand<T>(bandSrc, bandDst, numRows, cols.m_Size, cols.m_SrcStride, rows.m_DstStride,
+                                 dataTypeSize);
+            }
+        });
     }
 
-    armnn::TensorShape m_DstShape;
-    std::array<size_type, armnn::MaxNumOfTensorDimensions> m_SrcStrides;
-    std::array<size_type, armnn::MaxNumOfTensorDimensions> m_DstStrides;
+    std::vector<PermuteDimension> m_Dimensions;
+    unsigned int                  m_NumElements;
 };
 
 } // namespace
@@ -120,7 +346,7 @@ armnn::TensorInfo Permuted(const armnn::TensorInfo& info, const armnn::Permutati
 void Permute(const armnn::TensorShape& dstShape, const armnn::PermutationVector& mappings,
              const void* src, void* dst, size_t dataTypeSize)
 {
-    PermuteLoop(dstShape, mappings).Unroll(src, dst, dataTypeSize);
+    PermutePlan(dstShape, mappings).Run(src, dst, dataTypeSize);
 }
 
 } // namespace armnnUtils
@@ -0,0 +1,267 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "TensorDataset.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/TypesUtils.hpp>
+
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace armnnUtils
+{
+
+namespace
+{
+
+constexpr char g_Magic[8] = { 'A', 'R', 'M', 'N', 'N', 'T', 'D', 'S' };
+constexpr uint32_t g_Version = 1;
+constexpr unsigned int g_MaxDimensions = 8;
+
+struct Header
+{
+    char     m_Magic[8];
+    uint32_t m_Version;
+    uint32_t m_DataType;
+    uint32_t m_NumDimensions;
+    uint32_t m_Dimensions[g_MaxDimensions];
+    float    m_QuantizationScale;
+    int32_t  m_QuantizationOffset;
+    uint32_t m_Reserved;
+    uint64_t m_NumSamples;
+    uint64_t m_SampleStride;
+    uint64_t m_DataOffset;
+    uint64_t m_NamesOffset;
+};
+
+static_assert(sizeof(Header) == 96, "The dataset header layout must not depend on the compiler");
+
+uint64_t RoundUpToAlignment(uint64_t value)
+{
+    return (value + g_TensorDatasetAlignment - 1) / g_TensorDatasetAlignment * g_TensorDatasetAlignment;
+}
+
+void WritePadding(std::ofstream& file, uint64_t numBytes)
+{
+    static const char zeros[g_TensorDatasetAlignment] = {};
+    while (numBytes > 0)
+    {
+        const uint64_t chunk = std::min(numBytes, g_TensorDatasetAlignment);
+        file.write(zeros, boost::numeric_cast<std::streamsize>(chunk));
+        numBytes -= chunk;
+    }
+}
+
+bool IsSupportedDataType(uint32_t dataType)
+{
+    switch (static_cast<armnn::DataType>(dataType))
+    {
+        case armnn::DataType::Float16:
+        case armnn::DataType::Float32:
+        case armnn::DataType::QuantisedAsymm8:
+        case armnn::DataType::Signed32:
+        case armnn::DataType::Boolean:
+        case armnn::DataType::QuantisedSymm16:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // anonymous namespace
+
+TensorDatasetWriter::TensorDatasetWriter(const std::string& path, const armnn::TensorInfo& sampleInfo)
+    : m_Path(path)
+    , m_SampleInfo(sampleInfo)
+    , m_File(path, std::ios::binary | std::ios::trunc)
+{
+    if (!m_File)
+    {
+        throw armnn::FileNotFoundException("Cannot create tensor dataset " + path);
+    }
+    if (sampleInfo.GetNumDimensions() > g_MaxDimensions)
+    {
+        throw armnn::InvalidArgumentException("Tensor dataset samples can have at most " +
+                                              std::to_string(g_MaxDimensions) + " dimensions");
+    }
+
+    // The header is written by Close(), once the number of samples is known.
+    WritePadding(m_File, RoundUpToAlignment(sizeof(Header)));
+}
+
+void TensorDatasetWriter::AddSample(const void* data, const std::string& name)
+{
+    if (!m_File.is_open())
+    {
+        throw armnn::RuntimeException("Tensor dataset " + m_Path + " has already been closed");
+    }
+
+    const uint64_t numBytes = m_SampleInfo.GetNumBytes();
+    m_File.write(static_cast<const char*>(data), boost::numeric_cast<std::streamsize>(numBytes));
+    WritePadding(m_File, RoundUpToAlignment(numBytes) - numBytes);
+    if (!m_File)
+    {
+        throw armnn::RuntimeException("Failed to write to tensor dataset " + m_Path);
+    }
+    m_Names.push_back(name);
+}
+
+void TensorDatasetWriter::Close()
+{
+    if (!m_File.is_open())
+    {
+        return;
+    }
+
+    Header header = {};
+    std::memcpy(header.m_Magic, g_Magic, sizeof(g_Magic));
+    header.m_Version = g_Version;
+    header.m_DataType = static_cast<uint32_t>(m_SampleInfo.GetDataType());
+    header.m_NumDimensions = m_SampleInfo.GetNumDimensions();
+    for (unsigned int d = 0; d < header.m_NumDimensions; ++d)
+    {
+        header.m_Dimensions[d] = m_SampleInfo.GetShape()[d];
+    }
+    header.m_QuantizationScale = m_SampleInfo.GetQuantizationScale();
+    header.m_QuantizationOffset = m_SampleInfo.GetQuantizationOffset();
+    header.m_NumSamples = m_Names.size();
+    header.m_SampleStride = RoundUpToAlignment(m_SampleInfo.GetNumBytes());
+    header.m_DataOffset = RoundUpToAlignment(sizeof(Header));
+    header.m_NamesOffset = header.m_DataOffset + header.m_NumSamples * header.m_SampleStride;
+
+    // Each name is its length followed by its characters.
+    for (const std::string& name : m_Names)
+    {
+        const uint32_t length = boost::numeric_cast<uint32_t>(name.size());
+        m_File.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        m_File.write(name.data(), boost::numeric_cast<std::streamsize>(name.size()));
+    }
+
+    m_File.seekp(0);
+    m_File.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_File.close();
+    if (!m_File)
+    {
+        throw armnn::RuntimeException("Failed to write to tensor dataset " + m_Path);
+    }
+}
+
+TensorDataset::TensorDataset(const std::string& path)
+    : m_File(path)
+    , m_NumSamples(0)
+    , m_DataOffset(0)
+    , m_SampleStride(0)
+{
+    try
+    {
+        ParseHeader();
+    }
+    catch (const armnn::ParseException& e)
+    {
+        throw armnn::ParseException(path + ": " + e.what());
+    }
+}
+
+void TensorDataset::ParseHeader()
+{
+    const uint8_t* data = m_File.GetData();
+    const size_t size = m_File.GetSize();
+
+    Header header;
+    if (size < sizeof(header))
+    {
+        throw armnn::ParseException("not a tensor dataset: the file is too small");
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.m_Magic, g_Magic, sizeof(g_Magic)) != 0)
+    {
+        throw armnn::ParseException("not a tensor dataset");
+    }
+    if (header.m_Version != g_Version)
+    {
+        throw armnn::ParseException("unsupported tensor dataset version " + std::to_string(header.m_Version));
+    }
+    if (!IsSupportedDataType(header.m_DataType))
+    {
+        throw armnn::ParseException("unsupported data type " + std::to_string(header.m_DataType));
+    }
+    if (header.m_NumDimensions == 0 || header.m_NumDimensions > armnn::MaxNumOfTensorDimensions)
+    {
+        throw armnn::ParseException("unsupported number of dimensions " + std::to_string(header.m_NumDimensions));
+    }
+
+    m_SampleInfo = armnn::TensorInfo(armnn::TensorShape(header.m_NumDimensions, header.m_Dimensions),
+                                     static_cast<armnn::DataType>(header.m_DataType),
+                                     header.m_QuantizationScale,
+                                     header.m_QuantizationOffset);
+
+    // Check the sections against the file size, dividing rather than multiplying so that nothing can overflow.
+    if (header.m_SampleStride < m_SampleInfo.GetNumBytes() ||
+        header.m_DataOffset % g_TensorDatasetAlignment != 0 ||
+        header.m_SampleStride % g_TensorDatasetAlignment != 0 ||
+        header.m_DataOffset < sizeof(header) ||
+        header.m_NamesOffset < header.m_DataOffset ||
+        header.m_NamesOffset > size ||
+        (header.m_SampleStride != 0 &&
+         header.m_NumSamples > (header.m_NamesOffset - header.m_DataOffset) / header.m_SampleStride))
+    {
+        throw armnn::ParseException("the sample data does not fit in the file");
+    }
+    m_NumSamples = boost::numeric_cast<unsigned int>(header.m_NumSamples);
+    m_DataOffset = header.m_DataOffset;
+    m_SampleStride = header.m_SampleStride;
+
+    uint64_t offset = header.m_NamesOffset;
+    m_Names.reserve(m_NumSamples);
+    for (unsigned int i = 0; i < m_NumSamples; ++i)
+    {
+        uint32_t length;
+        if (size - offset < sizeof(length))
+        {
+            throw armnn::ParseException("the sample names are truncated");
+        }
+        std::memcpy(&length, data + offset, sizeof(length));
+        offset += sizeof(length);
+        if (size - offset < length)
+        {
+            throw armnn::ParseException("the sample names are truncated");
+        }
+        m_Names.emplace_back(reinterpret_cast<const char*>(data + offset), length);
+        offset += length;
+    }
+}
+
+bool TensorDataset::IsTensorDataset(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    char magic[sizeof(g_Magic)];
+    return file.read(magic, sizeof(magic)) && std::memcmp(magic, g_Magic, sizeof(g_Magic)) == 0;
+}
+
+const void* TensorDataset::GetSample(unsigned int index) const
+{
+    if (index >= m_NumSamples)
+    {
+        throw armnn::InvalidArgumentException("Sample " + std::to_string(index) + " is out of range for a dataset of " +
+                                              std::to_string(m_NumSamples) + " samples");
+    }
+    return m_File.GetData() + m_DataOffset + index * m_SampleStride;
+}
+
+const std::string& TensorDataset::GetSampleName(unsigned int index) const
+{
+    if (index >= m_NumSamples)
+    {
+        throw armnn::InvalidArgumentException("Sample " + std::to_string(index) + " is out of range for a dataset of " +
+                                              std::to_string(m_NumSamples) + " samples");
+    }
+    return m_Names[index];
+}
+
+} // namespace armnnUtils
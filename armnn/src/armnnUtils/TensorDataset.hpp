@@ -0,0 +1,89 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "MappedFile.hpp"
+
+#include <armnn/Tensor.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace armnnUtils
+{
+
+/// A binary container for many samples of one tensor type, used by the test tools instead of text tensor files.
+///
+/// The file is a fixed-size header (magic, version, data type, shape, quantization parameters, number of samples,
+/// stride between samples and offsets of the data and name sections), then the raw sample data, then the sample
+/// names. Every sample starts on a g_TensorDatasetAlignment byte boundary, so the data can be used in place once the
+/// file is memory mapped. Values are stored in the byte order of the machine that wrote the file.
+constexpr uint64_t g_TensorDatasetAlignment = 64;
+
+/// Writes a dataset one sample at a time. The header is completed by Close(), which must be called for the file
+/// to be readable.
+class TensorDatasetWriter
+{
+public:
+    /// Creates (or truncates) @a path. Every sample has the shape, data type and quantization of @a sampleInfo.
+    TensorDatasetWriter(const std::string& path, const armnn::TensorInfo& sampleInfo);
+
+    /// Appends a sample of sampleInfo.GetNumBytes() bytes, with an optional name (e.g. the source image).
+    void AddSample(const void* data, const std::string& name = "");
+
+    /// Writes the names and the final header, then closes the file.
+    void Close();
+
+    unsigned int GetNumSamples() const { return static_cast<unsigned int>(m_Names.size()); }
+
+private:
+    std::string              m_Path;
+    armnn::TensorInfo        m_SampleInfo;
+    std::ofstream            m_File;
+    std::vector<std::string> m_Names;
+};
+
+/// Reads a dataset written by TensorDatasetWriter. The file is memory mapped where the platform supports it, so
+/// samples are read straight from the page cache without parsing or copying.
+class TensorDataset
+{
+public:
+    /// Throws armnn::FileNotFoundException if @a path cannot be opened, and armnn::ParseException if it is not a
+    /// well formed dataset.
+    explicit TensorDataset(const std::string& path);
+
+    TensorDataset(const TensorDataset&) = delete;
+    TensorDataset& operator=(const TensorDataset&) = delete;
+
+    /// Returns true if @a path starts with the dataset magic, to tell datasets apart from text tensor files.
+    static bool IsTensorDataset(const std::string& path);
+
+    const armnn::TensorInfo& GetSampleInfo() const { return m_SampleInfo; }
+    unsigned int GetNumSamples() const { return m_NumSamples; }
+
+    /// Returns a pointer to the data of sample @a index, valid for the lifetime of the dataset.
+    const void* GetSample(unsigned int index) const;
+
+    template <typename T>
+    const T* GetSample(unsigned int index) const { return static_cast<const T*>(GetSample(index)); }
+
+    /// Returns the name given to sample @a index when it was written, which may be empty.
+    const std::string& GetSampleName(unsigned int index) const;
+
+private:
+    void ParseHeader();
+
+    MappedFile               m_File;
+    armnn::TensorInfo        m_SampleInfo;
+    unsigned int             m_NumSamples;
+    uint64_t                 m_DataOffset;
+    uint64_t                 m_SampleStride;
+    std::vector<std::string> m_Names;
+};
+
+} // namespace armnnUtils
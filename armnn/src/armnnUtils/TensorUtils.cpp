@@ -6,6 +6,8 @@
 #include "TensorUtils.hpp"
 #include <backendsCommon/ITensorHandle.hpp>
 
+#include <algorithm>
+
 namespace armnnUtils
 {
 
@@ -53,24 +55,46 @@ std::pair<float, float> FindMinMax(armnn::ITensorHandle* tensorHandle)
     auto tensor_data = static_cast<const float *>(tensorHandle->Map(true));
     auto tensor_size = tensorHandle->GetShape().GetNumElements();
 
-    // Set min/max initially to first value in tensor
-    float min = tensor_data[0];
-    float max = tensor_data[0];
+    std::pair<float, float> minMax = FindMinMax(tensor_data, tensor_size);
+
+    tensorHandle->Unmap();
+
+    return minMax;
+}
 
-    // Loop over rest of tensor and update min/max if necessary
-    for (unsigned int val = 1; val < tensor_size; val++)
+std::pair<float, float> FindMinMax(const float* data, unsigned int numElements)
+{
+    if (numElements == 0)
     {
-        if (tensor_data[val] < min)
-        {
-            min = tensor_data[val];
-        }
-        else if (tensor_data[val] > max)
+        return std::make_pair(0.0f, 0.0f);
+    }
+
+    // Independent accumulators for each lane let the compiler turn the main loop into vector min/max instructions,
+    // instead of a chain of dependent compares.
+    constexpr unsigned int numLanes = 8;
+    float mins[numLanes];
+    float maxs[numLanes];
+    std::fill(mins, mins + numLanes, data[0]);
+    std::fill(maxs, maxs + numLanes, data[0]);
+
+    unsigned int i = 0;
+    for (; i + numLanes <= numElements; i += numLanes)
+    {
+        for (unsigned int lane = 0; lane < numLanes; ++lane)
         {
-            max = tensor_data[val];
+            const float value = data[i + lane];
+            mins[lane] = value < mins[lane] ? value : mins[lane];
+            maxs[lane] = value > maxs[lane] ? value : maxs[lane];
         }
     }
 
-    tensorHandle->Unmap();
+    float min = *std::min_element(mins, mins + numLanes);
+    float max = *std::max_element(maxs, maxs + numLanes);
+    for (; i < numElements; ++i)
+    {
+        min = std::min(min, data[i]);
+        max = std::max(max, data[i]);
+    }
 
     return std::make_pair(min, max);
 }
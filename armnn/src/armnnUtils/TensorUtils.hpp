@@ -24,4 +24,7 @@ armnn::TensorInfo GetTensorInfo(unsigned int numberOfBatches,
 
 std::pair<float, float> FindMinMax(armnn::ITensorHandle* tensorHandle);
 
+/// Returns the smallest and largest of @a numElements floats. Returns (0, 0) when there are none.
+std::pair<float, float> FindMinMax(const float* data, unsigned int numElements);
+
 } // namespace armnnUtils
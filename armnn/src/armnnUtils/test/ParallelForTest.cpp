@@ -0,0 +1,151 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../ParallelFor.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace armnnUtils;
+
+namespace
+{
+
+/// Forces ParallelFor onto a given number of threads, whatever the host has, for the lifetime of the object.
+class ScopedThreadCount
+{
+public:
+    explicit ScopedThreadCount(unsigned int numThreads)
+    {
+        SetParallelForThreadCount(numThreads);
+    }
+
+    ~ScopedThreadCount()
+    {
+        SetParallelForThreadCount(0);
+    }
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(ParallelForSuite)
+
+BOOST_AUTO_TEST_CASE(ParallelForVisitsEveryItemOnce)
+{
+    ScopedThreadCount threads(4);
+
+    for (unsigned int numItems : { 0u, 1u, 7u, 64u, 1001u })
+    {
+        // Chunks are disjoint, so each element is written by exactly one thread.
+        std::vector<int> visits(numItems, 0);
+        std::atomic<unsigned int> numEmptyChunks(0);
+        ParallelFor(numItems, 1, [&visits, &numEmptyChunks](unsigned int begin, unsigned int end)
+        {
+            if (begin >= end)
+            {
+                ++numEmptyChunks;
+            }
+            for (unsigned int i = begin; i < end; ++i)
+            {
+                ++visits[i];
+            }
+        });
+
+        BOOST_TEST(numEmptyChunks.load() == 0u);
+
+        for (unsigned int i = 0; i < numItems; ++i)
+        {
+            BOOST_TEST(visits[i] == 1);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ParallelForRespectsMinItemsPerTask)
+{
+    ScopedThreadCount threads(8);
+
+    // Boost.Test assertions are not thread safe, so chunks are recorded and checked on the calling thread.
+    std::mutex mutex;
+    std::vector<std::pair<unsigned int, unsigned int>> chunks;
+    auto recordChunk = [&mutex, &chunks](unsigned int begin, unsigned int end)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        chunks.emplace_back(begin, end);
+    };
+
+    ParallelFor(100, 40, recordChunk);
+    BOOST_TEST(chunks.size() == 2u);
+    for (const auto& chunk : chunks)
+    {
+        BOOST_TEST(chunk.second - chunk.first >= 40u);
+    }
+
+    // Fewer than two tasks' worth of items runs as a single chunk.
+    chunks.clear();
+    ParallelFor(79, 40, recordChunk);
+    BOOST_TEST(chunks.size() == 1u);
+    BOOST_TEST(chunks[0].first == 0u);
+    BOOST_TEST(chunks[0].second == 79u);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelForNestedCallsRunInline)
+{
+    ScopedThreadCount threads(4);
+
+    std::vector<std::vector<int>> visits(16, std::vector<int>(16, 0));
+    std::atomic<unsigned int> numSplitNestedCalls(0);
+    ParallelFor(16, 1, [&visits, &numSplitNestedCalls](unsigned int outerBegin, unsigned int outerEnd)
+    {
+        for (unsigned int i = outerBegin; i < outerEnd; ++i)
+        {
+            ParallelFor(16, 1, [&visits, &numSplitNestedCalls, i](unsigned int begin, unsigned int end)
+            {
+                // The nested call should cover the whole range in one chunk.
+                if (begin != 0 || end != 16)
+                {
+                    ++numSplitNestedCalls;
+                }
+                for (unsigned int j = begin; j < end; ++j)
+                {
+                    ++visits[i][j];
+                }
+            });
+        }
+    });
+
+    BOOST_TEST(numSplitNestedCalls.load() == 0u);
+    for (const std::vector<int>& row : visits)
+    {
+        for (int count : row)
+        {
+            BOOST_TEST(count == 1);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ParallelForRethrowsExceptions)
+{
+    ScopedThreadCount threads(4);
+
+    BOOST_CHECK_THROW(ParallelFor(64, 1, [](unsigned int begin, unsigned int)
+    {
+        if (begin == 0)
+        {
+            throw std::runtime_error("failed chunk");
+        }
+    }), std::runtime_error);
+
+    // The pool is still usable afterwards.
+    std::atomic<unsigned int> numItems(0);
+    ParallelFor(64, 1, [&numItems](unsigned int begin, unsigned int end) { numItems += end - begin; });
+    BOOST_TEST(numItems.load() == 64u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
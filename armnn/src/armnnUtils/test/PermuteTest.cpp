@@ -0,0 +1,122 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../ParallelFor.hpp"
+#include "../Permute.hpp"
+
+#include <armnn/Tensor.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace armnn;
+
+namespace
+{
+
+/// Element-by-element permute, used as the reference for the tiled kernel.
+std::vector<uint8_t> NaivePermute(const TensorShape& srcShape, const PermutationVector& mappings,
+                                  const std::vector<uint8_t>& src, size_t dataTypeSize)
+{
+    const unsigned int numDims = srcShape.GetNumDimensions();
+    const TensorShape dstShape = armnnUtils::Permuted(srcShape, mappings);
+
+    std::vector<unsigned int> dstStrides(numDims, 1);
+    for (unsigned int d = numDims - 1; d-- > 0;)
+    {
+        dstStrides[d] = dstStrides[d + 1] * dstShape[d + 1];
+    }
+
+    std::vector<uint8_t> dst(src.size());
+    std::vector<unsigned int> index(numDims, 0);
+    for (unsigned int srcElement = 0; srcElement < srcShape.GetNumElements(); ++srcElement)
+    {
+        unsigned int dstElement = 0;
+        for (unsigned int d = 0; d < numDims; ++d)
+        {
+            dstElement += index[d] * dstStrides[mappings[d]];
+        }
+        std::memcpy(&dst[dstElement * dataTypeSize], &src[srcElement * dataTypeSize], dataTypeSize);
+
+        for (unsigned int d = numDims; d-- > 0;)
+        {
+            if (++index[d] < srcShape[d])
+            {
+                break;
+            }
+            index[d] = 0;
+        }
+    }
+    return dst;
+}
+
+void CheckPermute(const TensorShape& srcShape, const PermutationVector& mappings, size_t dataTypeSize)
+{
+    std::vector<uint8_t> src(srcShape.GetNumElements() * dataTypeSize);
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+        src[i] = static_cast<uint8_t>(i * 7 + i / 251);
+    }
+
+    std::vector<uint8_t> dst(src.size());
+    armnnUtils::Permute(armnnUtils::Permuted(srcShape, mappings), mappings, src.data(), dst.data(), dataTypeSize);
+
+    BOOST_TEST((dst == NaivePermute(srcShape, mappings, src, dataTypeSize)));
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(PermuteSuite)
+
+BOOST_AUTO_TEST_CASE(PermuteMatchesNaiveForAll4dPermutations)
+{
+    const std::vector<TensorShape> shapes = { { 2, 3, 5, 7 }, { 1, 33, 40, 3 }, { 2, 1, 37, 65 }, { 1, 1, 1, 1 } };
+
+    std::vector<unsigned int> order = { 0, 1, 2, 3 };
+    do
+    {
+        const PermutationVector mappings(order.data(), 4);
+        for (const TensorShape& shape : shapes)
+        {
+            // 3-byte elements have no native type and take the memcpy fallback.
+            for (size_t dataTypeSize : { 1u, 2u, 3u, 4u, 8u })
+            {
+                CheckPermute(shape, mappings, dataTypeSize);
+            }
+        }
+    }
+    while (std::next_permutation(order.begin(), order.end()));
+}
+
+BOOST_AUTO_TEST_CASE(PermuteLargeTransposeIsIndependentOfThreadCount)
+{
+    // Large enough for the NHWC <-> NCHW transposes to be split into several bands of tiles.
+    const TensorShape nhwc({ 2, 67, 61, 130 });
+    const PermutationVector nhwcToNchw({ 0, 2, 3, 1 });
+    const PermutationVector nchwToNhwc({ 0, 3, 1, 2 });
+
+    for (unsigned int numThreads : { 1u, 4u })
+    {
+        armnnUtils::SetParallelForThreadCount(numThreads);
+        CheckPermute(nhwc, nhwcToNchw, 4);
+        CheckPermute(armnnUtils::Permuted(nhwc, nhwcToNchw), nchwToNhwc, 4);
+        CheckPermute(nhwc, nhwcToNchw, 1);
+    }
+    armnnUtils::SetParallelForThreadCount(0);
+}
+
+BOOST_AUTO_TEST_CASE(PermuteHandlesLowerRanksAndEmptyTensors)
+{
+    CheckPermute(TensorShape({ 45, 70 }), PermutationVector({ 1, 0 }), 4);
+    CheckPermute(TensorShape({ 4, 9, 33 }), PermutationVector({ 2, 0, 1 }), 2);
+    CheckPermute(TensorShape({ 19 }), PermutationVector({ 0 }), 4);
+    CheckPermute(TensorShape({ 3, 0, 2 }), PermutationVector({ 1, 2, 0 }), 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
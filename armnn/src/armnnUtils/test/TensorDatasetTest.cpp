@@ -0,0 +1,120 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../TensorDataset.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace armnnUtils;
+
+namespace
+{
+
+/// A file in the temporary directory, removed when the object goes out of scope.
+class ScopedTempFile
+{
+public:
+    ScopedTempFile()
+        : m_Path((boost::filesystem::temp_directory_path() /
+                  boost::filesystem::unique_path("%%%%-%%%%-%%%%.tensors")).string())
+    {}
+
+    ~ScopedTempFile()
+    {
+        boost::filesystem::remove(m_Path);
+    }
+
+    const std::string& GetPath() const { return m_Path; }
+
+private:
+    std::string m_Path;
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(TensorDatasetSuite)
+
+BOOST_AUTO_TEST_CASE(WrittenSamplesReadBackAligned)
+{
+    ScopedTempFile file;
+
+    // 3 x 5 x 7 bytes: not a multiple of the alignment, so samples are padded.
+    const armnn::TensorInfo sampleInfo({ 1, 3, 5, 7 }, armnn::DataType::QuantisedAsymm8, 0.25f, 12);
+    std::vector<std::vector<uint8_t>> samples;
+    TensorDatasetWriter writer(file.GetPath(), sampleInfo);
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        samples.emplace_back(sampleInfo.GetNumBytes());
+        for (unsigned int j = 0; j < samples.back().size(); ++j)
+        {
+            samples.back()[j] = static_cast<uint8_t>(i * 31 + j);
+        }
+        writer.AddSample(samples.back().data(), i == 2 ? "" : "image_" + std::to_string(i));
+    }
+    writer.Close();
+
+    BOOST_TEST(TensorDataset::IsTensorDataset(file.GetPath()));
+    TensorDataset dataset(file.GetPath());
+    BOOST_TEST((dataset.GetSampleInfo() == sampleInfo));
+    BOOST_TEST(dataset.GetNumSamples() == 4u);
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        const uint8_t* sample = dataset.GetSample<uint8_t>(i);
+        BOOST_TEST(reinterpret_cast<uintptr_t>(sample) % g_TensorDatasetAlignment == 0);
+        BOOST_TEST(std::memcmp(sample, samples[i].data(), samples[i].size()) == 0);
+        BOOST_TEST(dataset.GetSampleName(i) == (i == 2 ? "" : "image_" + std::to_string(i)));
+    }
+    BOOST_CHECK_THROW(dataset.GetSample(4), armnn::InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(EmptyDatasetHasNoSamples)
+{
+    ScopedTempFile file;
+    TensorDatasetWriter writer(file.GetPath(), armnn::TensorInfo({ 2, 2 }, armnn::DataType::Float32));
+    writer.Close();
+
+    TensorDataset dataset(file.GetPath());
+    BOOST_TEST(dataset.GetNumSamples() == 0u);
+    BOOST_TEST((dataset.GetSampleInfo().GetShape() == armnn::TensorShape({ 2, 2 })));
+}
+
+BOOST_AUTO_TEST_CASE(MalformedFilesAreRejected)
+{
+    ScopedTempFile file;
+
+    // A text tensor file.
+    {
+        std::ofstream text(file.GetPath());
+        text << "0.5 1.5 2.5 3.5\n";
+    }
+    BOOST_TEST(!TensorDataset::IsTensorDataset(file.GetPath()));
+    BOOST_CHECK_THROW(TensorDataset dataset(file.GetPath()), armnn::ParseException);
+
+    // A dataset whose samples were cut off.
+    const armnn::TensorInfo sampleInfo({ 16 }, armnn::DataType::Float32);
+    std::vector<float> sample(16, 1.0f);
+    {
+        TensorDatasetWriter writer(file.GetPath(), sampleInfo);
+        writer.AddSample(sample.data());
+        writer.AddSample(sample.data());
+        writer.Close();
+    }
+    boost::filesystem::resize_file(file.GetPath(), boost::filesystem::file_size(file.GetPath()) - 100);
+    BOOST_TEST(TensorDataset::IsTensorDataset(file.GetPath()));
+    BOOST_CHECK_THROW(TensorDataset dataset(file.GetPath()), armnn::ParseException);
+
+    BOOST_CHECK_THROW(TensorDataset dataset(file.GetPath() + ".missing"), armnn::FileNotFoundException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -14,25 +14,27 @@ namespace armnn
 ConstCpuTensorHandle::ConstCpuTensorHandle(const TensorInfo& tensorInfo)
 : m_TensorInfo(tensorInfo)
 , m_Memory(nullptr)
+, m_MemoryParent(nullptr)
 {
 }
 
 template <>
 const void* ConstCpuTensorHandle::GetConstTensor<void>() const
 {
-    return m_Memory;
+    return GetMemory();
 }
 
 CpuTensorHandle::CpuTensorHandle(const TensorInfo& tensorInfo)
 : ConstCpuTensorHandle(tensorInfo)
 , m_MutableMemory(nullptr)
+, m_MutableMemoryParent(nullptr)
 {
 }
 
 template <>
 void* CpuTensorHandle::GetTensor<void>() const
 {
-    return m_MutableMemory;
+    return GetMutableMemory();
 }
 
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const TensorInfo& tensorInfo)
@@ -111,6 +113,17 @@ void ScopedCpuTensorHandle::CopyFrom(const void* srcMemory, unsigned int numByte
     }
 }
 
+AliasCpuTensorHandle::AliasCpuTensorHandle(const TensorInfo& tensorInfo, CpuTensorHandle& parent)
+: CpuTensorHandle(tensorInfo)
+, m_Parent(&parent)
+{
+    if (tensorInfo.GetNumBytes() != parent.GetTensorInfo().GetNumBytes())
+    {
+        throw InvalidArgumentException("AliasCpuTensorHandle: the view must have the size of its parent");
+    }
+    SetMemoryParent(parent);
+}
+
 void PassthroughCpuTensorHandle::Allocate()
 {
     throw InvalidArgumentException("PassthroughCpuTensorHandle::Allocate() should never be called");
@@ -24,7 +24,7 @@ public:
     const T* GetConstTensor() const
     {
         BOOST_ASSERT(CompatibleTypes<T>(GetTensorInfo().GetDataType()));
-        return reinterpret_cast<const T*>(m_Memory);
+        return reinterpret_cast<const T*>(GetMemory());
     }
 
     const TensorInfo& GetTensorInfo() const
@@ -36,7 +36,7 @@ public:
 
     virtual ITensorHandle* GetParent() const override { return nullptr; }
 
-    virtual const void* Map(bool /* blocking = true */) const override { return m_Memory; }
+    virtual const void* Map(bool /* blocking = true */) const override { return GetMemory(); }
     virtual void Unmap() const override {}
 
     TensorShape GetStrides() const override
@@ -61,6 +61,11 @@ protected:
 
     void SetConstMemory(const void* mem) { m_Memory = mem; }
 
+    /// Makes the handle read the memory of @a parent, which can be allocated after this call.
+    void SetMemoryParent(const ConstCpuTensorHandle& parent) { m_MemoryParent = &parent; }
+
+    const void* GetMemory() const { return m_MemoryParent ? m_MemoryParent->GetMemory() : m_Memory; }
+
 private:
     // Only used for testing
     void CopyOutTo(void *) const override {}
@@ -71,6 +76,7 @@ private:
 
     TensorInfo m_TensorInfo;
     const void* m_Memory;
+    const ConstCpuTensorHandle* m_MemoryParent;
 };
 
 template<>
@@ -84,7 +90,7 @@ public:
     T* GetTensor() const
     {
         BOOST_ASSERT(CompatibleTypes<T>(GetTensorInfo().GetDataType()));
-        return reinterpret_cast<T*>(m_MutableMemory);
+        return reinterpret_cast<T*>(GetMutableMemory());
     }
 
 protected:
@@ -96,11 +102,24 @@ protected:
         SetConstMemory(m_MutableMemory);
     }
 
+    /// Makes the handle read and write the memory of @a parent, which can be allocated after this call.
+    void SetMemoryParent(CpuTensorHandle& parent)
+    {
+        ConstCpuTensorHandle::SetMemoryParent(parent);
+        m_MutableMemoryParent = &parent;
+    }
+
+    void* GetMutableMemory() const
+    {
+        return m_MutableMemoryParent ? m_MutableMemoryParent->GetMutableMemory() : m_MutableMemory;
+    }
+
 private:
 
     CpuTensorHandle(const CpuTensorHandle& other) = delete;
     CpuTensorHandle& operator=(const CpuTensorHandle& other) = delete;
     void* m_MutableMemory;
+    CpuTensorHandle* m_MutableMemoryParent;
 };
 
 template <>
@@ -151,6 +170,25 @@ public:
     virtual void Allocate() override;
 };
 
+// A CpuTensorHandle that is a view of the memory of another CpuTensorHandle, as a tensor of a different shape and
+// the same size. Layers that only change the shape of a tensor, such as Reshape, output such views instead of copying
+// their input.
+//
+// The parent owns the memory: it can be allocated after the view is created, and must outlive the view.
+class AliasCpuTensorHandle : public CpuTensorHandle
+{
+public:
+    AliasCpuTensorHandle(const TensorInfo& tensorInfo, CpuTensorHandle& parent);
+
+    virtual ITensorHandle* GetParent() const override { return m_Parent; }
+
+    // The memory is allocated with the parent.
+    virtual void Allocate() override {}
+
+private:
+    CpuTensorHandle* m_Parent;
+};
+
 // A ConstCpuTensorHandle that wraps an already allocated memory region.
 //
 // This allows users to pass in const memory to a network.
@@ -917,8 +917,15 @@ void FloorQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
 
 void LstmQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
 {
-    ValidateTensorNumDimensions(workloadInfo.m_InputTensorInfos[0], "LstmQueueDescriptor", 2, "input");
+    // In sequence mode the input and the output hold one [batchSize, size] matrix per time step.
+    const unsigned int sequenceDimensions = m_Parameters.m_SequenceMode ? 3 : 2;
+    ValidateTensorNumDimensions(workloadInfo.m_InputTensorInfos[0], "LstmQueueDescriptor", sequenceDimensions, "input");
     ValidateTensorNumDimensions(workloadInfo.m_OutputTensorInfos[0], "LstmQueueDescriptor", 2, "output");
+    if (workloadInfo.m_OutputTensorInfos.size() > 3)
+    {
+        ValidateTensorNumDimensions(workloadInfo.m_OutputTensorInfos[3], "LstmQueueDescriptor", sequenceDimensions,
+                                    "output");
+    }
 
     std::vector<DataType> supportedTypes = {
         DataType::Float16,
@@ -1377,6 +1384,16 @@ void MergeQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
                               "input0",
                               "output");
 
+    std::vector<DataType> supportedTypes = {
+        DataType::Float32,
+        DataType::QuantisedAsymm8,
+        DataType::QuantisedSymm16
+    };
+
+    ValidateDataTypes(workloadInfo.m_InputTensorInfos[0],
+                      supportedTypes,
+                      "MergeQueueDescriptor");
+
     const DataType dataType = workloadInfo.m_InputTensorInfos[0].GetDataType();
     ValidateTensorDataType(workloadInfo.m_InputTensorInfos[1], dataType, "MergeQueueDescriptor", "input1");
     ValidateTensorDataType(workloadInfo.m_OutputTensorInfos[0], dataType, "MergeQueueDescriptor", "output");
@@ -1397,8 +1414,17 @@ void SwitchQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
                       supportedTypes,
                       "SwitchQueueDescriptor");
 
+    // Only the first element of the condition is read, as a boolean.
+    std::vector<DataType> supportedConditionTypes = {
+        DataType::Boolean,
+        DataType::Float32,
+        DataType::Signed32,
+        DataType::QuantisedAsymm8,
+        DataType::QuantisedSymm16
+    };
+
     ValidateDataTypes(workloadInfo.m_InputTensorInfos[1],
-                      supportedTypes,
+                      supportedConditionTypes,
                       "SwitchQueueDescriptor");
 
     ValidateDataTypes(workloadInfo.m_OutputTensorInfos[0],
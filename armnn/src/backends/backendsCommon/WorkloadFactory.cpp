@@ -67,10 +67,6 @@ bool IWorkloadFactory::IsLayerSupported(const BackendId& backendId,
                                         Optional<DataType> dataType,
                                         std::string& outReasonIfUnsupported)
 {
-    Optional<std::string&> reason = outReasonIfUnsupported;
-    bool result;
-    const Layer& layer = *(boost::polymorphic_downcast<const Layer*>(&connectableLayer));
-
     auto const& backendRegistry = BackendRegistryInstance();
     if (!backendRegistry.IsBackendRegistered(backendId))
     {
@@ -84,7 +80,18 @@ bool IWorkloadFactory::IsLayerSupported(const BackendId& backendId,
 
     auto backendFactory = backendRegistry.GetFactory(backendId);
     auto backendObject = backendFactory();
-    auto layerSupportObject = backendObject->GetLayerSupport();
+    return IsLayerSupported(*backendObject->GetLayerSupport(), connectableLayer, dataType, outReasonIfUnsupported);
+}
+
+bool IWorkloadFactory::IsLayerSupported(const ILayerSupport& layerSupport,
+                                        const IConnectableLayer& connectableLayer,
+                                        Optional<DataType> dataType,
+                                        std::string& outReasonIfUnsupported)
+{
+    Optional<std::string&> reason = outReasonIfUnsupported;
+    bool result;
+    const Layer& layer = *(boost::polymorphic_downcast<const Layer*>(&connectableLayer));
+    const ILayerSupport* layerSupportObject = &layerSupport;
 
     switch(layer.GetType())
     {
@@ -811,6 +818,12 @@ bool IWorkloadFactory::IsLayerSupported(const IConnectableLayer& connectableLaye
 }
 
 // Default Implementations
+std::unique_ptr<ITensorHandle> IWorkloadFactory::CreateAliasTensorHandle(ITensorHandle& parent,
+                                                                         const TensorInfo& tensorInfo) const
+{
+    return std::unique_ptr<ITensorHandle>();
+}
+
 std::unique_ptr<IWorkload> IWorkloadFactory::CreateActivation(const ActivationQueueDescriptor& descriptor,
                                                               const WorkloadInfo& info) const
 {
@@ -15,6 +15,7 @@
 namespace armnn
 {
 
+class ILayerSupport;
 class Layer;
 
 // Workload factory interface for compute backends.
@@ -34,6 +35,12 @@ public:
                                  Optional<DataType> dataType,
                                  std::string& outReasonIfUnsupported);
 
+    /// Asks @a layerSupport, the layer support of the backend assigned to the layer, whether the layer is supported.
+    static bool IsLayerSupported(const ILayerSupport& layerSupport,
+                                 const IConnectableLayer& layer,
+                                 Optional<DataType> dataType,
+                                 std::string& outReasonIfUnsupported);
+
     virtual bool SupportsSubTensors() const = 0;
 
     virtual std::unique_ptr<ITensorHandle> CreateSubTensorHandle(ITensorHandle& parent,
@@ -41,6 +48,11 @@ public:
                                                                  unsigned int const* subTensorOrigin
                                                                 ) const = 0;
 
+    /// Creates a handle viewing the memory of @a parent as a tensor of @a tensorInfo, which has the same size.
+    /// Returns nullptr if the backend cannot alias @a parent, in which case the layer copies its input instead.
+    virtual std::unique_ptr<ITensorHandle> CreateAliasTensorHandle(ITensorHandle& parent,
+                                                                   const TensorInfo& tensorInfo) const;
+
     virtual std::unique_ptr<IWorkload> CreateInput(const InputQueueDescriptor& descriptor,
                                                    const WorkloadInfo& info) const = 0;
 
@@ -108,4 +108,36 @@ armnn::ConstTensor ConvertWeightTensorFromArmnnToAcl(const ConstCpuTensorHandle*
     return weightPermuted;
 }
 
+bool IsSwitchConditionTrue(const ITensorHandle& condition, const TensorInfo& conditionInfo)
+{
+    const void* data = condition.Map(true);
+    BOOST_ASSERT_MSG(data, "The condition tensor of a Switch layer has no memory");
+
+    bool isTrue = false;
+    switch (conditionInfo.GetDataType())
+    {
+        case DataType::Boolean:
+            isTrue = *static_cast<const uint8_t*>(data) != 0;
+            break;
+        case DataType::QuantisedAsymm8:
+            isTrue = *static_cast<const uint8_t*>(data) != conditionInfo.GetQuantizationOffset();
+            break;
+        case DataType::QuantisedSymm16:
+            isTrue = *static_cast<const int16_t*>(data) != conditionInfo.GetQuantizationOffset();
+            break;
+        case DataType::Signed32:
+            isTrue = *static_cast<const int32_t*>(data) != 0;
+            break;
+        case DataType::Float32:
+            isTrue = *static_cast<const float*>(data) != 0.0f;
+            break;
+        default:
+            condition.Unmap();
+            throw InvalidArgumentException("The condition of a Switch layer has an unsupported data type");
+    }
+
+    condition.Unmap();
+    return isTrue;
+}
+
 } // namespace armnn
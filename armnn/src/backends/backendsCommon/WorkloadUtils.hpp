@@ -161,4 +161,8 @@ armnn::ConstTensor ConvertWeightTensorFromArmnnToAcl(const ConstCpuTensorHandle*
                                                      DataLayout dataLayout,
                                                      void* permuteBuffer);
 
+/// Returns whether the condition of a Switch layer is true, i.e. whether the first element of @a condition is
+/// non-zero (after dequantization). Reads Boolean, Float32, Signed32, QuantisedAsymm8 and QuantisedSymm16 tensors.
+bool IsSwitchConditionTrue(const ITensorHandle& condition, const TensorInfo& conditionInfo);
+
 } //namespace armnn
@@ -259,6 +259,11 @@ arm_compute::Status NeonLstmFloatWorkloadValidate(const TensorInfo& input,
                                                   const TensorInfo* cellToForgetWeights,
                                                   const TensorInfo* cellToOutputWeights)
 {
+    if (descriptor.m_SequenceMode)
+    {
+        return arm_compute::Status(arm_compute::ErrorCode::RUNTIME_ERROR, "Sequence mode LSTM is not supported");
+    }
+
     arm_compute::LSTMParams<arm_compute::ITensorInfo> lstm_params_info;
 
     // The inputs and the outputs
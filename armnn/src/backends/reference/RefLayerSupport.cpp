@@ -656,7 +656,6 @@ bool RefLayerSupport::IsLstmSupported(const TensorInfo& input,
                                       const TensorInfo* cellToOutputWeights,
                                       Optional<std::string&> reasonIfUnsupported) const
 {
-    ignore_unused(descriptor);
     ignore_unused(inputToForgetWeights);
     ignore_unused(inputToCellWeights);
     ignore_unused(inputToOutputWeights);
@@ -703,6 +702,13 @@ bool RefLayerSupport::IsLstmSupported(const TensorInfo& input,
     supported &= CheckSupportRule(TypesAreEqual(input, output), reasonIfUnsupported,
                                   "Reference Lstm: input and output types are mismatched");
 
+    if (descriptor.m_SequenceMode)
+    {
+        std::array<DataType,1> sequenceTypes = { DataType::Float32 };
+        supported &= CheckSupportRule(TypeAnyOf(input, sequenceTypes), reasonIfUnsupported,
+                                      "Reference Lstm: sequence mode is only supported for Float32.");
+    }
+
     return supported;
 }
 
@@ -753,6 +759,31 @@ bool RefLayerSupport::IsMeanSupported(const TensorInfo& input,
                                      &TrueFunc<>);
 }
 
+bool RefLayerSupport::IsMergeSupported(const TensorInfo& input0,
+                                       const TensorInfo& input1,
+                                       const TensorInfo& output,
+                                       Optional<std::string&> reasonIfUnsupported) const
+{
+    bool supported = true;
+    std::array<DataType,3> supportedTypes =
+    {
+        DataType::Float32,
+        DataType::QuantisedAsymm8,
+        DataType::QuantisedSymm16
+    };
+
+    supported &= CheckSupportRule(TypeAnyOf(input0, supportedTypes), reasonIfUnsupported,
+                                  "Reference merge: input 0 is not a supported type.");
+
+    supported &= CheckSupportRule(TypesAreEqual(input0, input1), reasonIfUnsupported,
+                                  "Reference merge: input 0 and input 1 types are mismatched");
+
+    supported &= CheckSupportRule(TypesAreEqual(input0, output), reasonIfUnsupported,
+                                  "Reference merge: input and output types are mismatched");
+
+    return supported;
+}
+
 bool RefLayerSupport::IsMergerSupported(const std::vector<const TensorInfo*> inputs,
                                         const TensorInfo& output,
                                         const OriginsDescriptor& descriptor,
@@ -1086,4 +1117,42 @@ bool RefLayerSupport::IsSubtractionSupported(const TensorInfo& input0,
     return supported;
 }
 
+bool RefLayerSupport::IsSwitchSupported(const TensorInfo& input0,
+                                        const TensorInfo& input1,
+                                        const TensorInfo& output0,
+                                        const TensorInfo& output1,
+                                        Optional<std::string&> reasonIfUnsupported) const
+{
+    bool supported = true;
+
+    std::array<DataType,3> supportedTypes = {
+        DataType::Float32,
+        DataType::QuantisedAsymm8,
+        DataType::QuantisedSymm16
+    };
+
+    // Only the first element of the condition is read, as a boolean.
+    std::array<DataType,5> supportedConditionTypes = {
+        DataType::Boolean,
+        DataType::Float32,
+        DataType::Signed32,
+        DataType::QuantisedAsymm8,
+        DataType::QuantisedSymm16
+    };
+
+    supported &= CheckSupportRule(TypeAnyOf(input0, supportedTypes), reasonIfUnsupported,
+                                  "Reference switch: input 0 is not a supported type.");
+
+    supported &= CheckSupportRule(TypeAnyOf(input1, supportedConditionTypes), reasonIfUnsupported,
+                                  "Reference switch: the condition is not a supported type.");
+
+    supported &= CheckSupportRule(TypesAreEqual(input0, output0), reasonIfUnsupported,
+                                  "Reference switch: input and output 0 types are mismatched");
+
+    supported &= CheckSupportRule(TypesAreEqual(input0, output1), reasonIfUnsupported,
+                                  "Reference switch: input and output 1 types are mismatched");
+
+    return supported;
+}
+
 } // namespace armnn
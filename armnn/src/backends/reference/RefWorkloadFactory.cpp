@@ -59,6 +59,17 @@ bool RefWorkloadFactory::IsLayerSupported(const Layer& layer,
     return IWorkloadFactory::IsLayerSupported(s_Id, layer, dataType, outReasonIfUnsupported);
 }
 
+std::unique_ptr<ITensorHandle> RefWorkloadFactory::CreateAliasTensorHandle(ITensorHandle& parent,
+                                                                           const TensorInfo& tensorInfo) const
+{
+    CpuTensorHandle* cpuParent = dynamic_cast<CpuTensorHandle*>(&parent);
+    if (!cpuParent || cpuParent->GetTensorInfo().GetNumBytes() != tensorInfo.GetNumBytes())
+    {
+        return nullptr;
+    }
+    return std::make_unique<AliasCpuTensorHandle>(tensorInfo, *cpuParent);
+}
+
 std::unique_ptr<ITensorHandle> RefWorkloadFactory::CreateTensorHandle(const TensorInfo& tensorInfo) const
 {
     return std::make_unique<ScopedCpuTensorHandle>(tensorInfo);
@@ -403,4 +414,16 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateDequantize(const Dequantize
     return std::make_unique<RefDequantizeWorkload>(descriptor, info);
 }
 
+std::unique_ptr<IWorkload> RefWorkloadFactory::CreateMerge(const MergeQueueDescriptor& descriptor,
+                                                           const WorkloadInfo& info) const
+{
+    return std::make_unique<RefMergeWorkload>(descriptor, info);
+}
+
+std::unique_ptr<IWorkload> RefWorkloadFactory::CreateSwitch(const SwitchQueueDescriptor& descriptor,
+                                                            const WorkloadInfo& info) const
+{
+    return std::make_unique<RefSwitchWorkload>(descriptor, info);
+}
+
 } // namespace armnn
@@ -12,18 +12,23 @@ BACKEND_SOURCES := \
         RefLayerSupport.cpp \
         RefWorkloadFactory.cpp \
         workloads/Activation.cpp \
+        workloads/BatchNormImpl.cpp \
         workloads/BatchToSpaceNd.cpp \
         workloads/Broadcast.cpp \
         workloads/ConvImpl.cpp \
+        workloads/CopyPlan.cpp \
         workloads/Debug.cpp \
         workloads/DetectionPostProcess.cpp \
         workloads/ElementwiseFunction.cpp \
         workloads/FullyConnected.cpp \
         workloads/Gather.cpp \
+        workloads/Lstm.cpp \
         workloads/Mean.cpp \
         workloads/Merger.cpp \
+        workloads/Normalization.cpp \
         workloads/Pad.cpp \
         workloads/Pooling2d.cpp \
+        workloads/Reduce.cpp \
         workloads/RefActivationWorkload.cpp \
         workloads/RefBatchNormalizationFloat32Workload.cpp \
         workloads/RefBatchNormalizationUint8Workload.cpp \
@@ -49,6 +54,7 @@ BACKEND_SOURCES := \
         workloads/RefLstmWorkload.cpp \
         workloads/RefMeanFloat32Workload.cpp \
         workloads/RefMeanUint8Workload.cpp \
+        workloads/RefMergeWorkload.cpp \
         workloads/RefNormalizationFloat32Workload.cpp \
         workloads/RefPadWorkload.cpp \
         workloads/RefPermuteWorkload.cpp \
@@ -64,9 +70,10 @@ BACKEND_SOURCES := \
         workloads/RefSoftmaxUint8Workload.cpp \
         workloads/RefSpaceToBatchNdWorkload.cpp \
         workloads/RefStridedSliceWorkload.cpp \
+        workloads/RefSwitchWorkload.cpp \
         workloads/RefSplitterFloat32Workload.cpp \
         workloads/RefSplitterUint8Workload.cpp \
-        workloads/ResizeBilinear.cpp \
+        workloads/Resize.cpp \
         workloads/Rsqrt.cpp \
         workloads/SpaceToBatchNd.cpp \
         workloads/StridedSlice.cpp \
@@ -81,6 +88,7 @@ BACKEND_TEST_SOURCES := \
         test/RefCreateWorkloadTests.cpp \
         test/RefEndToEndTests.cpp \
         test/RefJsonPrinterTests.cpp \
+        test/RefKernelTests.cpp \
         test/RefLayerSupportTests.cpp \
         test/RefLayerTests.cpp \
         test/RefOptimizedNetworkTests.cpp \
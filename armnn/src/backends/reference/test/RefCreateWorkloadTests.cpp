@@ -758,4 +758,52 @@ BOOST_AUTO_TEST_CASE(CreateConstantSigned32Workload)
     RefCreateConstantWorkloadTest<RefConstantWorkload, armnn::DataType::Signed32>({ 2, 3, 2, 10 });
 }
 
+BOOST_AUTO_TEST_CASE(CreateInPlaceWorkloads)
+{
+    // The input is also read by the addition, so the activation cannot overwrite it. The addition is the only reader
+    // of the output of the activation, so it writes its output over it.
+    Graph graph;
+    RefWorkloadFactory factory;
+
+    ActivationDescriptor reluDesc;
+    reluDesc.m_Function = ActivationFunction::ReLu;
+
+    Layer* const input  = graph.AddLayer<InputLayer>(0, "input");
+    Layer* const relu   = graph.AddLayer<ActivationLayer>(reluDesc, "relu");
+    Layer* const add    = graph.AddLayer<AdditionLayer>("add");
+    Layer* const output = graph.AddLayer<OutputLayer>(0, "output");
+
+    TensorInfo tensorInfo({ 1, 4 }, DataType::Float32);
+    Connect(input, relu, tensorInfo);
+    Connect(relu, add, tensorInfo, 0, 0);
+    Connect(input, add, tensorInfo, 0, 1);
+    Connect(add, output, tensorInfo);
+    CreateTensorHandles(graph, factory);
+
+    BOOST_TEST(!relu->IsExecutedInPlace());
+    BOOST_TEST(add->IsExecutedInPlace());
+    BOOST_TEST(add->GetOutputHandler().GetData()->GetParent() == relu->GetOutputHandler().GetData());
+
+    graph.AllocateDynamicBuffers();
+    BOOST_TEST(graph.GetTensorMemoryUsage().m_TotalBytes == 2 * tensorInfo.GetNumBytes());
+    BOOST_TEST(graph.GetTensorMemoryUsage().m_PeakBytes == 2 * tensorInfo.GetNumBytes());
+
+    auto reluWorkload = MakeAndCheckWorkload<RefActivationWorkload>(*relu, graph, factory);
+    auto addWorkload = MakeAndCheckWorkload<RefAdditionWorkload>(*add, graph, factory);
+    reluWorkload->PostAllocationConfigure();
+    addWorkload->PostAllocationConfigure();
+
+    const std::vector<float> inputData { -1.f, 2.f, -3.f, 4.f };
+    std::copy(inputData.begin(), inputData.end(),
+              boost::polymorphic_downcast<CpuTensorHandle*>(input->GetOutputHandler().GetData())->GetTensor<float>());
+
+    reluWorkload->Execute();
+    addWorkload->Execute();
+
+    const float* outputData =
+        boost::polymorphic_downcast<CpuTensorHandle*>(add->GetOutputHandler().GetData())->GetTensor<float>();
+    const std::vector<float> expectedOutput { -1.f, 4.f, -3.f, 8.f };
+    BOOST_TEST(std::vector<float>(outputData, outputData + 4) == expectedOutput, boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -10,6 +10,87 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <random>
+
+namespace
+{
+
+/// The pairwise NMS formulation, kept as the reference for the optimized one.
+std::vector<unsigned int> PairwiseNonMaxSuppression(unsigned int numBoxes, const std::vector<float>& boxCorners,
+                                                    const std::vector<float>& scores, float nmsScoreThreshold,
+                                                    unsigned int maxDetection, float nmsIouThreshold)
+{
+    std::vector<float> scoresAboveThreshold;
+    std::vector<unsigned int> indicesAboveThreshold;
+    for (unsigned int i = 0; i < numBoxes; ++i)
+    {
+        if (scores[i] >= nmsScoreThreshold)
+        {
+            scoresAboveThreshold.push_back(scores[i]);
+            indicesAboveThreshold.push_back(i);
+        }
+    }
+
+    unsigned int numAboveThreshold = boost::numeric_cast<unsigned int>(scoresAboveThreshold.size());
+    std::vector<unsigned int> sortedIndices = GenerateRangeK(numAboveThreshold);
+    TopKSort(numAboveThreshold, sortedIndices.data(), scoresAboveThreshold.data(), numAboveThreshold);
+
+    unsigned int numOutput = std::min(maxDetection, numAboveThreshold);
+    std::vector<unsigned int> outputIndices;
+    std::vector<bool> visited(numAboveThreshold, false);
+    for (unsigned int i = 0; i < numAboveThreshold; ++i)
+    {
+        if (outputIndices.size() >= numOutput)
+        {
+            break;
+        }
+        if (!visited[sortedIndices[i]])
+        {
+            outputIndices.push_back(indicesAboveThreshold[sortedIndices[i]]);
+        }
+        for (unsigned int j = i + 1; j < numAboveThreshold; ++j)
+        {
+            unsigned int iIndex = indicesAboveThreshold[sortedIndices[i]] * 4;
+            unsigned int jIndex = indicesAboveThreshold[sortedIndices[j]] * 4;
+            if (IntersectionOverUnion(&boxCorners[iIndex], &boxCorners[jIndex]) > nmsIouThreshold)
+            {
+                visited[sortedIndices[j]] = true;
+            }
+        }
+    }
+    return outputIndices;
+}
+
+/// Random, heavily overlapping boxes in box-corner format, with scores drawn from few values so that ties occur.
+void MakeRandomBoxes(std::mt19937& generator, unsigned int numBoxes, unsigned int numScoresPerBox,
+                     std::vector<float>& boxCorners, std::vector<float>& scores)
+{
+    std::uniform_real_distribution<float> centre(0.0f, 4.0f);
+    std::uniform_real_distribution<float> size(0.5f, 2.0f);
+    std::uniform_int_distribution<int> score(0, 20);
+
+    boxCorners.resize(numBoxes * 4);
+    for (unsigned int i = 0; i < numBoxes; ++i)
+    {
+        const float yCentre = centre(generator);
+        const float xCentre = centre(generator);
+        const float halfH = size(generator) * 0.5f;
+        const float halfW = size(generator) * 0.5f;
+        boxCorners[i * 4] = yCentre - halfH;
+        boxCorners[i * 4 + 1] = xCentre - halfW;
+        boxCorners[i * 4 + 2] = yCentre + halfH;
+        boxCorners[i * 4 + 3] = xCentre + halfW;
+    }
+
+    scores.resize(numBoxes * numScoresPerBox);
+    for (float& value : scores)
+    {
+        value = static_cast<float>(score(generator)) / 20.0f;
+    }
+}
+
+} // anonymous namespace
+
 BOOST_AUTO_TEST_SUITE(RefDetectionPostProcess)
 
 
@@ -169,4 +250,104 @@ BOOST_AUTO_TEST_CASE(FastNmsDetectionPostProcess)
                                  expectedDetectionScores, expectedNumDetections);
 }
 
+BOOST_AUTO_TEST_CASE(NmsMatchesPairwiseReference)
+{
+    std::mt19937 generator(42);
+    NmsScratch scratch;
+
+    for (unsigned int numBoxes : { 0u, 1u, 7u, 64u, 300u })
+    {
+        std::vector<float> boxCorners;
+        std::vector<float> scores;
+        MakeRandomBoxes(generator, numBoxes, 1, boxCorners, scores);
+
+        for (float scoreThreshold : { 0.0f, 0.5f })
+        {
+            for (float iouThreshold : { 0.0f, 0.3f, 0.7f })
+            {
+                for (unsigned int maxDetection : { 1u, 10u, 1000u })
+                {
+                    const std::vector<unsigned int> expected =
+                        PairwiseNonMaxSuppression(numBoxes, boxCorners, scores, scoreThreshold, maxDetection,
+                                                  iouThreshold);
+
+                    BOOST_TEST(NonMaxSuppression(numBoxes, boxCorners, scores, scoreThreshold, maxDetection,
+                                                 iouThreshold) == expected);
+
+                    // The same scratch space is reused across calls of different sizes.
+                    NonMaxSuppression(numBoxes, boxCorners.data(), [&scores](unsigned int i) { return scores[i]; },
+                                      scoreThreshold, maxDetection, iouThreshold, scratch);
+                    BOOST_TEST(scratch.m_Output == expected);
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RegularNmsIsIndependentOfThreadCount)
+{
+    const unsigned int numBoxes = 200;
+    const unsigned int numClasses = 12;
+
+    std::mt19937 generator(7);
+    std::vector<float> boxCorners;
+    std::vector<float> scores;
+    MakeRandomBoxes(generator, numBoxes, numClasses + 1, boxCorners, scores);
+
+    // Zero encodings with unit-scale anchors at the box centres decode to boxes of the anchor size.
+    std::vector<float> boxEncodings(numBoxes * 4, 0.0f);
+    std::vector<float> anchors(numBoxes * 4);
+    for (unsigned int i = 0; i < numBoxes; ++i)
+    {
+        anchors[i * 4] = (boxCorners[i * 4] + boxCorners[i * 4 + 2]) * 0.5f;
+        anchors[i * 4 + 1] = (boxCorners[i * 4 + 1] + boxCorners[i * 4 + 3]) * 0.5f;
+        anchors[i * 4 + 2] = boxCorners[i * 4 + 2] - boxCorners[i * 4];
+        anchors[i * 4 + 3] = boxCorners[i * 4 + 3] - boxCorners[i * 4 + 1];
+    }
+
+    armnn::DetectionPostProcessDescriptor desc;
+    desc.m_UseRegularNms = true;
+    desc.m_MaxDetections = 50;
+    desc.m_DetectionsPerClass = 10;
+    desc.m_NmsScoreThreshold = 0.3f;
+    desc.m_NmsIouThreshold = 0.4f;
+    desc.m_NumClasses = numClasses;
+    desc.m_ScaleY = 10.0f;
+    desc.m_ScaleX = 10.0f;
+    desc.m_ScaleH = 5.0f;
+    desc.m_ScaleW = 5.0f;
+
+    armnn::TensorInfo boxEncodingsInfo({ 1, numBoxes, 4 }, armnn::DataType::Float32);
+    armnn::TensorInfo scoresInfo({ 1, numBoxes, numClasses + 1 }, armnn::DataType::Float32);
+    armnn::TensorInfo anchorsInfo({ numBoxes, 4 }, armnn::DataType::Float32);
+    armnn::TensorInfo detectionBoxesInfo({ 1, desc.m_MaxDetections, 4 }, armnn::DataType::Float32);
+    armnn::TensorInfo detectionScoresInfo({ 1, desc.m_MaxDetections }, armnn::DataType::Float32);
+    armnn::TensorInfo detectionClassesInfo({ 1, desc.m_MaxDetections }, armnn::DataType::Float32);
+    armnn::TensorInfo numDetectionInfo({ 1 }, armnn::DataType::Float32);
+
+    auto run = [&](unsigned int numThreads)
+    {
+        const unsigned int previousThreadCount = armnnUtils::GetParallelForThreadCount();
+        armnnUtils::SetParallelForThreadCount(numThreads);
+
+        std::vector<float> outputs(desc.m_MaxDetections * 6 + 1);
+        float* detectionBoxes = outputs.data();
+        float* detectionScores = detectionBoxes + desc.m_MaxDetections * 4;
+        float* detectionClasses = detectionScores + desc.m_MaxDetections;
+        float* numDetections = detectionClasses + desc.m_MaxDetections;
+        armnn::DetectionPostProcess(boxEncodingsInfo, scoresInfo, anchorsInfo,
+                                    detectionBoxesInfo, detectionClassesInfo,
+                                    detectionScoresInfo, numDetectionInfo, desc,
+                                    boxEncodings.data(), scores.data(), anchors.data(),
+                                    detectionBoxes, detectionClasses, detectionScores, numDetections);
+
+        armnnUtils::SetParallelForThreadCount(previousThreadCount);
+        return outputs;
+    };
+
+    const std::vector<float> singleThreaded = run(1);
+    BOOST_TEST(singleThreaded.back() > 0.0f);
+    BOOST_TEST(run(4) == singleThreaded);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -165,6 +165,89 @@ BOOST_AUTO_TEST_CASE(TrivialAdd)
     BOOST_TEST(outputData[11] == 1212);
 }
 
+BOOST_AUTO_TEST_CASE(ReshapeViewsItsInput)
+{
+    // The Reshape layers run no workload: their outputs are views of the tensors they reshape.
+
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    armnn::INetworkPtr net(INetwork::Create());
+
+    ReshapeDescriptor flatten;
+    flatten.m_TargetShape = TensorShape({ 12 });
+    ReshapeDescriptor squeeze;
+    squeeze.m_TargetShape = TensorShape({ 2, 6 });
+
+    IConnectableLayer* input1   = net->AddInputLayer(0);
+    IConnectableLayer* input2   = net->AddInputLayer(1);
+    IConnectableLayer* reshape1 = net->AddReshapeLayer(flatten, "flattenInput");
+    IConnectableLayer* add      = net->AddAdditionLayer();
+    IConnectableLayer* reshape2 = net->AddReshapeLayer(squeeze, "squeezeSum");
+    IConnectableLayer* output1  = net->AddOutputLayer(0);
+    IConnectableLayer* output2  = net->AddOutputLayer(1);
+
+    input1->GetOutputSlot(0).Connect(reshape1->GetInputSlot(0));
+    reshape1->GetOutputSlot(0).Connect(output1->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    input2->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(reshape2->GetInputSlot(0));
+    reshape2->GetOutputSlot(0).Connect(output2->GetInputSlot(0));
+
+    TensorInfo tensorInfo(TensorShape({ 1, 3, 4 }), DataType::Float32);
+    input1->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    input2->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    add->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    reshape1->GetOutputSlot(0).SetTensorInfo(TensorInfo(flatten.m_TargetShape, DataType::Float32));
+    reshape2->GetOutputSlot(0).SetTensorInfo(TensorInfo(squeeze.m_TargetShape, DataType::Float32));
+
+    IOptimizedNetworkPtr optNet = Optimize(*net, defaultBackends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // The views are observed like any other output.
+    TensorStatisticsCollector collector;
+    runtime->SetTensorObserver(netId, collector.GetObserver(), { reshape1->GetGuid(), reshape2->GetGuid() });
+    runtime->EnableTensorObservation(netId, true);
+
+    std::vector<float> input1Data { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f };
+    std::vector<float> input2Data(12, 100.f);
+    std::vector<float> output1Data(12);
+    std::vector<float> output2Data(12);
+
+    InputTensors inputTensors
+    {
+        {0, armnn::ConstTensor(runtime->GetInputTensorInfo(netId, 0), input1Data.data())},
+        {1, armnn::ConstTensor(runtime->GetInputTensorInfo(netId, 1), input2Data.data())}
+    };
+    OutputTensors outputTensors
+    {
+        {0, armnn::Tensor(runtime->GetOutputTensorInfo(netId, 0), output1Data.data())},
+        {1, armnn::Tensor(runtime->GetOutputTensorInfo(netId, 1), output2Data.data())}
+    };
+
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+
+    for (unsigned int i = 0; i < 12; ++i)
+    {
+        BOOST_TEST(output1Data[i] == input1Data[i]);
+        BOOST_TEST(output2Data[i] == input1Data[i] + 100.f);
+    }
+
+    TensorStatistics flattened = collector.GetStatistics(reshape1->GetGuid(), 0);
+    BOOST_TEST(flattened.m_NumObservations == 1);
+    BOOST_TEST(flattened.m_Min == 1.f);
+    BOOST_TEST(flattened.m_Max == 12.f);
+
+    TensorStatistics squeezed = collector.GetStatistics(reshape2->GetGuid(), 0);
+    BOOST_TEST(squeezed.m_NumObservations == 1);
+    BOOST_TEST(squeezed.m_Min == 101.f);
+    BOOST_TEST(squeezed.m_Max == 112.f);
+}
+
 BOOST_AUTO_TEST_CASE(MultipleOutputs)
 {
     using namespace armnn;
@@ -619,4 +702,144 @@ BOOST_AUTO_TEST_CASE(RefDetectionPostProcessFastNmsUint8Test)
                                                                           1.0f, 1, 0.01f, 0, 0.5f, 0);
 }
 
+namespace
+{
+
+/// Runs a CIFG LSTM with the given descriptor over @a input and returns its output, for a network whose input and
+/// output shapes are given. The output state and cell state inputs start at zero.
+std::vector<float> RunLstmNetwork(const armnn::LstmDescriptor& descriptor,
+                                  const armnn::TensorShape& inputShape,
+                                  const armnn::TensorShape& outputShape,
+                                  const std::vector<float>& input)
+{
+    using namespace armnn;
+
+    const unsigned int batchSize = 2;
+    const unsigned int inputSize = inputShape[inputShape.GetNumDimensions() - 1];
+    const unsigned int numUnits = 3;
+
+    std::vector<float> inputWeights(numUnits * inputSize);
+    std::vector<float> recurrentWeights(numUnits * numUnits);
+    std::vector<float> bias(numUnits);
+    for (unsigned int i = 0; i < inputWeights.size(); ++i)
+    {
+        inputWeights[i] = 0.1f * static_cast<float>(i % 5) - 0.2f;
+    }
+    for (unsigned int i = 0; i < recurrentWeights.size(); ++i)
+    {
+        recurrentWeights[i] = 0.05f * static_cast<float>(i % 7) - 0.15f;
+    }
+    for (unsigned int i = 0; i < bias.size(); ++i)
+    {
+        bias[i] = 0.1f * static_cast<float>(i);
+    }
+
+    const ConstTensor inputWeightsTensor(TensorInfo({ numUnits, inputSize }, DataType::Float32), inputWeights);
+    const ConstTensor recurrentWeightsTensor(TensorInfo({ numUnits, numUnits }, DataType::Float32), recurrentWeights);
+    const ConstTensor biasTensor(TensorInfo({ numUnits }, DataType::Float32), bias);
+
+    LstmInputParams params;
+    params.m_InputToForgetWeights = &inputWeightsTensor;
+    params.m_InputToCellWeights = &inputWeightsTensor;
+    params.m_InputToOutputWeights = &inputWeightsTensor;
+    params.m_RecurrentToForgetWeights = &recurrentWeightsTensor;
+    params.m_RecurrentToCellWeights = &recurrentWeightsTensor;
+    params.m_RecurrentToOutputWeights = &recurrentWeightsTensor;
+    params.m_ForgetGateBias = &biasTensor;
+    params.m_CellBias = &biasTensor;
+    params.m_OutputGateBias = &biasTensor;
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* lstm = net->AddLstmLayer(descriptor, params, "lstm");
+
+    const TensorInfo inputInfo(inputShape, DataType::Float32);
+    const TensorInfo stateInfo({ batchSize, numUnits }, DataType::Float32);
+    const TensorInfo outputInfos[] = { TensorInfo({ batchSize, numUnits * 3 }, DataType::Float32),
+                                       stateInfo,
+                                       stateInfo,
+                                       TensorInfo(outputShape, DataType::Float32) };
+    const TensorInfo inputInfos[] = { inputInfo, stateInfo, stateInfo };
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        IConnectableLayer* inputLayer = net->AddInputLayer(static_cast<LayerBindingId>(i));
+        inputLayer->GetOutputSlot(0).SetTensorInfo(inputInfos[i]);
+        inputLayer->GetOutputSlot(0).Connect(lstm->GetInputSlot(i));
+    }
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        IConnectableLayer* outputLayer = net->AddOutputLayer(static_cast<LayerBindingId>(i));
+        lstm->GetOutputSlot(i).SetTensorInfo(outputInfos[i]);
+        lstm->GetOutputSlot(i).Connect(outputLayer->GetInputSlot(0));
+    }
+
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    NetworkId networkId;
+    BOOST_TEST_REQUIRE((runtime->LoadNetwork(networkId, Optimize(*net, defaultBackends, runtime->GetDeviceSpec()))
+                        == Status::Success));
+
+    const std::vector<float> zeroState(stateInfo.GetNumElements(), 0.0f);
+    std::vector<float> scratch(outputInfos[0].GetNumElements());
+    std::vector<float> outputState(stateInfo.GetNumElements());
+    std::vector<float> cellState(stateInfo.GetNumElements());
+    std::vector<float> output(outputInfos[3].GetNumElements());
+
+    InputTensors inputTensors
+    {
+        { 0, ConstTensor(runtime->GetInputTensorInfo(networkId, 0), input.data()) },
+        { 1, ConstTensor(runtime->GetInputTensorInfo(networkId, 1), zeroState.data()) },
+        { 2, ConstTensor(runtime->GetInputTensorInfo(networkId, 2), zeroState.data()) }
+    };
+    OutputTensors outputTensors
+    {
+        { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), scratch.data()) },
+        { 1, Tensor(runtime->GetOutputTensorInfo(networkId, 1), outputState.data()) },
+        { 2, Tensor(runtime->GetOutputTensorInfo(networkId, 2), cellState.data()) },
+        { 3, Tensor(runtime->GetOutputTensorInfo(networkId, 3), output.data()) }
+    };
+    runtime->EnqueueWorkload(networkId, inputTensors, outputTensors);
+    return output;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(RefLstmSequenceModeMatchesStepByStep)
+{
+    using namespace armnn;
+
+    const unsigned int numSteps = 3;
+    const unsigned int batchSize = 2;
+    const unsigned int inputSize = 4;
+    const unsigned int numUnits = 3;
+
+    std::vector<float> sequence(numSteps * batchSize * inputSize);
+    for (unsigned int i = 0; i < sequence.size(); ++i)
+    {
+        sequence[i] = 0.25f * static_cast<float>(i % 9) - 1.0f;
+    }
+
+    LstmDescriptor descriptor;
+    descriptor.m_ActivationFunc = 4;
+    descriptor.m_SequenceMode = true;
+    const std::vector<float> sequenceOutput = RunLstmNetwork(descriptor,
+                                                             TensorShape({ numSteps, batchSize, inputSize }),
+                                                             TensorShape({ numSteps, batchSize, numUnits }),
+                                                             sequence);
+
+    // A single step network sees a zero state, so it reproduces the first step of the sequence.
+    descriptor.m_SequenceMode = false;
+    const std::vector<float> firstStep(sequence.begin(), sequence.begin() + static_cast<std::ptrdiff_t>(batchSize * inputSize));
+    const std::vector<float> stepOutput = RunLstmNetwork(descriptor,
+                                                         TensorShape({ batchSize, inputSize }),
+                                                         TensorShape({ batchSize, numUnits }),
+                                                         firstStep);
+
+    BOOST_TEST(sequenceOutput.size() == numSteps * batchSize * numUnits);
+    for (unsigned int i = 0; i < stepOutput.size(); ++i)
+    {
+        BOOST_TEST(sequenceOutput[i] == stepOutput[i]);
+    }
+    // Later steps see the state of the earlier ones.
+    BOOST_TEST(!std::equal(stepOutput.begin(), stepOutput.end(), &sequenceOutput[stepOutput.size()]));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
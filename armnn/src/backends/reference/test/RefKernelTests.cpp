@@ -0,0 +1,1139 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/Activation.hpp>
+#include <reference/workloads/BatchToSpaceNd.hpp>
+#include <reference/workloads/Broadcast.hpp>
+#include <reference/workloads/CopyPlan.hpp>
+#include <reference/workloads/ElementwiseFunction.hpp>
+#include <reference/workloads/FastMath.hpp>
+#include <reference/workloads/Lstm.hpp>
+#include <reference/workloads/Maximum.hpp>
+#include <reference/workloads/Mean.hpp>
+#include <reference/workloads/Normalization.hpp>
+#include <reference/workloads/Pad.hpp>
+#include <reference/workloads/Reduce.hpp>
+#include <reference/workloads/Resize.hpp>
+#include <reference/workloads/Softmax.hpp>
+#include <reference/workloads/SpaceToBatchNd.hpp>
+#include <reference/workloads/StridedSlice.hpp>
+
+#include <ParallelFor.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+#include <armnn/TypesUtils.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace armnn;
+
+namespace
+{
+
+// The FastMath error bounds were measured over every float. Re-checking all 2^32 of them would dominate the unit
+// test run, so the scans below visit every 1021st bit pattern: about eight thousand values in every binade.
+constexpr uint32_t g_ScanStride = 1021;
+
+template <typename Function>
+void ForEachFloat(float lo, float hi, Function function)
+{
+    for (uint64_t bits = 0; bits <= 0xFFFFFFFFull; bits += g_ScanStride)
+    {
+        const uint32_t pattern = static_cast<uint32_t>(bits);
+        float x;
+        std::memcpy(&x, &pattern, sizeof(x));
+        if (std::isfinite(x) && x >= lo && x <= hi)
+        {
+            function(x);
+        }
+    }
+}
+
+void ReferenceSoftmax(const std::vector<float>& in, std::vector<float>& out, unsigned int numChannels, float beta)
+{
+    for (unsigned int offset = 0; offset < in.size(); offset += numChannels)
+    {
+        double max = in[offset];
+        for (unsigned int c = 1; c < numChannels; ++c)
+        {
+            max = std::max(max, static_cast<double>(in[offset + c]));
+        }
+        double sum = 0.0;
+        for (unsigned int c = 0; c < numChannels; ++c)
+        {
+            sum += std::exp((in[offset + c] - max) * beta);
+        }
+        for (unsigned int c = 0; c < numChannels; ++c)
+        {
+            out[offset + c] = static_cast<float>(std::exp((in[offset + c] - max) * beta) / sum);
+        }
+    }
+}
+
+/// Applies func elementwise with numpy-style broadcasting, one element at a time from the coordinates.
+template <typename Functor>
+std::vector<float> ReferenceElementwise(const TensorShape& shape0, const std::vector<float>& in0,
+                                        const TensorShape& shape1, const std::vector<float>& in1,
+                                        const TensorShape& outShape)
+{
+    Functor func;
+    std::vector<float> out(outShape.GetNumElements());
+    for (unsigned int index = 0; index < out.size(); ++index)
+    {
+        unsigned int remainder = index;
+        unsigned int offset0 = 0;
+        unsigned int offset1 = 0;
+        unsigned int stride0 = 1;
+        unsigned int stride1 = 1;
+        for (unsigned int d = outShape.GetNumDimensions(); d-- > 0;)
+        {
+            const unsigned int coord = remainder % outShape[d];
+            remainder /= outShape[d];
+            offset0 += (shape0[d] > 1 ? coord : 0) * stride0;
+            offset1 += (shape1[d] > 1 ? coord : 0) * stride1;
+            stride0 *= shape0[d];
+            stride1 *= shape1[d];
+        }
+        out[index] = static_cast<float>(func(in0[offset0], in1[offset1]));
+    }
+    return out;
+}
+
+std::vector<float> MakeSequence(unsigned int numElements, float scale)
+{
+    std::vector<float> values(numElements);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        values[i] = (static_cast<float>((i * 7) % 13) - 6.0f) * scale;
+    }
+    return values;
+}
+
+struct BroadcastCase
+{
+    TensorShape m_Shape0;
+    TensorShape m_Shape1;
+    TensorShape m_OutShape;
+    unsigned int m_CollapsedDimensions;
+};
+
+const std::vector<BroadcastCase>& GetBroadcastCases()
+{
+    static const std::vector<BroadcastCase> cases =
+    {
+        { { 2, 3, 4, 5 }, { 2, 3, 4, 5 }, { 2, 3, 4, 5 }, 1 }, // same shape
+        { { 2, 3, 4, 5 }, { 1, 1, 1, 1 }, { 2, 3, 4, 5 }, 1 }, // scalar
+        { { 1, 1, 1, 1 }, { 2, 3, 4, 5 }, { 2, 3, 4, 5 }, 1 },
+        { { 2, 3, 4, 5 }, { 1, 1, 1, 5 }, { 2, 3, 4, 5 }, 2 }, // row
+        { { 2, 3, 4, 5 }, { 2, 3, 4, 1 }, { 2, 3, 4, 5 }, 2 }, // column
+        { { 1, 3, 1, 5 }, { 2, 1, 4, 1 }, { 2, 3, 4, 5 }, 4 }, // both operands broadcast
+        { { 2, 3, 1, 5 }, { 1, 3, 4, 5 }, { 2, 3, 4, 5 }, 4 },
+        { { 1, 1 },       { 1, 1 },       { 1, 1 },       1 }, // single element
+        { { 64, 600 },    { 1, 600 },     { 64, 600 },    2 }, // large enough to be split across threads
+    };
+    return cases;
+}
+
+/// Reduces one element at a time, from the coordinates, into the output given by the kept coordinates.
+template <typename T, typename AccType>
+std::vector<AccType> ReferenceReduce(const TensorShape& shape, const std::vector<T>& in,
+                                     const std::vector<unsigned int>& axis, ReduceOperation operation)
+{
+    std::vector<bool> isReduced(shape.GetNumDimensions(), axis.empty());
+    for (unsigned int dim : axis)
+    {
+        isReduced[dim] = true;
+    }
+
+    std::vector<AccType> out;
+    std::vector<bool> seen;
+    for (unsigned int index = 0; index < in.size(); ++index)
+    {
+        unsigned int remainder = index;
+        unsigned int outIndex = 0;
+        unsigned int outStride = 1;
+        for (unsigned int d = shape.GetNumDimensions(); d-- > 0;)
+        {
+            const unsigned int coord = remainder % shape[d];
+            remainder /= shape[d];
+            if (!isReduced[d])
+            {
+                outIndex += coord * outStride;
+                outStride *= shape[d];
+            }
+        }
+        if (out.size() < outStride)
+        {
+            out.resize(outStride);
+            seen.resize(outStride, false);
+        }
+
+        const AccType value = static_cast<AccType>(in[index]);
+        if (!seen[outIndex])
+        {
+            out[outIndex] = value;
+            seen[outIndex] = true;
+        }
+        else if (operation == ReduceOperation::Sum)
+        {
+            out[outIndex] = out[outIndex] + value;
+        }
+        else if (operation == ReduceOperation::Max)
+        {
+            out[outIndex] = std::max(out[outIndex], value);
+        }
+        else
+        {
+            out[outIndex] = std::min(out[outIndex], value);
+        }
+    }
+    return out;
+}
+
+struct ReduceCase
+{
+    TensorShape m_Shape;
+    std::vector<unsigned int> m_Axis;
+    unsigned int m_NumPasses;
+};
+
+const std::vector<ReduceCase>& GetReduceCases()
+{
+    static const std::vector<ReduceCase> cases =
+    {
+        { { 2, 3, 4, 5 },    {},           1 }, // everything
+        { { 2, 7, 7, 64 },   { 1, 2 },     1 }, // NHWC spatial mean
+        { { 2, 64, 7, 7 },   { 2, 3 },     1 }, // NCHW spatial mean
+        { { 2, 3, 4, 5 },    { 3 },        1 }, // innermost
+        { { 2, 3, 4, 5 },    { 0 },        1 }, // outermost
+        { { 2, 1, 4, 5 },    { 1, 2 },     1 }, // size-1 dimension between reduced ones
+        { { 2, 3, 4, 5 },    { 0, 2 },     2 }, // separate reduced runs
+        { { 2, 3, 4, 5 },    { 1, 3 },     2 },
+        { { 3, 1, 1, 2 },    { 1, 2 },     1 }, // reduces nothing but size-1 dimensions
+        { { 1, 3000, 40 },   { 1 },        1 }, // a single outer index, split over threads by blocks
+        { { 300, 300 },      { 1 },        1 }, // contiguous runs, split over threads by outputs
+    };
+    return cases;
+}
+
+/// Pads one element at a time, from the coordinates.
+std::vector<float> ReferencePad(const TensorShape& inShape, const std::vector<float>& in,
+                                const std::vector<std::pair<unsigned int, unsigned int>>& padList,
+                                const TensorShape& outShape)
+{
+    std::vector<float> out(outShape.GetNumElements(), 0.0f);
+    for (unsigned int index = 0; index < in.size(); ++index)
+    {
+        unsigned int remainder = index;
+        unsigned int outIndex = 0;
+        unsigned int outStride = 1;
+        for (unsigned int d = inShape.GetNumDimensions(); d-- > 0;)
+        {
+            const unsigned int coord = remainder % inShape[d];
+            remainder /= inShape[d];
+            outIndex += (coord + padList[d].first) * outStride;
+            outStride *= outShape[d];
+        }
+        out[outIndex] = in[index];
+    }
+    return out;
+}
+
+/// The weights of an LSTM layer, kept as floats for the reference and as tensor handles for the kernel.
+struct LstmWeights
+{
+    LstmWeights(unsigned int inputSize, unsigned int cellSize, unsigned int outputSize, const LstmDescriptor& parameters)
+        : m_Parameters(parameters)
+    {
+        const unsigned int numGates = 4;
+        float scale = 0.11f;
+        for (unsigned int gate = 0; gate < numGates; ++gate)
+        {
+            m_InputWeights.push_back(MakeSequence(cellSize * inputSize, scale));
+            m_RecurrentWeights.push_back(MakeSequence(cellSize * outputSize, -0.5f * scale));
+            m_Biases.push_back(MakeSequence(cellSize, 0.05f * static_cast<float>(gate + 1)));
+            m_CellWeights.push_back(MakeSequence(cellSize, 0.07f - 0.03f * static_cast<float>(gate)));
+            scale *= 0.8f;
+        }
+        m_Projection = MakeSequence(outputSize * cellSize, 0.09f);
+        m_ProjectionBias = MakeSequence(outputSize, 0.02f);
+
+        const TensorInfo inputInfo({ cellSize, inputSize }, DataType::Float32);
+        const TensorInfo recurrentInfo({ cellSize, outputSize }, DataType::Float32);
+        const TensorInfo vectorInfo({ cellSize }, DataType::Float32);
+        for (unsigned int gate = 0; gate < numGates; ++gate)
+        {
+            m_Handles.push_back(std::make_unique<ScopedCpuTensorHandle>(ConstTensor(inputInfo, m_InputWeights[gate])));
+            m_Handles.push_back(std::make_unique<ScopedCpuTensorHandle>(
+                ConstTensor(recurrentInfo, m_RecurrentWeights[gate])));
+            m_Handles.push_back(std::make_unique<ScopedCpuTensorHandle>(ConstTensor(vectorInfo, m_Biases[gate])));
+            m_Handles.push_back(std::make_unique<ScopedCpuTensorHandle>(ConstTensor(vectorInfo, m_CellWeights[gate])));
+        }
+        m_Handles.push_back(std::make_unique<ScopedCpuTensorHandle>(
+            ConstTensor(TensorInfo({ outputSize, cellSize }, DataType::Float32), m_Projection)));
+        m_Handles.push_back(std::make_unique<ScopedCpuTensorHandle>(
+            ConstTensor(TensorInfo({ outputSize }, DataType::Float32), m_ProjectionBias)));
+    }
+
+    /// Gates are numbered input, forget, cell, output.
+    LstmQueueDescriptor MakeDescriptor() const
+    {
+        auto handle = [this](unsigned int gate, unsigned int kind) { return m_Handles[gate * 4 + kind].get(); };
+
+        LstmQueueDescriptor descriptor;
+        descriptor.m_Parameters = m_Parameters;
+        if (!m_Parameters.m_CifgEnabled)
+        {
+            descriptor.m_InputToInputWeights = handle(0, 0);
+            descriptor.m_RecurrentToInputWeights = handle(0, 1);
+            descriptor.m_InputGateBias = handle(0, 2);
+            descriptor.m_CellToInputWeights = m_Parameters.m_PeepholeEnabled ? handle(0, 3) : nullptr;
+        }
+        descriptor.m_InputToForgetWeights = handle(1, 0);
+        descriptor.m_RecurrentToForgetWeights = handle(1, 1);
+        descriptor.m_ForgetGateBias = handle(1, 2);
+        descriptor.m_InputToCellWeights = handle(2, 0);
+        descriptor.m_RecurrentToCellWeights = handle(2, 1);
+        descriptor.m_CellBias = handle(2, 2);
+        descriptor.m_InputToOutputWeights = handle(3, 0);
+        descriptor.m_RecurrentToOutputWeights = handle(3, 1);
+        descriptor.m_OutputGateBias = handle(3, 2);
+        if (m_Parameters.m_PeepholeEnabled)
+        {
+            descriptor.m_CellToForgetWeights = handle(1, 3);
+            descriptor.m_CellToOutputWeights = handle(3, 3);
+        }
+        if (m_Parameters.m_ProjectionEnabled)
+        {
+            descriptor.m_ProjectionWeights = m_Handles[16].get();
+            descriptor.m_ProjectionBias = m_Handles[17].get();
+        }
+        return descriptor;
+    }
+
+    LstmDescriptor                                      m_Parameters;
+    std::vector<std::vector<float>>                     m_InputWeights;
+    std::vector<std::vector<float>>                     m_RecurrentWeights;
+    std::vector<std::vector<float>>                     m_Biases;
+    std::vector<std::vector<float>>                     m_CellWeights;
+    std::vector<float>                                  m_Projection;
+    std::vector<float>                                  m_ProjectionBias;
+    std::vector<std::unique_ptr<ScopedCpuTensorHandle>> m_Handles;
+};
+
+/// One LSTM time step with a tanh cell activation, computed gate by gate in double precision.
+void ReferenceLstmStep(const LstmWeights& weights,
+                       unsigned int batchSize, unsigned int inputSize, unsigned int cellSize, unsigned int outputSize,
+                       const float* input, const float* outputStateIn, float* cellState, float* output)
+{
+    const LstmDescriptor& parameters = weights.m_Parameters;
+    auto sigmoid = [](double x) { return 1.0 / (1.0 + std::exp(-x)); };
+
+    for (unsigned int b = 0; b < batchSize; ++b)
+    {
+        const float* x = input + b * inputSize;
+        const float* h = outputStateIn + b * outputSize;
+        float* cell = cellState + b * cellSize;
+
+        std::vector<double> gates[4];
+        for (unsigned int gate = 0; gate < 4; ++gate)
+        {
+            gates[gate].resize(cellSize);
+            for (unsigned int c = 0; c < cellSize; ++c)
+            {
+                double sum = weights.m_Biases[gate][c];
+                for (unsigned int i = 0; i < inputSize; ++i)
+                {
+                    sum += weights.m_InputWeights[gate][c * inputSize + i] * x[i];
+                }
+                for (unsigned int o = 0; o < outputSize; ++o)
+                {
+                    sum += weights.m_RecurrentWeights[gate][c * outputSize + o] * h[o];
+                }
+                gates[gate][c] = sum;
+            }
+        }
+
+        std::vector<double> hidden(cellSize);
+        for (unsigned int c = 0; c < cellSize; ++c)
+        {
+            const double peephole = parameters.m_PeepholeEnabled ? 1.0 : 0.0;
+            const double forgetGate = sigmoid(gates[1][c] + peephole * weights.m_CellWeights[1][c] * cell[c]);
+            const double inputGate = parameters.m_CifgEnabled ?
+                1.0 - forgetGate : sigmoid(gates[0][c] + peephole * weights.m_CellWeights[0][c] * cell[c]);
+            double newCell = forgetGate * cell[c] + inputGate * std::tanh(gates[2][c]);
+            if (parameters.m_ClippingThresCell > 0.0f)
+            {
+                newCell = std::max<double>(-parameters.m_ClippingThresCell,
+                                           std::min<double>(parameters.m_ClippingThresCell, newCell));
+            }
+            cell[c] = static_cast<float>(newCell);
+            const double outputGate = sigmoid(gates[3][c] + peephole * weights.m_CellWeights[3][c] * newCell);
+            hidden[c] = outputGate * std::tanh(newCell);
+        }
+
+        for (unsigned int o = 0; o < outputSize; ++o)
+        {
+            if (!parameters.m_ProjectionEnabled)
+            {
+                output[b * outputSize + o] = static_cast<float>(hidden[o]);
+                continue;
+            }
+            double sum = weights.m_ProjectionBias[o];
+            for (unsigned int c = 0; c < cellSize; ++c)
+            {
+                sum += weights.m_Projection[o * cellSize + c] * hidden[c];
+            }
+            output[b * outputSize + o] = static_cast<float>(sum);
+        }
+    }
+}
+
+void CheckLstmKernel(const LstmDescriptor& parameters,
+                     unsigned int batchSize, unsigned int inputSize, unsigned int cellSize, unsigned int outputSize)
+{
+    const unsigned int numSteps = 4;
+    const LstmWeights weights(inputSize, cellSize, outputSize, parameters);
+    const LstmKernel kernel(weights.MakeDescriptor(), batchSize);
+
+    const std::vector<float> input = MakeSequence(numSteps * batchSize * inputSize, 0.3f);
+    const std::vector<float> outputStateIn = MakeSequence(batchSize * outputSize, 0.1f);
+    const std::vector<float> cellStateIn = MakeSequence(batchSize * cellSize, 0.2f);
+
+    // The whole sequence in one call.
+    std::vector<float> cellState = cellStateIn;
+    std::vector<float> output(numSteps * batchSize * outputSize);
+    kernel.Run(input.data(), outputStateIn.data(), cellState.data(), numSteps, output.data());
+
+    // One step at a time, against the reference, feeding each step's output back as the output state.
+    std::vector<float> expectedCellState = cellStateIn;
+    std::vector<float> expectedOutput(output.size());
+    for (unsigned int step = 0; step < numSteps; ++step)
+    {
+        const float* stepOutputState = step == 0 ? outputStateIn.data() :
+                                                   &expectedOutput[(step - 1) * batchSize * outputSize];
+        ReferenceLstmStep(weights, batchSize, inputSize, cellSize, outputSize,
+                          &input[step * batchSize * inputSize], stepOutputState,
+                          expectedCellState.data(), &expectedOutput[step * batchSize * outputSize]);
+    }
+
+    // The kernel uses the fast sigmoid and tanh approximations.
+    for (unsigned int i = 0; i < output.size(); ++i)
+    {
+        BOOST_TEST(output[i] == expectedOutput[i], boost::test_tools::tolerance(1e-3f));
+    }
+    for (unsigned int i = 0; i < cellState.size(); ++i)
+    {
+        BOOST_TEST(cellState[i] == expectedCellState[i], boost::test_tools::tolerance(1e-3f));
+    }
+}
+
+/// Returns the offset of element (n, c, y, x) of an NCHW or NHWC tensor.
+unsigned int GetImageOffset(const TensorShape& shape, DataLayout dataLayout,
+                            unsigned int n, unsigned int c, unsigned int y, unsigned int x)
+{
+    if (dataLayout == DataLayout::NHWC)
+    {
+        return ((n * shape[1] + y) * shape[2] + x) * shape[3] + c;
+    }
+    return ((n * shape[1] + c) * shape[2] + y) * shape[3] + x;
+}
+
+/// Resizes one output element at a time, in double precision, projecting the top-left corner of each output texel.
+std::vector<double> ReferenceResize(const TensorShape& inputShape, const std::vector<double>& in,
+                                    const TensorShape& outputShape, DataLayout dataLayout, ResizeMethod method)
+{
+    const armnnUtils::DataLayoutIndexed indexed(dataLayout);
+    const unsigned int inputHeight = inputShape[indexed.GetHeightIndex()];
+    const unsigned int inputWidth = inputShape[indexed.GetWidthIndex()];
+    const unsigned int outputHeight = outputShape[indexed.GetHeightIndex()];
+    const unsigned int outputWidth = outputShape[indexed.GetWidthIndex()];
+    const float scaleY = static_cast<float>(inputHeight) / static_cast<float>(outputHeight);
+    const float scaleX = static_cast<float>(inputWidth) / static_cast<float>(outputWidth);
+
+    std::vector<double> out(outputShape.GetNumElements());
+    for (unsigned int n = 0; n < outputShape[0]; ++n)
+    {
+        for (unsigned int c = 0; c < outputShape[indexed.GetChannelsIndex()]; ++c)
+        {
+            for (unsigned int y = 0; y < outputHeight; ++y)
+            {
+                for (unsigned int x = 0; x < outputWidth; ++x)
+                {
+                    const float iy = static_cast<float>(y) * scaleY;
+                    const float ix = static_cast<float>(x) * scaleX;
+                    const unsigned int y0 = static_cast<unsigned int>(std::floor(iy));
+                    const unsigned int x0 = static_cast<unsigned int>(std::floor(ix));
+                    const unsigned int y1 = std::min(y0 + 1, inputHeight - 1);
+                    const unsigned int x1 = std::min(x0 + 1, inputWidth - 1);
+
+                    double value = in[GetImageOffset(inputShape, dataLayout, n, c, y0, x0)];
+                    if (method == ResizeMethod::Bilinear)
+                    {
+                        const double wy = iy - std::floor(iy);
+                        const double wx = ix - std::floor(ix);
+                        const double topRight = in[GetImageOffset(inputShape, dataLayout, n, c, y0, x1)];
+                        const double bottomLeft = in[GetImageOffset(inputShape, dataLayout, n, c, y1, x0)];
+                        const double bottomRight = in[GetImageOffset(inputShape, dataLayout, n, c, y1, x1)];
+                        value = (1 - wy) * ((1 - wx) * value + wx * topRight) +
+                                wy * ((1 - wx) * bottomLeft + wx * bottomRight);
+                    }
+                    out[GetImageOffset(outputShape, dataLayout, n, c, y, x)] = value;
+                }
+            }
+        }
+    }
+    return out;
+}
+
+/// Returns an NCHW or NHWC shape.
+TensorShape MakeImageShape(DataLayout dataLayout, unsigned int batches, unsigned int channels,
+                           unsigned int height, unsigned int width)
+{
+    return dataLayout == DataLayout::NHWC ? TensorShape({ batches, height, width, channels })
+                                          : TensorShape({ batches, channels, height, width });
+}
+
+/// Sums the squares of the whole window for every output element, in double precision.
+std::vector<float> ReferenceLocalResponseNormalization(const std::vector<float>& in, const TensorShape& shape,
+                                                       DataLayout dataLayout,
+                                                       NormalizationAlgorithmChannel channelType,
+                                                       unsigned int normSize, double alpha, double beta, double k)
+{
+    const armnnUtils::DataLayoutIndexed indexed(dataLayout);
+    const int channels = static_cast<int>(shape[indexed.GetChannelsIndex()]);
+    const int height = static_cast<int>(shape[indexed.GetHeightIndex()]);
+    const int width = static_cast<int>(shape[indexed.GetWidthIndex()]);
+    const int radius = static_cast<int>(normSize / 2);
+
+    auto at = [&](unsigned int n, int c, int y, int x)
+    {
+        return static_cast<double>(in[GetImageOffset(shape, dataLayout, n, static_cast<unsigned int>(c),
+                                                     static_cast<unsigned int>(y), static_cast<unsigned int>(x))]);
+    };
+
+    std::vector<float> out(in.size());
+    for (unsigned int n = 0; n < shape[0]; ++n)
+    {
+        for (int c = 0; c < channels; ++c)
+        {
+            for (int y = 0; y < height; ++y)
+            {
+                for (int x = 0; x < width; ++x)
+                {
+                    double sum = 0.0;
+                    if (channelType == NormalizationAlgorithmChannel::Across)
+                    {
+                        for (int z = std::max(0, c - radius); z <= std::min(channels - 1, c + radius); ++z)
+                        {
+                            sum += at(n, z, y, x) * at(n, z, y, x);
+                        }
+                    }
+                    else
+                    {
+                        for (int j = std::max(0, y - radius); j <= std::min(height - 1, y + radius); ++j)
+                        {
+                            for (int i = std::max(0, x - radius); i <= std::min(width - 1, x + radius); ++i)
+                            {
+                                sum += at(n, c, j, i) * at(n, c, j, i);
+                            }
+                        }
+                    }
+                    out[GetImageOffset(shape, dataLayout, n, static_cast<unsigned int>(c),
+                                       static_cast<unsigned int>(y), static_cast<unsigned int>(x))] =
+                        static_cast<float>(at(n, c, y, x) * std::pow(k + alpha * sum, -beta));
+                }
+            }
+        }
+    }
+    return out;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(RefKernels)
+
+BOOST_AUTO_TEST_CASE(FastExpRelativeErrorBound)
+{
+    double maxError = 0.0;
+    ForEachFloat(-87.0f, 88.0f, [&maxError](float x)
+    {
+        const double expected = std::exp(static_cast<double>(x));
+        maxError = std::max(maxError, std::fabs(FastExp(x) - expected) / expected);
+    });
+    BOOST_TEST(maxError < 2.6e-7);
+}
+
+BOOST_AUTO_TEST_CASE(FastSigmoidAndTanhAbsoluteErrorBounds)
+{
+    const float maxFloat = std::numeric_limits<float>::max();
+
+    double maxSigmoidError = 0.0;
+    double maxTanhError = 0.0;
+    ForEachFloat(-maxFloat, maxFloat, [&](float x)
+    {
+        const double xd = static_cast<double>(x);
+        maxSigmoidError = std::max(maxSigmoidError, std::fabs(FastSigmoid(x) - 1.0 / (1.0 + std::exp(-xd))));
+        maxTanhError    = std::max(maxTanhError, std::fabs(FastTanh(x) - std::tanh(xd)));
+    });
+    BOOST_TEST(maxSigmoidError < 1.5e-7);
+    BOOST_TEST(maxTanhError < 2.5e-7);
+}
+
+BOOST_AUTO_TEST_CASE(FastExpSaturatesAndPropagatesNaN)
+{
+    for (float x : { 88.37f, 88.4f, 88.7f, 1.0e30f, std::numeric_limits<float>::infinity() })
+    {
+        const float result = FastExp(x);
+        BOOST_TEST(std::isfinite(result));
+        BOOST_TEST(result > 2.0e38f);
+    }
+
+    for (float x : { -87.3f, -100.0f, -1.0e30f, -std::numeric_limits<float>::infinity() })
+    {
+        const float result = FastExp(x);
+        BOOST_TEST(result > 0.0f);
+        BOOST_TEST(std::isnormal(result));
+    }
+
+    BOOST_TEST(std::isnan(FastExp(std::numeric_limits<float>::quiet_NaN())));
+    BOOST_TEST(std::isnan(FastSigmoid(std::numeric_limits<float>::quiet_NaN())));
+    BOOST_TEST(std::isnan(FastTanh(std::numeric_limits<float>::quiet_NaN())));
+}
+
+BOOST_AUTO_TEST_CASE(ActivationKernelsMatchScalarActivation)
+{
+    const ActivationFunction functions[] =
+    {
+        ActivationFunction::Linear,
+        ActivationFunction::Sigmoid,
+        ActivationFunction::ReLu,
+        ActivationFunction::BoundedReLu,
+        ActivationFunction::SoftReLu,
+        ActivationFunction::LeakyReLu,
+        ActivationFunction::Abs,
+        ActivationFunction::Sqrt,
+        ActivationFunction::Square,
+        ActivationFunction::TanH
+    };
+    const float a = 1.5f;
+    const float b = -0.5f;
+
+    std::vector<float> input;
+    for (int i = -400; i <= 400; ++i)
+    {
+        input.push_back(static_cast<float>(i) * 0.025f);
+    }
+
+    for (ActivationFunction function : functions)
+    {
+        std::vector<float> output(input.size());
+        GetActivationKernel(function)(input.data(), output.data(), static_cast<unsigned int>(input.size()), a, b);
+
+        for (unsigned int i = 0; i < input.size(); ++i)
+        {
+            const float expected = Activation(input[i], function, a, b);
+            if (std::isnan(expected))
+            {
+                BOOST_TEST(std::isnan(output[i]));
+            }
+            else
+            {
+                BOOST_TEST(std::fabs(output[i] - expected) <= 1.0e-6f * std::max(1.0f, std::fabs(expected)),
+                           GetActivationFunctionAsCString(function) << "(" << input[i] << ") = " << output[i]
+                           << ", expected " << expected);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ActivationKernelRejectsUnsupportedFunction)
+{
+    BOOST_CHECK_THROW(GetActivationKernel(static_cast<ActivationFunction>(100)), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(SoftmaxMatchesReference)
+{
+    // Enough rows for the work to be split across threads.
+    const unsigned int numRows = 5000;
+    const unsigned int numChannels = 7;
+    const TensorInfo tensorInfo({ numRows, numChannels }, DataType::Float32);
+
+    std::vector<float> input(numRows * numChannels);
+    for (unsigned int i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<float>((i * 37) % 101) * 0.1f - 5.0f;
+    }
+
+    armnnUtils::SetParallelForThreadCount(4);
+
+    std::vector<float> expected(input.size());
+    ReferenceSoftmax(input, expected, numChannels, 0.75f);
+
+    std::vector<float> output(input.size());
+    Softmax(input.data(), output.data(), tensorInfo, 0.75f);
+
+    // In place.
+    std::vector<float> inPlace = input;
+    Softmax(inPlace.data(), inPlace.data(), tensorInfo, 0.75f);
+
+    armnnUtils::SetParallelForThreadCount(0);
+
+    for (unsigned int i = 0; i < input.size(); ++i)
+    {
+        BOOST_TEST(std::fabs(output[i] - expected[i]) < 1.0e-6f);
+        BOOST_TEST(inPlace[i] == output[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(LogSoftmaxMatchesReference)
+{
+    const TensorInfo tensorInfo({ 2, 4 }, DataType::Float32);
+    const std::vector<float> input = { 1.0f, 2.0f, 3.0f, 4.0f,
+                                       0.0f, -200.0f, 0.0f, 0.0f };
+
+    std::vector<float> softmax(input.size());
+    ReferenceSoftmax(input, softmax, 4, 1.0f);
+
+    std::vector<float> output(input.size());
+    LogSoftmax(input.data(), output.data(), tensorInfo, 1.0f);
+
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        BOOST_TEST(std::fabs(output[i] - std::log(softmax[i])) < 1.0e-6f);
+    }
+
+    // exp(-200) underflows in single precision, but the log-softmax stays finite and exact.
+    BOOST_TEST(std::fabs(output[4] + std::log(3.0f)) < 1.0e-6f);
+    BOOST_TEST(std::fabs(output[5] - (-200.0f - std::log(3.0f))) < 1.0e-4f);
+}
+
+BOOST_AUTO_TEST_CASE(BroadcastLoopCollapsesCompatibleDimensions)
+{
+    for (const BroadcastCase& testCase : GetBroadcastCases())
+    {
+        BroadcastLoop loop(testCase.m_Shape0, testCase.m_Shape1, testCase.m_OutShape);
+        BOOST_TEST(loop.GetNumDimensions() == testCase.m_CollapsedDimensions);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ElementwiseFastPathMatchesReference)
+{
+    armnnUtils::SetParallelForThreadCount(4);
+
+    for (const BroadcastCase& testCase : GetBroadcastCases())
+    {
+        const std::vector<float> in0 = MakeSequence(testCase.m_Shape0.GetNumElements(), 0.5f);
+        const std::vector<float> in1 = MakeSequence(testCase.m_Shape1.GetNumElements(), 0.25f);
+
+        // Arithmetic, through both the fast path and the decoder path.
+        const std::vector<float> expectedSum = ReferenceElementwise<std::plus<float>>(
+            testCase.m_Shape0, in0, testCase.m_Shape1, in1, testCase.m_OutShape);
+
+        std::vector<float> sum(testCase.m_OutShape.GetNumElements());
+        ElementwiseFunction<std::plus<float>>(testCase.m_Shape0, testCase.m_Shape1, testCase.m_OutShape,
+                                              in0.data(), in1.data(), sum.data());
+        BOOST_TEST(sum == expectedSum, boost::test_tools::per_element());
+
+        std::vector<float> decoderSum(testCase.m_OutShape.GetNumElements());
+        FloatDecoder decoder0(in0.data());
+        FloatDecoder decoder1(in1.data());
+        FloatEncoder encoder(decoderSum.data());
+        ElementwiseFunction<std::plus<float>>(testCase.m_Shape0, testCase.m_Shape1, testCase.m_OutShape,
+                                              decoder0, decoder1, encoder);
+        BOOST_TEST(decoderSum == expectedSum, boost::test_tools::per_element());
+
+        // Comparisons produce Boolean (uint8_t) outputs.
+        const std::vector<float> expectedGreater = ReferenceElementwise<std::greater<float>>(
+            testCase.m_Shape0, in0, testCase.m_Shape1, in1, testCase.m_OutShape);
+
+        std::vector<uint8_t> greater(testCase.m_OutShape.GetNumElements());
+        ElementwiseFunction<std::greater<float>>(testCase.m_Shape0, testCase.m_Shape1, testCase.m_OutShape,
+                                                 in0.data(), in1.data(), greater.data());
+        for (unsigned int i = 0; i < greater.size(); ++i)
+        {
+            BOOST_TEST(static_cast<float>(greater[i]) == expectedGreater[i]);
+        }
+    }
+
+    armnnUtils::SetParallelForThreadCount(0);
+}
+
+BOOST_AUTO_TEST_CASE(ElementwiseFastPathFusesActivation)
+{
+    const TensorShape shape0({ 4, 6 });
+    const TensorShape shape1({ 1, 6 });
+    const std::vector<float> in0 = MakeSequence(shape0.GetNumElements(), 1.0f);
+    const std::vector<float> in1 = MakeSequence(shape1.GetNumElements(), 0.5f);
+
+    std::vector<float> expected = ReferenceElementwise<maximum<float>>(shape0, in0, shape1, in1, shape0);
+    for (float& value : expected)
+    {
+        value = std::min(2.0f, std::max(-1.0f, value));
+    }
+
+    std::vector<float> output(shape0.GetNumElements());
+    ElementwiseFunction<maximum<float>>(shape0, shape1, shape0, in0.data(), in1.data(), output.data(),
+                                        GetActivationKernel(ActivationFunction::BoundedReLu), 2.0f, -1.0f);
+    BOOST_TEST(output == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(ReductionPlanMergesDimensions)
+{
+    for (const ReduceCase& testCase : GetReduceCases())
+    {
+        BOOST_TEST(PlanReduction(testCase.m_Shape, testCase.m_Axis).size() == testCase.m_NumPasses);
+    }
+
+    const std::vector<ReductionPass> nhwc = PlanReduction(TensorShape({ 2, 7, 7, 64 }), { 1, 2 });
+    BOOST_TEST(nhwc[0].m_Outer == 2u);
+    BOOST_TEST(nhwc[0].m_Reduce == 49u);
+    BOOST_TEST(nhwc[0].m_Inner == 64u);
+
+    BOOST_CHECK_THROW(PlanReduction(TensorShape({ 2, 3 }), { 2 }), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(ReduceMatchesReference)
+{
+    armnnUtils::SetParallelForThreadCount(4);
+
+    for (const ReduceCase& testCase : GetReduceCases())
+    {
+        // Multiples of 0.5 of small magnitude, so that float sums are exact in any order.
+        const std::vector<float> floats = MakeSequence(testCase.m_Shape.GetNumElements(), 0.5f);
+        std::vector<uint8_t> bytes(floats.size());
+        for (unsigned int i = 0; i < bytes.size(); ++i)
+        {
+            bytes[i] = static_cast<uint8_t>(i * 37 % 251);
+        }
+
+        for (ReduceOperation operation : { ReduceOperation::Sum, ReduceOperation::Max, ReduceOperation::Min })
+        {
+            const std::vector<float> expectedFloats =
+                ReferenceReduce<float, float>(testCase.m_Shape, floats, testCase.m_Axis, operation);
+            std::vector<float> outFloats(expectedFloats.size());
+            Reduce(testCase.m_Shape, testCase.m_Axis, operation, floats.data(), outFloats.data());
+            BOOST_TEST(outFloats == expectedFloats, boost::test_tools::per_element());
+
+            const std::vector<uint32_t> expectedBytes =
+                ReferenceReduce<uint8_t, uint32_t>(testCase.m_Shape, bytes, testCase.m_Axis, operation);
+            std::vector<uint32_t> outBytes(expectedBytes.size());
+            Reduce(testCase.m_Shape, testCase.m_Axis, operation, bytes.data(), outBytes.data());
+            BOOST_TEST(outBytes == expectedBytes, boost::test_tools::per_element());
+        }
+    }
+
+    armnnUtils::SetParallelForThreadCount(0);
+}
+
+BOOST_AUTO_TEST_CASE(QuantizedMeanUsesExactSums)
+{
+    // Averages of { 1, 2 } and { 3, 4 } with scale 0.5 and offset 1: 0.25 and 1.25, requantized with scale 0.25.
+    TensorInfo inputInfo({ 2, 2 }, DataType::QuantisedAsymm8, 0.5f, 1);
+    TensorInfo outputInfo({ 2 }, DataType::QuantisedAsymm8, 0.25f, 0);
+    const std::vector<uint8_t> input = { 1, 2, 3, 4 };
+    std::vector<uint8_t> output(2);
+
+    Mean(inputInfo, outputInfo, { 1 }, input.data(), output.data());
+    BOOST_TEST(output[0] == 1u);
+    BOOST_TEST(output[1] == 5u);
+}
+
+BOOST_AUTO_TEST_CASE(CopyPlanMergesContiguousDimensions)
+{
+    // A contiguous block of a row-major [4, 5, 6] tensor into a dense output merges into a single run.
+    BOOST_TEST(CopyPlan({ { 4, 30, 30 }, { 5, 6, 6 }, { 6, 1, 1 } }).GetNumDimensions() == 1u);
+    // Rows of a wider tensor stay separate runs.
+    BOOST_TEST(CopyPlan({ { 4, 30, 18 }, { 3, 6, 6 }, { 6, 1, 1 } }).GetNumDimensions() == 2u);
+    // Size-1 dimensions are dropped.
+    BOOST_TEST(CopyPlan({ { 1, 100, 7 }, { 6, 1, 1 } }).GetNumDimensions() == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(CopyPlanCopiesStridedViews)
+{
+    armnnUtils::SetParallelForThreadCount(4);
+
+    // Every other column of a [300, 400] tensor, reversed, into a dense [300, 200] output; large enough to be split
+    // across threads.
+    const unsigned int rows = 300;
+    const unsigned int columns = 400;
+    std::vector<uint32_t> input(rows * columns);
+    for (unsigned int i = 0; i < input.size(); ++i)
+    {
+        input[i] = i;
+    }
+
+    std::vector<uint32_t> output(rows * columns / 2);
+    CopyPlan({ { rows, columns, columns / 2 }, { columns / 2, -2, 1 } })
+        .Copy(input.data() + columns - 1, output.data(), sizeof(uint32_t));
+    for (unsigned int r = 0; r < rows; ++r)
+    {
+        for (unsigned int c = 0; c < columns / 2; ++c)
+        {
+            BOOST_TEST(output[r * columns / 2 + c] == input[r * columns + columns - 1 - 2 * c]);
+        }
+    }
+
+    // Elements of other sizes, including ones without a dedicated strided loop.
+    std::vector<uint64_t> wide = { 1, 2, 3, 4, 5, 6 };
+    std::vector<uint64_t> wideOut(3);
+    CopyPlan({ { 3, 2, 1 } }).Copy(wide.data(), wideOut.data(), sizeof(uint64_t));
+    BOOST_TEST((wideOut == std::vector<uint64_t>{ 1, 3, 5 }));
+
+    std::vector<uint8_t> bytes = { 1, 2, 3, 4, 5, 6 };
+    CopyPlan({ { 3, 2, 2 } }).Zero(bytes.data(), sizeof(uint8_t));
+    BOOST_TEST((bytes == std::vector<uint8_t>{ 0, 2, 0, 4, 0, 6 }));
+
+    armnnUtils::SetParallelForThreadCount(0);
+}
+
+BOOST_AUTO_TEST_CASE(PadWritesEveryOutputElement)
+{
+    const std::vector<std::pair<TensorShape, std::vector<std::pair<unsigned int, unsigned int>>>> cases =
+    {
+        { TensorShape({ 5 }),          { { 2, 3 } } },
+        { TensorShape({ 3, 4 }),       { { 1, 0 }, { 0, 2 } } },
+        { TensorShape({ 2, 3, 4 }),    { { 0, 0 }, { 1, 1 }, { 2, 0 } } },
+        { TensorShape({ 1, 2, 3, 4 }), { { 1, 1 }, { 0, 1 }, { 2, 2 }, { 3, 1 } } },
+    };
+
+    for (const auto& testCase : cases)
+    {
+        const TensorShape& inShape = testCase.first;
+        std::vector<unsigned int> outDims;
+        for (unsigned int d = 0; d < inShape.GetNumDimensions(); ++d)
+        {
+            outDims.push_back(inShape[d] + testCase.second[d].first + testCase.second[d].second);
+        }
+        const TensorShape outShape(static_cast<unsigned int>(outDims.size()), outDims.data());
+
+        const std::vector<float> input = MakeSequence(inShape.GetNumElements(), 1.0f);
+        const std::vector<float> expected = ReferencePad(inShape, input, testCase.second, outShape);
+
+        // Start from garbage, so that padding which is not written shows up.
+        std::vector<float> output(outShape.GetNumElements(), 99.0f);
+        Pad(TensorInfo(inShape, DataType::Float32), TensorInfo(outShape, DataType::Float32), testCase.second,
+            input.data(), output.data());
+        BOOST_TEST(output == expected, boost::test_tools::per_element());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(StridedSliceWalksNegativeAndInnerStrides)
+{
+    const TensorInfo inputInfo({ 2, 3, 4 }, DataType::Float32);
+    std::vector<float> input(inputInfo.GetNumElements());
+    for (unsigned int i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<float>(i);
+    }
+
+    // Reverse the innermost axis, stopping before index 0.
+    StridedSliceDescriptor reverse({ 0, 0, 3 }, { 2, 3, 0 }, { 1, 1, -1 });
+    std::vector<float> expected;
+    for (unsigned int a = 0; a < 2; ++a)
+    {
+        for (unsigned int b = 0; b < 3; ++b)
+        {
+            for (unsigned int c = 3; c > 0; --c)
+            {
+                expected.push_back(input[(a * 3 + b) * 4 + c]);
+            }
+        }
+    }
+    std::vector<float> output(expected.size());
+    StridedSlice(inputInfo, TensorInfo({ 2, 3, 3 }, DataType::Float32), reverse, input.data(), output.data());
+    BOOST_TEST(output == expected, boost::test_tools::per_element());
+
+    // Every other element of the two inner axes.
+    StridedSliceDescriptor subsample({ 0, 0, 0 }, { 2, 3, 4 }, { 1, 2, 2 });
+    expected.clear();
+    for (unsigned int a = 0; a < 2; ++a)
+    {
+        for (unsigned int b = 0; b < 3; b += 2)
+        {
+            for (unsigned int c = 0; c < 4; c += 2)
+            {
+                expected.push_back(input[(a * 3 + b) * 4 + c]);
+            }
+        }
+    }
+    output.assign(expected.size(), 0.0f);
+    StridedSlice(inputInfo, TensorInfo({ 2, 2, 2 }, DataType::Float32), subsample, input.data(), output.data());
+    BOOST_TEST(output == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(SpaceToBatchAndBackRestoresInput)
+{
+    for (DataLayout dataLayout : { DataLayout::NHWC, DataLayout::NCHW })
+    {
+        // A 5x3 image with 2 channels, padded to 6x4 and split into 2x2 blocks.
+        const bool nhwc = dataLayout == DataLayout::NHWC;
+        const TensorInfo imageInfo(nhwc ? TensorShape({ 1, 5, 3, 2 }) : TensorShape({ 1, 2, 5, 3 }), DataType::Float32);
+        const TensorInfo batchInfo(nhwc ? TensorShape({ 4, 3, 2, 2 }) : TensorShape({ 4, 2, 3, 2 }), DataType::Float32);
+
+        SpaceToBatchNdDescriptor descriptor({ 2, 2 }, { { 1, 0 }, { 0, 1 } });
+        descriptor.m_DataLayout = dataLayout;
+
+        std::vector<float> image(imageInfo.GetNumElements());
+        for (unsigned int i = 0; i < image.size(); ++i)
+        {
+            image[i] = static_cast<float>(i + 1);
+        }
+
+        std::vector<float> batches(batchInfo.GetNumElements(), -1.0f);
+        SpaceToBatchNd(imageInfo, batchInfo, descriptor, image.data(), batches.data());
+
+        // One padding row and one padding column, each spread across the blocks, are zero.
+        BOOST_TEST(std::count(batches.begin(), batches.end(), -1.0f) == 0);
+        BOOST_TEST(std::count(batches.begin(), batches.end(), 0.0f) == (4 + 5) * 2);
+
+        std::vector<float> restored(image.size(), -1.0f);
+        BatchToSpaceNd(armnnUtils::DataLayoutIndexed(dataLayout), batchInfo, imageInfo, descriptor.m_BlockShape,
+                       descriptor.m_PadList, batches.data(), restored.data());
+        BOOST_TEST(restored == image, boost::test_tools::per_element());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ResizeMatchesReference)
+{
+    armnnUtils::SetParallelForThreadCount(4);
+
+    struct Size
+    {
+        unsigned int m_Height;
+        unsigned int m_Width;
+    };
+    // Downscaling, upscaling, a single pixel, and an upscale large enough to be split across threads.
+    const std::vector<std::pair<Size, Size>> sizes =
+    {
+        { { 5, 7 },   { 3, 4 } },
+        { { 5, 7 },   { 9, 11 } },
+        { { 4, 3 },   { 1, 1 } },
+        { { 40, 30 }, { 64, 48 } },
+    };
+
+    for (DataLayout dataLayout : { DataLayout::NCHW, DataLayout::NHWC })
+    {
+        for (ResizeMethod method : { ResizeMethod::Bilinear, ResizeMethod::NearestNeighbor })
+        {
+            for (const auto& size : sizes)
+            {
+                const TensorShape inputShape =
+                    MakeImageShape(dataLayout, 2, 3, size.first.m_Height, size.first.m_Width);
+                const TensorShape outputShape =
+                    MakeImageShape(dataLayout, 2, 3, size.second.m_Height, size.second.m_Width);
+
+                std::vector<uint8_t> quantized(inputShape.GetNumElements());
+                for (unsigned int i = 0; i < quantized.size(); ++i)
+                {
+                    quantized[i] = static_cast<uint8_t>((i * 37) % 251);
+                }
+
+                // Float32, against the reference on the same values.
+                const std::vector<float> floats(quantized.begin(), quantized.end());
+                const std::vector<double> expected =
+                    ReferenceResize(inputShape, std::vector<double>(quantized.begin(), quantized.end()),
+                                    outputShape, dataLayout, method);
+                std::vector<float> floatOutput(outputShape.GetNumElements());
+                Resize(floats.data(), TensorInfo(inputShape, DataType::Float32), floatOutput.data(),
+                       TensorInfo(outputShape, DataType::Float32), dataLayout, method);
+                for (unsigned int i = 0; i < floatOutput.size(); ++i)
+                {
+                    BOOST_TEST(floatOutput[i] == expected[i], boost::test_tools::tolerance(1e-4));
+                }
+
+                // QAsymm8, requantized to different parameters, against quantizing the reference result.
+                const TensorInfo inputInfo(inputShape, DataType::QuantisedAsymm8, 0.5f, 10);
+                const TensorInfo outputInfo(outputShape, DataType::QuantisedAsymm8, 0.75f, 3);
+                std::vector<uint8_t> output(outputShape.GetNumElements());
+                Resize(quantized.data(), inputInfo, output.data(), outputInfo, dataLayout, method);
+                for (unsigned int i = 0; i < output.size(); ++i)
+                {
+                    const float real = static_cast<float>((expected[i] - 10.0) * 0.5);
+                    BOOST_TEST(output[i] == Quantize<uint8_t>(real, 0.75f, 3));
+                }
+            }
+        }
+    }
+
+    armnnUtils::SetParallelForThreadCount(0);
+}
+
+BOOST_AUTO_TEST_CASE(LocalResponseNormalizationMatchesReference)
+{
+    armnnUtils::SetParallelForThreadCount(4);
+
+    // Small images, windows wider than the tensor, and a tensor large enough to be split across threads.
+    const std::vector<std::pair<std::vector<unsigned int>, unsigned int>> cases =
+    {
+        { { 2, 7, 5, 6 },   5 }, // batches, channels, height, width; normSize
+        { { 1, 3, 2, 2 },   7 },
+        { { 1, 16, 48, 40 }, 3 },
+    };
+
+    for (DataLayout dataLayout : { DataLayout::NCHW, DataLayout::NHWC })
+    {
+        for (NormalizationAlgorithmChannel channelType :
+             { NormalizationAlgorithmChannel::Across, NormalizationAlgorithmChannel::Within })
+        {
+            for (const auto& testCase : cases)
+            {
+                const std::vector<unsigned int>& dims = testCase.first;
+                const TensorShape shape = MakeImageShape(dataLayout, dims[0], dims[1], dims[2], dims[3]);
+                const std::vector<float> input = MakeSequence(shape.GetNumElements(), 0.5f);
+
+                // The powers with dedicated code, and one that goes through powf.
+                for (float beta : { 0.75f, 0.5f, 1.0f, 0.6f })
+                {
+                    std::vector<float> output(input.size());
+                    LocalResponseNormalization(input.data(), output.data(), shape, dataLayout, channelType,
+                                               testCase.second, 0.1f, beta, 2.0f);
+                    const std::vector<float> expected = ReferenceLocalResponseNormalization(
+                        input, shape, dataLayout, channelType, testCase.second, 0.1, beta, 2.0);
+                    for (unsigned int i = 0; i < output.size(); ++i)
+                    {
+                        BOOST_TEST(output[i] == expected[i], boost::test_tools::tolerance(1e-5f));
+                    }
+                }
+            }
+        }
+    }
+
+    armnnUtils::SetParallelForThreadCount(0);
+}
+
+BOOST_AUTO_TEST_CASE(LstmKernelMatchesReferenceOverASequence)
+{
+    LstmDescriptor parameters;
+    parameters.m_ActivationFunc = 4;
+    parameters.m_CifgEnabled = false;
+    parameters.m_PeepholeEnabled = true;
+    parameters.m_ProjectionEnabled = true;
+    parameters.m_ClippingThresCell = 0.8f;
+
+    // Five batches: one block of four vectors per weight row, plus a remainder.
+    CheckLstmKernel(parameters, 5, 7, 6, 4);
+
+    parameters.m_CifgEnabled = true;
+    parameters.m_PeepholeEnabled = false;
+    parameters.m_ProjectionEnabled = false;
+    parameters.m_ClippingThresCell = 0.0f;
+    CheckLstmKernel(parameters, 2, 3, 5, 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
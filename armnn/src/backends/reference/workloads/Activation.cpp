@@ -4,6 +4,7 @@
 //
 
 #include "Activation.hpp"
+#include "FastMath.hpp"
 
 #include <boost/log/trivial.hpp>
 
@@ -100,4 +101,90 @@ void Activation(Decoder<float>& in,
     out -= numElements;
 }
 
+namespace
+{
+
+// Each kernel is a plain loop over raw pointers with the function inlined, which the compiler can vectorize.
+template <typename Function>
+inline void ApplyToAll(const float* in, float* out, unsigned int numElements, Function function)
+{
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        out[i] = function(in[i]);
+    }
+}
+
+void LinearKernel(const float* in, float* out, unsigned int numElements, float a, float b)
+{
+    ApplyToAll(in, out, numElements, [a, b](float x) { return a * x + b; });
+}
+
+void SigmoidKernel(const float* in, float* out, unsigned int numElements, float, float)
+{
+    ApplyToAll(in, out, numElements, [](float x) { return FastSigmoid(x); });
+}
+
+void ReLuKernel(const float* in, float* out, unsigned int numElements, float, float)
+{
+    ApplyToAll(in, out, numElements, [](float x) { return std::max(0.f, x); });
+}
+
+void BoundedReLuKernel(const float* in, float* out, unsigned int numElements, float a, float b)
+{
+    ApplyToAll(in, out, numElements, [a, b](float x) { return std::min(a, std::max(b, x)); });
+}
+
+void SoftReLuKernel(const float* in, float* out, unsigned int numElements, float, float)
+{
+    ApplyToAll(in, out, numElements, [](float x) { return logf(1.0f + expf(x)); });
+}
+
+void LeakyReLuKernel(const float* in, float* out, unsigned int numElements, float a, float)
+{
+    ApplyToAll(in, out, numElements, [a](float x) { return x > 0.0f ? x : (x * a); });
+}
+
+void AbsKernel(const float* in, float* out, unsigned int numElements, float, float)
+{
+    ApplyToAll(in, out, numElements, [](float x) { return std::fabs(x); });
+}
+
+void SqrtKernel(const float* in, float* out, unsigned int numElements, float, float)
+{
+    ApplyToAll(in, out, numElements, [](float x) { return sqrtf(x); });
+}
+
+void SquareKernel(const float* in, float* out, unsigned int numElements, float, float)
+{
+    ApplyToAll(in, out, numElements, [](float x) { return x * x; });
+}
+
+void TanHKernel(const float* in, float* out, unsigned int numElements, float a, float b)
+{
+    ApplyToAll(in, out, numElements, [a, b](float x) { return a * FastTanh(b * x); });
+}
+
+} // anonymous namespace
+
+ActivationKernel GetActivationKernel(ActivationFunction function)
+{
+    switch (function)
+    {
+        case ActivationFunction::Linear:      return &LinearKernel;
+        case ActivationFunction::Sigmoid:     return &SigmoidKernel;
+        case ActivationFunction::ReLu:        return &ReLuKernel;
+        case ActivationFunction::BoundedReLu: return &BoundedReLuKernel;
+        case ActivationFunction::SoftReLu:    return &SoftReLuKernel;
+        case ActivationFunction::LeakyReLu:   return &LeakyReLuKernel;
+        case ActivationFunction::Abs:         return &AbsKernel;
+        case ActivationFunction::Sqrt:        return &SqrtKernel;
+        case ActivationFunction::Square:      return &SquareKernel;
+        case ActivationFunction::TanH:        return &TanHKernel;
+        default:
+        {
+            throw InvalidArgumentException("Unsupported activation function");
+        }
+    }
+}
+
 } //namespace armnn
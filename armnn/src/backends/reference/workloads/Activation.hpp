@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: MIT
 //
 
+#pragma once
+
 #include "BaseIterator.hpp"
 
 #include <armnn/Tensor.hpp>
@@ -22,4 +24,11 @@ void Activation(Decoder<float>& in,
                 float a,
                 float b);
 
+/// Applies an activation function to numElements contiguous values. in and out may point to the same buffer.
+using ActivationKernel = void(*)(const float* in, float* out, unsigned int numElements, float a, float b);
+
+/// Returns the bulk kernel for the given function, so that the switch on the function is resolved once per workload
+/// rather than once per element. Sigmoid and TanH use the approximations from FastMath.hpp.
+ActivationKernel GetActivationKernel(ActivationFunction function);
+
 } //namespace armnn
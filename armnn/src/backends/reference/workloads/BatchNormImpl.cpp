@@ -0,0 +1,165 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "BatchNormImpl.hpp"
+
+#include <ParallelFor.hpp>
+
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace armnn
+{
+
+namespace
+{
+
+// One multiply-add per element: only tens of thousands of them are worth a task.
+constexpr unsigned int g_MinElementsPerTask = 32768;
+
+/// Runs @a planeFunc(input, output, channel, length) over runs of elements sharing a channel (an NCHW plane), or
+/// @a pixelFunc(input, output, numChannels) over pixels whose channels are contiguous (NHWC).
+template <typename T, typename PlaneFunc, typename PixelFunc>
+void ForEachChannelRun(const TensorShape& shape,
+                       armnnUtils::DataLayoutIndexed dataLayout,
+                       const T* input,
+                       T* output,
+                       PlaneFunc planeFunc,
+                       PixelFunc pixelFunc)
+{
+    const unsigned int numChannels = shape[dataLayout.GetChannelsIndex()];
+    const unsigned int numSpatial = shape[dataLayout.GetHeightIndex()] * shape[dataLayout.GetWidthIndex()];
+    if (shape.GetNumElements() == 0)
+    {
+        return;
+    }
+
+    if (dataLayout.GetDataLayout() == DataLayout::NHWC)
+    {
+        const unsigned int minPixelsPerTask = std::max(1u, g_MinElementsPerTask / numChannels);
+        armnnUtils::ParallelFor(shape[0] * numSpatial, minPixelsPerTask, [&](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int pixel = begin; pixel < end; ++pixel)
+            {
+                pixelFunc(input + pixel * numChannels, output + pixel * numChannels, numChannels);
+            }
+        });
+        return;
+    }
+
+    const unsigned int minPlanesPerTask = std::max(1u, g_MinElementsPerTask / numSpatial);
+    armnnUtils::ParallelFor(shape[0] * numChannels, minPlanesPerTask, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int plane = begin; plane < end; ++plane)
+        {
+            planeFunc(input + plane * numSpatial, output + plane * numSpatial, plane % numChannels, numSpatial);
+        }
+    });
+}
+
+} // anonymous namespace
+
+BatchNormScaleShift::BatchNormScaleShift(const float* mean,
+                                         const float* variance,
+                                         const float* beta,
+                                         const float* gamma,
+                                         unsigned int numChannels,
+                                         float        eps)
+    : m_Scale(numChannels)
+    , m_Shift(numChannels)
+{
+    for (unsigned int c = 0; c < numChannels; ++c)
+    {
+        m_Scale[c] = gamma[c] / sqrtf(variance[c] + eps);
+        m_Shift[c] = beta[c] - m_Scale[c] * mean[c];
+    }
+}
+
+void BatchNormImpl(const BatchNormScaleShift&    scaleShift,
+                   const TensorShape&            shape,
+                   armnnUtils::DataLayoutIndexed dataLayout,
+                   const float*                  inputData,
+                   float*                        outputData)
+{
+    const float* scale = scaleShift.m_Scale.data();
+    const float* shift = scaleShift.m_Shift.data();
+
+    ForEachChannelRun(shape, dataLayout, inputData, outputData,
+        [scale, shift](const float* in, float* out, unsigned int channel, unsigned int length)
+        {
+            const float mult = scale[channel];
+            const float add = shift[channel];
+            for (unsigned int i = 0; i < length; ++i)
+            {
+                out[i] = mult * in[i] + add;
+            }
+        },
+        [scale, shift](const float* in, float* out, unsigned int numChannels)
+        {
+            for (unsigned int c = 0; c < numChannels; ++c)
+            {
+                out[c] = scale[c] * in[c] + shift[c];
+            }
+        });
+}
+
+BatchNormScaleShift FoldQuantization(const BatchNormScaleShift& scaleShift,
+                                     const TensorInfo&          inputInfo,
+                                     const TensorInfo&          outputInfo)
+{
+    // output / outputScale = (scale * (input - inputOffset) * inputScale + shift) / outputScale, so each channel
+    // becomes input * scale' + shift'.
+    const float inputScale = inputInfo.GetQuantizationScale();
+    const float inputOffset = boost::numeric_cast<float>(inputInfo.GetQuantizationOffset());
+    const float outputScale = outputInfo.GetQuantizationScale();
+
+    BatchNormScaleShift folded = scaleShift;
+    for (size_t c = 0; c < folded.m_Scale.size(); ++c)
+    {
+        folded.m_Scale[c] = scaleShift.m_Scale[c] * inputScale / outputScale;
+        folded.m_Shift[c] = (scaleShift.m_Shift[c] - scaleShift.m_Scale[c] * inputOffset * inputScale) / outputScale;
+    }
+    return folded;
+}
+
+void BatchNormImpl(const BatchNormScaleShift&    quantizedScaleShift,
+                   const TensorShape&            shape,
+                   armnnUtils::DataLayoutIndexed dataLayout,
+                   int32_t                       outputOffset,
+                   const uint8_t*                inputData,
+                   uint8_t*                      outputData)
+{
+    const float* scale = quantizedScaleShift.m_Scale.data();
+    const float* shift = quantizedScaleShift.m_Shift.data();
+    const float offset = boost::numeric_cast<float>(outputOffset);
+
+    // Rounds before adding the output offset, as armnn::Quantize does.
+    auto quantize = [offset](float value)
+    {
+        return static_cast<uint8_t>(std::min(std::max(std::round(value) + offset, 0.f), 255.f));
+    };
+
+    ForEachChannelRun(shape, dataLayout, inputData, outputData,
+        [&](const uint8_t* in, uint8_t* out, unsigned int channel, unsigned int length)
+        {
+            const float mult = scale[channel];
+            const float add = shift[channel];
+            for (unsigned int i = 0; i < length; ++i)
+            {
+                out[i] = quantize(static_cast<float>(in[i]) * mult + add);
+            }
+        },
+        [&](const uint8_t* in, uint8_t* out, unsigned int numChannels)
+        {
+            for (unsigned int c = 0; c < numChannels; ++c)
+            {
+                out[c] = quantize(static_cast<float>(in[c]) * scale[c] + shift[c]);
+            }
+        });
+}
+
+} //namespace armnn
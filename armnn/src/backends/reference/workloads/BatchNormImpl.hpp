@@ -5,60 +5,51 @@
 
 #pragma once
 
-#include "RefWorkloadUtils.hpp"
-#include "TensorBufferArrayView.hpp"
-
 #include <armnn/Tensor.hpp>
 
 #include <DataLayoutIndexed.hpp>
 
-#include <cmath>
+#include <cstdint>
+#include <vector>
 
 namespace armnn
 {
 
-template<typename NormData>
-static void BatchNormImpl(NormData     data,
-                          const float* varIn,
-                          const float* meanIn,
-                          const float* gammaIn,
-                          const float* betaIn,
-                          float*       outputData,
-                          const float* inputData)
+/// Batch normalization folded into one multiply-add per element: output = input * m_Scale[c] + m_Shift[c], with
+/// m_Scale = gamma / sqrt(variance + eps) and m_Shift = beta - m_Scale * mean. The constants do not change between
+/// inferences, so workloads compute this once, at construction.
+struct BatchNormScaleShift
 {
-    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
-
-    TensorBufferArrayView<const float> input(inputInfo.GetShape(),
-                                             inputData,
-                                             data.m_Parameters.m_DataLayout);
-    TensorBufferArrayView<float> output(outputInfo.GetShape(),
-                                        outputData,
-                                        data.m_Parameters.m_DataLayout);
-
-    armnnUtils::DataLayoutIndexed dataLayout(data.m_Parameters.m_DataLayout);
-
-    for (unsigned int c = 0; c < inputInfo.GetShape()[dataLayout.GetChannelsIndex()]; c++)
-    {
-        float var   = varIn[c];
-        float mean  = meanIn[c];
-        float gamma = gammaIn[c];
-        float beta  = betaIn[c];
-
-        float mult = gamma / sqrtf(var + data.m_Parameters.m_Eps);
-        float add  = beta - mult * mean;
-
-        for (unsigned int n = 0; n < inputInfo.GetShape()[0]; n++)
-        {
-            for (unsigned int h = 0; h < inputInfo.GetShape()[dataLayout.GetHeightIndex()]; h++)
-            {
-                for (unsigned int w = 0; w < inputInfo.GetShape()[dataLayout.GetWidthIndex()]; w++)
-                {
-                    output.Get(n, c, h, w) = mult * input.Get(n, c, h, w) + add;
-                }
-            }
-        }
-    }
-}
+    BatchNormScaleShift(const float* mean,
+                        const float* variance,
+                        const float* beta,
+                        const float* gamma,
+                        unsigned int numChannels,
+                        float        eps);
+
+    std::vector<float> m_Scale;
+    std::vector<float> m_Shift;
+};
+
+/// Applies @a scaleShift to every channel of an NCHW or NHWC tensor.
+void BatchNormImpl(const BatchNormScaleShift&    scaleShift,
+                   const TensorShape&            shape,
+                   armnnUtils::DataLayoutIndexed dataLayout,
+                   const float*                  inputData,
+                   float*                        outputData);
+
+/// Folds the quantization parameters of a QAsymm8 input and output into @a scaleShift, so that the result maps
+/// quantized input values to unrounded output values before the output offset.
+BatchNormScaleShift FoldQuantization(const BatchNormScaleShift& scaleShift,
+                                     const TensorInfo&          inputInfo,
+                                     const TensorInfo&          outputInfo);
+
+/// Applies @a quantizedScaleShift, made by FoldQuantization, to a QAsymm8 tensor without dequantizing it.
+void BatchNormImpl(const BatchNormScaleShift&    quantizedScaleShift,
+                   const TensorShape&            shape,
+                   armnnUtils::DataLayoutIndexed dataLayout,
+                   int32_t                       outputOffset,
+                   const uint8_t*                inputData,
+                   uint8_t*                      outputData);
 
 } //namespace armnn
@@ -4,6 +4,7 @@
 //
 
 #include "BatchToSpaceNd.hpp"
+#include "CopyPlan.hpp"
 
 #include "RefWorkloadUtils.hpp"
 
@@ -11,34 +12,33 @@
 
 #include <boost/assert.hpp>
 
+#include <algorithm>
+#include <cstddef>
+
 using namespace armnnUtils;
 
 namespace armnn
 {
 
-inline unsigned int Offset(const TensorShape& shape, unsigned int batch, unsigned int height, unsigned int width,
-        unsigned int channels, const DataLayoutIndexed& dataLayout)
+namespace
 {
-    if (dataLayout.GetDataLayout() == DataLayout::NHWC)
-    {
-        return ((batch * shape[dataLayout.GetHeightIndex()] + height) * shape[dataLayout.GetWidthIndex()] + width) *
-               shape[dataLayout.GetChannelsIndex()] + channels;
-    }
-    else
-    {
-        return ((batch * shape[dataLayout.GetChannelsIndex()] + channels) *
-               shape[dataLayout.GetHeightIndex()] + height) *
-               shape[dataLayout.GetWidthIndex()] + width;
-    }
+
+/// Returns the smallest index i for which i * block + shift >= threshold.
+unsigned int FirstBlockIndexAtOrAbove(unsigned int threshold, unsigned int shift, unsigned int block)
+{
+    return threshold <= shift ? 0 : (threshold - shift + block - 1) / block;
 }
 
+} // anonymous namespace
+
+template <typename T>
 void BatchToSpaceNd(const DataLayoutIndexed& dataLayout,
                     const TensorInfo& inputTensorInfo,
                     const TensorInfo& outputTensorInfo,
                     const std::vector<unsigned int>& blockShape,
                     const std::vector<std::pair<unsigned int, unsigned int>>& cropsData,
-                    const float* inputData,
-                    float* outputData)
+                    const T* inputData,
+                    T* outputData)
 {
     TensorShape inputShape = inputTensorInfo.GetShape();
 
@@ -49,6 +49,8 @@ void BatchToSpaceNd(const DataLayoutIndexed& dataLayout,
     BOOST_ASSERT_MSG(outputShape.GetNumDimensions() == 4, "Expected Output with 4 Dimensions");
 
     const unsigned int inputBatchSize = inputShape[0];
+    const unsigned int inputHeight = inputShape[dataLayout.GetHeightIndex()];
+    const unsigned int inputWidth = inputShape[dataLayout.GetWidthIndex()];
     const unsigned int channels = inputShape[dataLayout.GetChannelsIndex()];
 
     const unsigned int outputBatchSize = outputShape[0];
@@ -65,36 +67,62 @@ void BatchToSpaceNd(const DataLayoutIndexed& dataLayout,
     const unsigned int cropsTop = cropsData[0].first;
     const unsigned int cropsLeft = cropsData[1].first;
 
+    const ImageStrides inputStrides(inputShape, dataLayout.GetDataLayout());
+    const ImageStrides outputStrides(outputShape, dataLayout.GetDataLayout());
+
+    // Input pixel (inH, inW) of batch inBatch lands on output pixel (inH * blockShapeHeight + shiftH - cropsTop,
+    // inW * blockShapeWidth + shiftW - cropsLeft) of batch outBatch: a subsampled view of the output.
+    ImageStrides blockedOutputStrides = outputStrides;
+    blockedOutputStrides.m_Height *= blockShapeHeight;
+    blockedOutputStrides.m_Width *= blockShapeWidth;
+
     for (unsigned int inBatch = 0; inBatch < inputBatchSize; ++inBatch)
     {
         const unsigned int outBatch = inBatch % outputBatchSize;
         const unsigned int spatialOffset = inBatch / outputBatchSize;
-
-        for (unsigned int inH = 0; inH < inputTensorInfo.GetShape()[dataLayout.GetHeightIndex()]; ++inH) {
-            const unsigned int outH = inH * blockShapeHeight + spatialOffset / blockShapeWidth - cropsTop;
-
-            if (outH >= outputHeight)
-            {
-                continue;
-            }
-
-            for (unsigned int inW = 0; inW < inputTensorInfo.GetShape()[dataLayout.GetWidthIndex()]; ++inW) {
-                const unsigned int outW = inW * blockShapeWidth + spatialOffset % blockShapeWidth - cropsLeft;
-
-                if (outW >= outputWidth)
-                {
-                    continue;
-                }
-
-                for (unsigned int c = 0; c < channels; c++)
-                {
-                    unsigned int outOffset = Offset(outputShape, outBatch, outH, outW, c, dataLayout);
-                    unsigned int inOffset = Offset(inputShape, inBatch, inH, inW, c, dataLayout);
-                    outputData[outOffset] = inputData[inOffset];
-                }
-            }
+        const unsigned int shiftH = spatialOffset / blockShapeWidth;
+        const unsigned int shiftW = spatialOffset % blockShapeWidth;
+
+        // The input rows and columns that are not cropped away.
+        const unsigned int beginH = std::min(inputHeight, FirstBlockIndexAtOrAbove(cropsTop, shiftH, blockShapeHeight));
+        const unsigned int endH = std::max(beginH, std::min(inputHeight,
+            FirstBlockIndexAtOrAbove(cropsTop + outputHeight, shiftH, blockShapeHeight)));
+        const unsigned int beginW = std::min(inputWidth, FirstBlockIndexAtOrAbove(cropsLeft, shiftW, blockShapeWidth));
+        const unsigned int endW = std::max(beginW, std::min(inputWidth,
+            FirstBlockIndexAtOrAbove(cropsLeft + outputWidth, shiftW, blockShapeWidth)));
+
+        if (endH == beginH || endW == beginW)
+        {
+            continue;
         }
+
+        const std::ptrdiff_t inOffset = static_cast<std::ptrdiff_t>(inBatch) * inputStrides.m_Batch +
+                                        static_cast<std::ptrdiff_t>(beginH) * inputStrides.m_Height +
+                                        static_cast<std::ptrdiff_t>(beginW) * inputStrides.m_Width;
+        const std::ptrdiff_t outOffset =
+            static_cast<std::ptrdiff_t>(outBatch) * outputStrides.m_Batch +
+            static_cast<std::ptrdiff_t>(beginH * blockShapeHeight + shiftH - cropsTop) * outputStrides.m_Height +
+            static_cast<std::ptrdiff_t>(beginW * blockShapeWidth + shiftW - cropsLeft) * outputStrides.m_Width;
+        CopyPlan(MakeImageBox(dataLayout.GetDataLayout(), endH - beginH, endW - beginW, channels,
+                              inputStrides, blockedOutputStrides))
+            .Copy(inputData + inOffset, outputData + outOffset, sizeof(T));
     }
 }
 
+template void BatchToSpaceNd<float>(const DataLayoutIndexed& dataLayout,
+                                    const TensorInfo& inputTensorInfo,
+                                    const TensorInfo& outputTensorInfo,
+                                    const std::vector<unsigned int>& blockShape,
+                                    const std::vector<std::pair<unsigned int, unsigned int>>& cropsData,
+                                    const float* inputData,
+                                    float* outputData);
+
+template void BatchToSpaceNd<uint8_t>(const DataLayoutIndexed& dataLayout,
+                                      const TensorInfo& inputTensorInfo,
+                                      const TensorInfo& outputTensorInfo,
+                                      const std::vector<unsigned int>& blockShape,
+                                      const std::vector<std::pair<unsigned int, unsigned int>>& cropsData,
+                                      const uint8_t* inputData,
+                                      uint8_t* outputData);
+
 } //namespace armnn
@@ -15,11 +15,12 @@
 namespace armnn
 {
 
+template <typename T>
 void BatchToSpaceNd(const armnnUtils::DataLayoutIndexed& dataLayout,
                     const TensorInfo& inputTensorInfo,
                     const TensorInfo& outputTensorInfo,
                     const std::vector<unsigned int>& blockShape,
                     const std::vector<std::pair<unsigned int, unsigned int>>& cropsData,
-                    const float* inputData,
-                    float* outputData);
+                    const T* inputData,
+                    T* outputData);
 } // namespace armnn
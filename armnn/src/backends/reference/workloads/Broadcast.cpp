@@ -28,6 +28,47 @@ BroadcastLoop::BroadcastLoop(const TensorShape& inShape0, const TensorShape& inS
         sIn1 *= inShape1[j];
         sOut *= outShape[j];
     }
+
+    CollapseDimensions();
+}
+
+void BroadcastLoop::CollapseDimensions()
+{
+    // Dimensions of size 1 contribute nothing. Two neighbouring dimensions can be walked as one when, for every
+    // tensor, stepping once along the outer one is the same as stepping through the whole of the inner one: both
+    // contiguous, or both broadcast (stride 0). Same-shape operands thus collapse to a single dimension and
+    // row or column broadcasts to two, whatever the rank.
+    std::vector<BroadcastDimensionData> collapsed;
+    for (const BroadcastDimensionData& dim : m_DimData)
+    {
+        if (dim.m_DimSize == 1)
+        {
+            continue;
+        }
+
+        if (!collapsed.empty())
+        {
+            BroadcastDimensionData& outer = collapsed.back();
+            if (outer.m_Stride1 == dim.m_Stride1 * dim.m_DimSize &&
+                outer.m_Stride2 == dim.m_Stride2 * dim.m_DimSize &&
+                outer.m_StrideOut == dim.m_StrideOut * dim.m_DimSize)
+            {
+                outer.m_DimSize *= dim.m_DimSize;
+                outer.m_Stride1 = dim.m_Stride1;
+                outer.m_Stride2 = dim.m_Stride2;
+                outer.m_StrideOut = dim.m_StrideOut;
+                continue;
+            }
+        }
+        collapsed.push_back(dim);
+    }
+
+    if (collapsed.empty())
+    {
+        // Every dimension has size 1: a single element.
+        collapsed.push_back({ 1, 1, 0, 0 });
+    }
+    m_DimData = std::move(collapsed);
 }
 
 } // namespace armnn
@@ -3,9 +3,13 @@
 // SPDX-License-Identifier: MIT
 //
 
+#pragma once
+
 #include "BaseIterator.hpp"
 #include <armnn/Tensor.hpp>
 
+#include <algorithm>
+#include <array>
 #include <functional>
 
 namespace armnn
@@ -56,6 +60,67 @@ struct BroadcastLoop
         outData -= outDataMovement;
     }
 
+    /// Visits the output elements [begin, end) in runs along the innermost dimension, calling
+    /// runFunc(offset0, offset1, offsetOut, length) for each run. Within a run the output is contiguous and each
+    /// input advances by GetInnerStride0() / GetInnerStride1(), which are 1 for a contiguous run and 0 for a
+    /// broadcast value.
+    template <typename RunFunc>
+    void ForEachRun(unsigned int begin, unsigned int end, RunFunc runFunc) const
+    {
+        if (begin >= end)
+        {
+            return;
+        }
+
+        const unsigned int numOuterDims = static_cast<unsigned int>(m_DimData.size()) - 1;
+        const BroadcastDimensionData& inner = m_DimData.back();
+
+        // Position of 'begin': the coordinates of its run in the outer dimensions, and the offsets of that run.
+        std::array<unsigned int, MaxNumOfTensorDimensions> coords = {};
+        unsigned int runIndex = begin / inner.m_DimSize;
+        unsigned int column   = begin % inner.m_DimSize;
+        unsigned int base0 = 0;
+        unsigned int base1 = 0;
+        for (unsigned int d = numOuterDims; d-- > 0;)
+        {
+            coords[d] = runIndex % m_DimData[d].m_DimSize;
+            runIndex /= m_DimData[d].m_DimSize;
+            base0 += coords[d] * m_DimData[d].m_Stride1;
+            base1 += coords[d] * m_DimData[d].m_Stride2;
+        }
+
+        unsigned int outOffset = begin;
+        while (true)
+        {
+            const unsigned int length = std::min(inner.m_DimSize - column, end - outOffset);
+            runFunc(base0 + column * inner.m_Stride1, base1 + column * inner.m_Stride2, outOffset, length);
+
+            outOffset += length;
+            if (outOffset >= end)
+            {
+                return;
+            }
+
+            // Step to the start of the next run, carrying through the outer dimensions.
+            column = 0;
+            for (unsigned int d = numOuterDims; d-- > 0;)
+            {
+                base0 += m_DimData[d].m_Stride1;
+                base1 += m_DimData[d].m_Stride2;
+                if (++coords[d] < m_DimData[d].m_DimSize)
+                {
+                    break;
+                }
+                base0 -= m_DimData[d].m_Stride1 * m_DimData[d].m_DimSize;
+                base1 -= m_DimData[d].m_Stride2 * m_DimData[d].m_DimSize;
+                coords[d] = 0;
+            }
+        }
+    }
+
+    unsigned int GetInnerStride0() const { return m_DimData.back().m_Stride1; }
+    unsigned int GetInnerStride1() const { return m_DimData.back().m_Stride2; }
+
 private:
     // Struct to hold the dimension data.
     struct BroadcastDimensionData
@@ -66,6 +131,9 @@ private:
         unsigned int m_Stride2;
     };
 
+    /// Drops dimensions of size 1 and merges neighbouring dimensions that can be walked as one.
+    void CollapseDimensions();
+
     std::vector<BroadcastDimensionData> m_DimData;
 };
 
@@ -0,0 +1,243 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "CopyPlan.hpp"
+
+#include <ParallelFor.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Copies run at memory bandwidth, so only a few hundred kilobytes are worth a task of their own.
+constexpr unsigned int g_MinBytesPerTask = 256 * 1024;
+
+template <typename T>
+void CopyStridedRun(const char* input, char* output, unsigned int length,
+                    std::ptrdiff_t inputStride, std::ptrdiff_t outputStride)
+{
+    const T* in = reinterpret_cast<const T*>(input);
+    T* out = reinterpret_cast<T*>(output);
+    for (unsigned int i = 0; i < length; ++i)
+    {
+        out[static_cast<std::ptrdiff_t>(i) * outputStride] = in[static_cast<std::ptrdiff_t>(i) * inputStride];
+    }
+}
+
+} // anonymous namespace
+
+CopyPlan::CopyPlan(const std::vector<CopyDimension>& dimensions)
+    : m_NumRuns(1)
+{
+    for (const CopyDimension& dimension : dimensions)
+    {
+        if (dimension.m_Size == 0)
+        {
+            // An empty box: nothing to copy.
+            m_Dimensions.assign(1, { 0, 1, 1 });
+            m_NumRuns = 0;
+            return;
+        }
+        if (dimension.m_Size == 1)
+        {
+            continue;
+        }
+
+        if (!m_Dimensions.empty())
+        {
+            CopyDimension& outer = m_Dimensions.back();
+            const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(dimension.m_Size);
+            if (outer.m_InputStride == dimension.m_InputStride * size &&
+                outer.m_OutputStride == dimension.m_OutputStride * size)
+            {
+                outer = { outer.m_Size * dimension.m_Size, dimension.m_InputStride, dimension.m_OutputStride };
+                continue;
+            }
+        }
+        m_Dimensions.push_back(dimension);
+    }
+
+    if (m_Dimensions.empty())
+    {
+        m_Dimensions.push_back({ 1, 1, 1 });
+    }
+    for (size_t d = 0; d + 1 < m_Dimensions.size(); ++d)
+    {
+        m_NumRuns *= m_Dimensions[d].m_Size;
+    }
+}
+
+template <typename RunFunc>
+void CopyPlan::ForEachRun(unsigned int elementSize, RunFunc runFunc) const
+{
+    const unsigned int runBytes = std::max(1u, m_Dimensions.back().m_Size * elementSize);
+    const unsigned int minRunsPerTask = std::max(1u, g_MinBytesPerTask / runBytes);
+    const size_t numOuter = m_Dimensions.size() - 1;
+
+    armnnUtils::ParallelFor(m_NumRuns, minRunsPerTask, [&](unsigned int begin, unsigned int end)
+    {
+        // Start the odometer over the outer dimensions at run 'begin'.
+        std::vector<unsigned int> index(numOuter);
+        std::ptrdiff_t inputOffset = 0;
+        std::ptrdiff_t outputOffset = 0;
+        unsigned int remainder = begin;
+        for (size_t d = numOuter; d-- > 0;)
+        {
+            index[d] = remainder % m_Dimensions[d].m_Size;
+            remainder /= m_Dimensions[d].m_Size;
+            inputOffset += static_cast<std::ptrdiff_t>(index[d]) * m_Dimensions[d].m_InputStride;
+            outputOffset += static_cast<std::ptrdiff_t>(index[d]) * m_Dimensions[d].m_OutputStride;
+        }
+
+        for (unsigned int run = begin; run < end; ++run)
+        {
+            runFunc(inputOffset, outputOffset);
+
+            for (size_t d = numOuter; d-- > 0;)
+            {
+                inputOffset += m_Dimensions[d].m_InputStride;
+                outputOffset += m_Dimensions[d].m_OutputStride;
+                if (++index[d] < m_Dimensions[d].m_Size)
+                {
+                    break;
+                }
+                const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(m_Dimensions[d].m_Size);
+                inputOffset -= size * m_Dimensions[d].m_InputStride;
+                outputOffset -= size * m_Dimensions[d].m_OutputStride;
+                index[d] = 0;
+            }
+        }
+    });
+}
+
+void CopyPlan::Copy(const void* input, void* output, unsigned int elementSize) const
+{
+    const char* in = static_cast<const char*>(input);
+    char* out = static_cast<char*>(output);
+    const CopyDimension& inner = m_Dimensions.back();
+    const std::ptrdiff_t bytes = static_cast<std::ptrdiff_t>(elementSize);
+
+    if (inner.m_InputStride == 1 && inner.m_OutputStride == 1)
+    {
+        const size_t runBytes = inner.m_Size * elementSize;
+        ForEachRun(elementSize, [&](std::ptrdiff_t inputOffset, std::ptrdiff_t outputOffset)
+        {
+            std::memcpy(out + outputOffset * bytes, in + inputOffset * bytes, runBytes);
+        });
+        return;
+    }
+
+    ForEachRun(elementSize, [&](std::ptrdiff_t inputOffset, std::ptrdiff_t outputOffset)
+    {
+        const char* runIn = in + inputOffset * bytes;
+        char* runOut = out + outputOffset * bytes;
+        switch (elementSize)
+        {
+            case 1:
+                CopyStridedRun<uint8_t>(runIn, runOut, inner.m_Size, inner.m_InputStride, inner.m_OutputStride);
+                break;
+            case 2:
+                CopyStridedRun<uint16_t>(runIn, runOut, inner.m_Size, inner.m_InputStride, inner.m_OutputStride);
+                break;
+            case 4:
+                CopyStridedRun<uint32_t>(runIn, runOut, inner.m_Size, inner.m_InputStride, inner.m_OutputStride);
+                break;
+            default:
+                for (unsigned int i = 0; i < inner.m_Size; ++i)
+                {
+                    const std::ptrdiff_t element = static_cast<std::ptrdiff_t>(i);
+                    std::memcpy(runOut + element * inner.m_OutputStride * bytes,
+                                runIn + element * inner.m_InputStride * bytes,
+                                elementSize);
+                }
+                break;
+        }
+    });
+}
+
+void CopyPlan::Zero(void* output, unsigned int elementSize) const
+{
+    char* out = static_cast<char*>(output);
+    const CopyDimension& inner = m_Dimensions.back();
+    const std::ptrdiff_t bytes = static_cast<std::ptrdiff_t>(elementSize);
+
+    if (inner.m_OutputStride == 1)
+    {
+        const size_t runBytes = inner.m_Size * elementSize;
+        ForEachRun(elementSize, [&](std::ptrdiff_t, std::ptrdiff_t outputOffset)
+        {
+            std::memset(out + outputOffset * bytes, 0, runBytes);
+        });
+        return;
+    }
+
+    ForEachRun(elementSize, [&](std::ptrdiff_t, std::ptrdiff_t outputOffset)
+    {
+        char* runOut = out + outputOffset * bytes;
+        for (unsigned int i = 0; i < inner.m_Size; ++i)
+        {
+            std::memset(runOut + static_cast<std::ptrdiff_t>(i) * inner.m_OutputStride * bytes, 0, elementSize);
+        }
+    });
+}
+
+std::vector<std::ptrdiff_t> GetRowMajorStrides(const TensorShape& shape)
+{
+    std::vector<std::ptrdiff_t> strides(shape.GetNumDimensions());
+    std::ptrdiff_t stride = 1;
+    for (unsigned int d = shape.GetNumDimensions(); d-- > 0;)
+    {
+        strides[d] = stride;
+        stride *= static_cast<std::ptrdiff_t>(shape[d]);
+    }
+    return strides;
+}
+
+ImageStrides::ImageStrides(const TensorShape& shape, DataLayout dataLayout)
+{
+    BOOST_ASSERT_MSG(shape.GetNumDimensions() == 4, "Expected a 4D image tensor");
+    const std::vector<std::ptrdiff_t> strides = GetRowMajorStrides(shape);
+    m_Batch = strides[0];
+    if (dataLayout == DataLayout::NHWC)
+    {
+        m_Height = strides[1];
+        m_Width = strides[2];
+        m_Channels = strides[3];
+    }
+    else
+    {
+        m_Channels = strides[1];
+        m_Height = strides[2];
+        m_Width = strides[3];
+    }
+}
+
+std::vector<CopyDimension> MakeImageBox(DataLayout dataLayout,
+                                        unsigned int height,
+                                        unsigned int width,
+                                        unsigned int channels,
+                                        const ImageStrides& input,
+                                        const ImageStrides& output)
+{
+    const CopyDimension heightDimension = { height, input.m_Height, output.m_Height };
+    const CopyDimension widthDimension = { width, input.m_Width, output.m_Width };
+    const CopyDimension channelDimension = { channels, input.m_Channels, output.m_Channels };
+
+    if (dataLayout == DataLayout::NHWC)
+    {
+        return { heightDimension, widthDimension, channelDimension };
+    }
+    return { channelDimension, heightDimension, widthDimension };
+}
+
+} //namespace armnn
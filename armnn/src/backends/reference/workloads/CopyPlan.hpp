@@ -0,0 +1,85 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace armnn
+{
+
+/// One dimension of a strided box of elements: its size, and the distance in elements between consecutive indices
+/// in the input and in the output. Input strides may be negative (e.g. a reversing strided slice).
+struct CopyDimension
+{
+    unsigned int   m_Size;
+    std::ptrdiff_t m_InputStride;
+    std::ptrdiff_t m_OutputStride;
+};
+
+/// Plans the copy of an N-d box of elements from one strided view to another, as done by the data movement layers.
+///
+/// Size-1 dimensions are dropped and adjacent dimensions that are contiguous in both views are merged, so that the
+/// copy becomes a set of runs along the innermost remaining dimension. Runs that are contiguous in both views are
+/// copied with memcpy (or cleared with memset) and large copies are split over threads with ParallelFor.
+class CopyPlan
+{
+public:
+    /// @a dimensions are given outermost first.
+    explicit CopyPlan(const std::vector<CopyDimension>& dimensions);
+
+    /// Returns the number of dimensions left after merging; 1 for a box that is a single run.
+    unsigned int GetNumDimensions() const { return static_cast<unsigned int>(m_Dimensions.size()); }
+
+    /// Copies the box from @a input to @a output, both pointing at the element with index 0 in every dimension.
+    void Copy(const void* input, void* output, unsigned int elementSize) const;
+
+    /// Sets every byte of the box in @a output to zero. The input strides are not read, but still take part in
+    /// merging dimensions: a plan made only for clearing should repeat the output strides (see MakeFillDimension).
+    void Zero(void* output, unsigned int elementSize) const;
+
+private:
+    template <typename RunFunc>
+    void ForEachRun(unsigned int elementSize, RunFunc runFunc) const;
+
+    std::vector<CopyDimension> m_Dimensions;
+    unsigned int               m_NumRuns;
+};
+
+/// Returns a dimension for a plan that is only used to clear the output.
+inline CopyDimension MakeFillDimension(unsigned int size, std::ptrdiff_t outputStride)
+{
+    return { size, outputStride, outputStride };
+}
+
+/// Returns the row-major strides, in elements, of a tensor of the given shape.
+std::vector<std::ptrdiff_t> GetRowMajorStrides(const TensorShape& shape);
+
+/// Strides, in elements, of the batch, height, width and channel indices of a 4D NHWC or NCHW tensor.
+struct ImageStrides
+{
+    ImageStrides(const TensorShape& shape, DataLayout dataLayout);
+
+    std::ptrdiff_t m_Batch;
+    std::ptrdiff_t m_Height;
+    std::ptrdiff_t m_Width;
+    std::ptrdiff_t m_Channels;
+};
+
+/// Returns the dimensions of a box of @a height x @a width pixels of @a channels channels, in the memory order of
+/// @a dataLayout. The per-pixel strides of each view are given by @a input and @a output, so that blocked or
+/// subsampled views (as in SpaceToBatchNd and BatchToSpaceNd) can be described by scaling them.
+std::vector<CopyDimension> MakeImageBox(DataLayout dataLayout,
+                                        unsigned int height,
+                                        unsigned int width,
+                                        unsigned int channels,
+                                        const ImageStrides& input,
+                                        const ImageStrides& output);
+
+} //namespace armnn
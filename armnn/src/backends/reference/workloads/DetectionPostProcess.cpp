@@ -7,6 +7,8 @@
 
 #include <armnn/ArmNN.hpp>
 
+#include <ParallelFor.hpp>
+
 #include <boost/assert.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 
@@ -29,7 +31,8 @@ void TopKSort(unsigned int k, unsigned int* indices, const float* values, unsign
                       [&values](unsigned int i, unsigned int j) { return values[i] > values[j]; });
 }
 
-float IntersectionOverUnion(const float* boxI, const float* boxJ)
+/// Scalar definition of the IoU of two boxes; NonMaxSuppression evaluates the same expression over whole arrays.
+inline float IntersectionOverUnion(const float* boxI, const float* boxJ)
 {
     // Box-corner format: ymin, xmin, ymax, xmax.
     const int yMin = 0;
@@ -48,54 +51,118 @@ float IntersectionOverUnion(const float* boxI, const float* boxJ)
     return areaIntersection / areaUnion;
 }
 
-std::vector<unsigned int> NonMaxSuppression(unsigned int numBoxes, const std::vector<float>& boxCorners,
-                                            const std::vector<float>& scores, float nmsScoreThreshold,
-                                            unsigned int maxDetection, float nmsIouThreshold)
+/// Scratch space for NonMaxSuppression, kept between calls so that per-class NMS does not allocate.
+struct NmsScratch
+{
+    std::vector<float>        m_Scores;
+    std::vector<unsigned int> m_Indices;
+    std::vector<unsigned int> m_SortedOrder;
+
+    // Corners and areas of the candidate boxes in descending score order, stored as separate arrays so that the
+    // IoU of one box against all the lower scoring ones is a straight, vectorizable loop.
+    std::vector<float>        m_YMin;
+    std::vector<float>        m_XMin;
+    std::vector<float>        m_YMax;
+    std::vector<float>        m_XMax;
+    std::vector<float>        m_Area;
+    std::vector<uint8_t>      m_Suppressed;
+
+    std::vector<unsigned int> m_Output;
+};
+
+/// Non max suppression over the boxes whose score, as returned by @a scoreAt(box), reaches @a nmsScoreThreshold.
+/// The indices of the selected boxes are left in scratch.m_Output.
+template <typename ScoreFunc>
+void NonMaxSuppression(unsigned int numBoxes, const float* boxCorners, ScoreFunc scoreAt, float nmsScoreThreshold,
+                       unsigned int maxDetection, float nmsIouThreshold, NmsScratch& scratch)
 {
     // Select boxes that have scores above a given threshold.
-    std::vector<float> scoresAboveThreshold;
-    std::vector<unsigned int> indicesAboveThreshold;
+    scratch.m_Scores.clear();
+    scratch.m_Indices.clear();
     for (unsigned int i = 0; i < numBoxes; ++i)
     {
-        if (scores[i] >= nmsScoreThreshold)
+        const float score = scoreAt(i);
+        if (score >= nmsScoreThreshold)
         {
-            scoresAboveThreshold.push_back(scores[i]);
-            indicesAboveThreshold.push_back(i);
+            scratch.m_Scores.push_back(score);
+            scratch.m_Indices.push_back(i);
         }
     }
 
     // Sort the indices based on scores.
-    unsigned int numAboveThreshold = boost::numeric_cast<unsigned int>(scoresAboveThreshold.size());
-    std::vector<unsigned int> sortedIndices = GenerateRangeK(numAboveThreshold);
-    TopKSort(numAboveThreshold,sortedIndices.data(), scoresAboveThreshold.data(), numAboveThreshold);
+    const unsigned int numAboveThreshold = boost::numeric_cast<unsigned int>(scratch.m_Scores.size());
+    scratch.m_SortedOrder.resize(numAboveThreshold);
+    std::iota(scratch.m_SortedOrder.begin(), scratch.m_SortedOrder.end(), 0);
+    TopKSort(numAboveThreshold, scratch.m_SortedOrder.data(), scratch.m_Scores.data(), numAboveThreshold);
+
+    // Gather the candidates in score order.
+    scratch.m_YMin.resize(numAboveThreshold);
+    scratch.m_XMin.resize(numAboveThreshold);
+    scratch.m_YMax.resize(numAboveThreshold);
+    scratch.m_XMax.resize(numAboveThreshold);
+    scratch.m_Area.resize(numAboveThreshold);
+    scratch.m_Suppressed.assign(numAboveThreshold, 0);
+    for (unsigned int i = 0; i < numAboveThreshold; ++i)
+    {
+        const float* box = boxCorners + scratch.m_Indices[scratch.m_SortedOrder[i]] * 4;
+        scratch.m_YMin[i] = box[0];
+        scratch.m_XMin[i] = box[1];
+        scratch.m_YMax[i] = box[2];
+        scratch.m_XMax[i] = box[3];
+        scratch.m_Area[i] = (box[2] - box[0]) * (box[3] - box[1]);
+    }
 
     // Number of output cannot be more than max detections specified in the option.
-    unsigned int numOutput = std::min(maxDetection, numAboveThreshold);
-    std::vector<unsigned int> outputIndices;
-    std::vector<bool> visited(numAboveThreshold, false);
+    const unsigned int numOutput = std::min(maxDetection, numAboveThreshold);
+    scratch.m_Output.clear();
 
-    // Prune out the boxes with high intersection over union by keeping the box with higher score.
-    for (unsigned int i = 0; i < numAboveThreshold; ++i)
+    // Prune out the boxes with high intersection over union by keeping the box with higher score. A suppressed box
+    // still suppresses the boxes below it, as in the pairwise formulation this replaces.
+    for (unsigned int i = 0; i < numAboveThreshold && scratch.m_Output.size() < numOutput; ++i)
     {
-        if (outputIndices.size() >= numOutput)
+        if (!scratch.m_Suppressed[i])
         {
-            break;
-        }
-        if (!visited[sortedIndices[i]])
-        {
-            outputIndices.push_back(indicesAboveThreshold[sortedIndices[i]]);
+            scratch.m_Output.push_back(scratch.m_Indices[scratch.m_SortedOrder[i]]);
+            if (scratch.m_Output.size() >= numOutput)
+            {
+                break;
+            }
         }
+
+        const float yMinI = scratch.m_YMin[i];
+        const float xMinI = scratch.m_XMin[i];
+        const float yMaxI = scratch.m_YMax[i];
+        const float xMaxI = scratch.m_XMax[i];
+        const float areaI = scratch.m_Area[i];
+        const float* yMin = scratch.m_YMin.data();
+        const float* xMin = scratch.m_XMin.data();
+        const float* yMax = scratch.m_YMax.data();
+        const float* xMax = scratch.m_XMax.data();
+        const float* area = scratch.m_Area.data();
+        uint8_t* suppressed = scratch.m_Suppressed.data();
         for (unsigned int j = i + 1; j < numAboveThreshold; ++j)
         {
-            unsigned int iIndex = indicesAboveThreshold[sortedIndices[i]] * 4;
-            unsigned int jIndex = indicesAboveThreshold[sortedIndices[j]] * 4;
-            if (IntersectionOverUnion(&boxCorners[iIndex], &boxCorners[jIndex]) > nmsIouThreshold)
-            {
-                visited[sortedIndices[j]] = true;
-            }
+            // Same arithmetic as IntersectionOverUnion(), so that the same boxes are suppressed.
+            const float yMinIntersection = std::max(yMinI, yMin[j]);
+            const float xMinIntersection = std::max(xMinI, xMin[j]);
+            const float yMaxIntersection = std::min(yMaxI, yMax[j]);
+            const float xMaxIntersection = std::min(xMaxI, xMax[j]);
+            const float areaIntersection = std::max(yMaxIntersection - yMinIntersection, 0.0f) *
+                                           std::max(xMaxIntersection - xMinIntersection, 0.0f);
+            const float areaUnion = areaI + area[j] - areaIntersection;
+            suppressed[j] |= static_cast<uint8_t>(areaIntersection / areaUnion > nmsIouThreshold);
         }
     }
-    return outputIndices;
+}
+
+std::vector<unsigned int> NonMaxSuppression(unsigned int numBoxes, const std::vector<float>& boxCorners,
+                                            const std::vector<float>& scores, float nmsScoreThreshold,
+                                            unsigned int maxDetection, float nmsIouThreshold)
+{
+    NmsScratch scratch;
+    NonMaxSuppression(numBoxes, boxCorners.data(), [&scores](unsigned int i) { return scores[i]; },
+                      nmsScoreThreshold, maxDetection, nmsIouThreshold, scratch);
+    return scratch.m_Output;
 }
 
 void AllocateOutputData(unsigned int numOutput, unsigned int numSelected, const std::vector<float>& boxCorners,
@@ -184,27 +251,36 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
     {
         // Perform Regular NMS.
         // For each class, perform NMS and select max detection numbers of the highest score across all classes.
-        std::vector<float> classScores(numBoxes);
+        // The classes are independent: run them in parallel, each task reusing one scratch space, and concatenate
+        // the selections in class order afterwards.
+        std::vector<std::vector<unsigned int>> selectedIndicesPerClass(desc.m_NumClasses);
+        armnnUtils::ParallelFor(desc.m_NumClasses, 1, [&](unsigned int begin, unsigned int end)
+        {
+            NmsScratch scratch;
+            for (unsigned int c = begin; c < end; ++c)
+            {
+                // For each boxes, get scores of the boxes for the class c.
+                const float* classScores = scores + c + 1;
+                NonMaxSuppression(numBoxes, boxCorners.data(),
+                                  [classScores, numClassesWithBg](unsigned int i)
+                                  {
+                                      return classScores[i * numClassesWithBg];
+                                  },
+                                  desc.m_NmsScoreThreshold, desc.m_DetectionsPerClass, desc.m_NmsIouThreshold,
+                                  scratch);
+                selectedIndicesPerClass[c] = scratch.m_Output;
+            }
+        });
+
         std::vector<unsigned int>selectedBoxesAfterNms;
         std::vector<float> selectedScoresAfterNms;
         std::vector<unsigned int> selectedClasses;
-
         for (unsigned int c = 0; c < desc.m_NumClasses; ++c)
         {
-            // For each boxes, get scores of the boxes for the class c.
-            for (unsigned int i = 0; i < numBoxes; ++i)
-            {
-                classScores[i] = scores[i * numClassesWithBg + c + 1];
-            }
-            std::vector<unsigned int> selectedIndices = NonMaxSuppression(numBoxes, boxCorners, classScores,
-                                                                          desc.m_NmsScoreThreshold,
-                                                                          desc.m_DetectionsPerClass,
-                                                                          desc.m_NmsIouThreshold);
-
-            for (unsigned int i = 0; i < selectedIndices.size(); ++i)
+            for (unsigned int boxIndex : selectedIndicesPerClass[c])
             {
-                selectedBoxesAfterNms.push_back(selectedIndices[i]);
-                selectedScoresAfterNms.push_back(classScores[selectedIndices[i]]);
+                selectedBoxesAfterNms.push_back(boxIndex);
+                selectedScoresAfterNms.push_back(scores[boxIndex * numClassesWithBg + c + 1]);
                 selectedClasses.push_back(c);
             }
         }
@@ -230,13 +306,17 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
         std::vector<float> maxScores;
         std::vector<unsigned int>boxIndices;
         std::vector<unsigned int>maxScoreClasses;
+        std::vector<unsigned int> maxScoreIndices(desc.m_NumClasses);
 
+        maxScores.reserve(numBoxes * numClassesPerBox);
+        boxIndices.reserve(numBoxes * numClassesPerBox);
+        maxScoreClasses.reserve(numBoxes * numClassesPerBox);
         for (unsigned int box = 0; box < numBoxes; ++box)
         {
             unsigned int scoreIndex = box * numClassesWithBg + 1;
 
             // Get the max scores of the box.
-            std::vector<unsigned int> maxScoreIndices = GenerateRangeK(desc.m_NumClasses);
+            std::iota(maxScoreIndices.begin(), maxScoreIndices.end(), 0);
             TopKSort(numClassesPerBox, maxScoreIndices.data(), scores + scoreIndex, desc.m_NumClasses);
 
             for (unsigned int i = 0; i < numClassesPerBox; ++i)
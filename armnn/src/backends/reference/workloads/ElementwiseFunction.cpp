@@ -10,9 +10,76 @@
 
 #include "Maximum.hpp"
 
+#include <ParallelFor.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/ignore_unused.hpp>
+
+#include <algorithm>
+
 namespace armnn
 {
 
+namespace
+{
+
+// Elementwise work is cheap, so only outputs of several tasks' worth of elements are split across threads.
+constexpr unsigned int g_MinElementsPerTask = 16384;
+
+/// Computes one run of output. The stride of each input is 1 (contiguous) or 0 (broadcast); each combination gets
+/// its own loop so that the compiler can vectorize it.
+template <typename Functor, typename InType, typename OutType>
+void ComputeRun(const InType* in0, const InType* in1, OutType* out,
+                unsigned int length, unsigned int stride0, unsigned int stride1)
+{
+    Functor func;
+    if (stride0 == 1 && stride1 == 1)
+    {
+        for (unsigned int i = 0; i < length; ++i)
+        {
+            out[i] = static_cast<OutType>(func(in0[i], in1[i]));
+        }
+    }
+    else if (stride0 == 0 && stride1 == 1)
+    {
+        const InType value0 = *in0;
+        for (unsigned int i = 0; i < length; ++i)
+        {
+            out[i] = static_cast<OutType>(func(value0, in1[i]));
+        }
+    }
+    else if (stride0 == 1 && stride1 == 0)
+    {
+        const InType value1 = *in1;
+        for (unsigned int i = 0; i < length; ++i)
+        {
+            out[i] = static_cast<OutType>(func(in0[i], value1));
+        }
+    }
+    else
+    {
+        std::fill(out, out + length, static_cast<OutType>(func(*in0, *in1)));
+    }
+}
+
+template <typename OutType>
+void ApplyActivation(OutType*, unsigned int, ActivationKernel activation, float, float)
+{
+    BOOST_ASSERT_MSG(activation == nullptr, "Fused activations are only supported for float outputs");
+    boost::ignore_unused(activation);
+}
+
+template <>
+void ApplyActivation<float>(float* out, unsigned int length, ActivationKernel activation, float a, float b)
+{
+    if (activation != nullptr)
+    {
+        activation(out, out, length, a, b);
+    }
+}
+
+} // anonymous namespace
+
 template <typename Functor>
 ElementwiseFunction<Functor>::ElementwiseFunction(const TensorShape& inShape0,
                                                    const TensorShape& inShape1,
@@ -24,6 +91,34 @@ ElementwiseFunction<Functor>::ElementwiseFunction(const TensorShape& inShape0,
     BroadcastLoop(inShape0, inShape1, outShape).Unroll(Functor(), 0, inData0, inData1, outData);
 }
 
+template <typename Functor>
+ElementwiseFunction<Functor>::ElementwiseFunction(const TensorShape& inShape0,
+                                                   const TensorShape& inShape1,
+                                                   const TensorShape& outShape,
+                                                   const InType* inData0,
+                                                   const InType* inData1,
+                                                   OutStorageType* outData,
+                                                   ActivationKernel activation,
+                                                   float activationA,
+                                                   float activationB)
+{
+    const BroadcastLoop loop(inShape0, inShape1, outShape);
+    const unsigned int stride0 = loop.GetInnerStride0();
+    const unsigned int stride1 = loop.GetInnerStride1();
+
+    armnnUtils::ParallelFor(outShape.GetNumElements(), g_MinElementsPerTask,
+        [&](unsigned int begin, unsigned int end)
+        {
+            loop.ForEachRun(begin, end,
+                [&](unsigned int offset0, unsigned int offset1, unsigned int offsetOut, unsigned int length)
+                {
+                    ComputeRun<Functor>(inData0 + offset0, inData1 + offset1, outData + offsetOut,
+                                        length, stride0, stride1);
+                    ApplyActivation(outData + offsetOut, length, activation, activationA, activationB);
+                });
+        });
+}
+
 } //namespace armnn
 
 template struct armnn::ElementwiseFunction<std::plus<float>>;
@@ -5,9 +5,12 @@
 
 #pragma once
 
+#include "Activation.hpp"
 #include "BaseIterator.hpp"
 #include <armnn/Tensor.hpp>
 
+#include <type_traits>
+
 namespace armnn
 {
 
@@ -17,12 +20,30 @@ struct ElementwiseFunction
     using OutType = typename Functor::result_type;
     using InType = typename Functor::first_argument_type;
 
+    /// Type of the output tensor's elements: Boolean tensors store one uint8_t per element.
+    using OutStorageType = typename std::conditional<std::is_same<OutType, bool>::value, uint8_t, OutType>::type;
+
     ElementwiseFunction(const TensorShape& inShape0,
                         const TensorShape& inShape1,
                         const TensorShape& outShape,
                         armnn::Decoder<InType>& inData0,
                         armnn::Decoder<InType>& inData1,
                         armnn::Encoder<OutType>& outData);
+
+    /// Fast path for tensors held as plain arrays of InType / OutStorageType. After collapsing dimensions, each run
+    /// of contiguous output is computed by a tight loop specialised for same-shape, scalar-broadcast or
+    /// fully broadcast operands, and large outputs are split across threads.
+    /// If @a activation is not null it is applied to each run of output while it is still in cache
+    /// (float outputs only).
+    ElementwiseFunction(const TensorShape& inShape0,
+                        const TensorShape& inShape1,
+                        const TensorShape& outShape,
+                        const InType* inData0,
+                        const InType* inData1,
+                        OutStorageType* outData,
+                        ActivationKernel activation = nullptr,
+                        float activationA = 0.0f,
+                        float activationB = 0.0f);
 };
 
 } //namespace armnn
@@ -0,0 +1,76 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace armnn
+{
+
+/// Branch-free approximations of transcendental functions, written so that loops calling them are vectorized by
+/// the compiler (no calls into libm, no data-dependent branches).
+///
+/// Error bounds, measured over every float in the given range against the double-precision result (the unit tests
+/// in RefKernelTests.cpp re-check them on a sample of the same range):
+///  - FastExp:     relative error < 2.6e-7 (measured maximum 2.55e-7, about 2 ulp) for x in [-87, 88]. Inputs are
+///                 clamped to [-87.3, 88.37], so the result saturates at about 2.4e38 instead of overflowing to
+///                 infinity, and never becomes denormal.
+///  - FastSigmoid: absolute error < 1.5e-7 (measured maximum 1.07e-7) for all finite x.
+///  - FastTanh:    absolute error < 2.5e-7 (measured maximum 2.13e-7) for all finite x.
+/// A NaN input produces a NaN result.
+
+/// Computes e^x as 2^n * e^r with n = round(x / ln 2) and |r| <= ln 2 / 2, using a degree 6 polynomial for e^r.
+inline float FastExp(float x)
+{
+    const float log2e     = 1.44269504088896341f;
+    const float ln2Hi     = 0.693359375f;       // ln 2 split in two parts so that n * ln2Hi is exact.
+    const float ln2Lo     = -2.12194440e-4f;
+    const float roundBias = 12582912.0f;        // 1.5 * 2^23: adding it rounds to the nearest integer.
+    const uint32_t roundBiasBits = 0x4B400000u; // Bit pattern of roundBias.
+
+    // The upper bound keeps n <= 127, the largest exponent of a finite float. NaN passes through both clamps.
+    x = std::min(std::max(x, -87.3f), 88.37f);
+
+    const float biased = x * log2e + roundBias;
+    const float n = biased - roundBias;
+    const float r = (x - n * ln2Hi) - n * ln2Lo;
+
+    // Taylor expansion of e^r, evaluated with Horner's scheme. The truncation error is below r^7 / 7! < 1.2e-7.
+    float p = 1.0f / 720.0f;
+    p = p * r + 1.0f / 120.0f;
+    p = p * r + 1.0f / 24.0f;
+    p = p * r + 1.0f / 6.0f;
+    p = p * r + 0.5f;
+    p = p * r + 1.0f;
+    p = p * r + 1.0f;
+
+    // n is held in the low mantissa bits of the biased value. Reading it from there rather than converting n to an
+    // integer keeps the computation defined for NaN (whose result is NaN through p). 2^n is then built directly in
+    // the exponent field.
+    uint32_t biasedBits;
+    std::memcpy(&biasedBits, &biased, sizeof(biasedBits));
+    const uint32_t exponentBits = (biasedBits - roundBiasBits + 127u) << 23;
+    float scale;
+    std::memcpy(&scale, &exponentBits, sizeof(scale));
+
+    return p * scale;
+}
+
+/// 1 / (1 + e^-x).
+inline float FastSigmoid(float x)
+{
+    return 1.0f / (1.0f + FastExp(-x));
+}
+
+/// tanh(x) = 1 - 2 / (e^2x + 1), which saturates cleanly to +/-1 for large |x|.
+inline float FastTanh(float x)
+{
+    return 1.0f - 2.0f / (FastExp(2.0f * x) + 1.0f);
+}
+
+} //namespace armnn
@@ -9,11 +9,25 @@
 
 #include <backendsCommon/WorkloadData.hpp>
 
+#include <ParallelFor.hpp>
+
+#include <boost/core/ignore_unused.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 namespace armnn
 {
 
+namespace
+{
+
+// Gathering only moves memory, so only a few hundred kilobytes are worth a task of their own.
+constexpr unsigned int g_MinBytesPerTask = 256 * 1024;
+
+} // anonymous namespace
+
 template <typename T>
 void Gather(const TensorInfo& paramsInfo,
             const TensorInfo& indicesInfo,
@@ -30,23 +44,24 @@ void Gather(const TensorInfo& paramsInfo,
         paramsProduct = paramsProduct * paramsShape[i];
     }
 
-    unsigned int outIndex = 0;
-    for (unsigned int i = 0; i < indicesInfo.GetNumElements(); ++i)
+    // Each index selects a contiguous slice of paramsProduct elements, copied whole.
+    const unsigned int numIndices = indicesInfo.GetNumElements();
+    BOOST_ASSERT(numIndices * paramsProduct == outputInfo.GetNumElements());
+    boost::ignore_unused(outputInfo);
+
+    const unsigned int sliceBytes = paramsProduct * boost::numeric_cast<unsigned int>(sizeof(T));
+    const unsigned int minIndicesPerTask = std::max(1u, g_MinBytesPerTask / sliceBytes);
+    armnnUtils::ParallelFor(numIndices, minIndicesPerTask, [&](unsigned int begin, unsigned int end)
     {
-        unsigned int indx = boost::numeric_cast<unsigned int>(indices[i]);
+        for (unsigned int i = begin; i < end; ++i)
+        {
+            unsigned int indx = boost::numeric_cast<unsigned int>(indices[i]);
 
-        BOOST_ASSERT(indices[i] >= 0 && indx < paramsShape[0]);
+            BOOST_ASSERT(indices[i] >= 0 && indx < paramsShape[0]);
 
-        unsigned int startOffset = indx * paramsProduct;
-        unsigned int endOffset = startOffset + paramsProduct;
-        for (unsigned int j = startOffset; j < endOffset; ++j)
-        {
-            output[outIndex] = params[j];
-            ++outIndex;
+            std::memcpy(output + i * paramsProduct, params + indx * paramsProduct, sliceBytes);
         }
-    }
-
-    BOOST_ASSERT(outIndex == outputInfo.GetNumElements());
+    });
 }
 
 template void Gather<float>(const TensorInfo& paramsInfo,
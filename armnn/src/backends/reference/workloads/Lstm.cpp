@@ -0,0 +1,361 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "Lstm.hpp"
+
+#include "Decoders.hpp"
+
+#include <ParallelFor.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/ignore_unused.hpp>
+
+#include <algorithm>
+#include <string>
+
+namespace armnn
+{
+
+namespace
+{
+
+// A task is only worth scheduling for several thousand multiply-accumulates.
+constexpr unsigned int g_MinMacsPerTask = 32768;
+
+// Vectors multiplied together by each pass over a matrix row, so that every weight loaded is used this many times.
+constexpr unsigned int g_BatchBlockSize = 4;
+
+/// Appends the dequantized contents of @a tensor, which must hold @a expectedSize elements, to @a out.
+void AppendAsFloat(const ConstCpuTensorHandle* tensor, unsigned int expectedSize, std::vector<float>& out)
+{
+    BOOST_ASSERT(tensor != nullptr);
+    const TensorInfo& info = tensor->GetTensorInfo();
+    BOOST_ASSERT(info.GetNumElements() == expectedSize);
+    boost::ignore_unused(expectedSize);
+
+    std::unique_ptr<Decoder<float>> decoder = MakeDecoder<float>(info, tensor->GetConstTensor<void>());
+    for (unsigned int i = 0; i < info.GetNumElements(); ++i)
+    {
+        out.push_back(decoder->Get());
+        ++(*decoder);
+    }
+}
+
+std::vector<float> ToFloat(const ConstCpuTensorHandle* tensor, unsigned int expectedSize)
+{
+    std::vector<float> values;
+    values.reserve(expectedSize);
+    AppendAsFloat(tensor, expectedSize, values);
+    return values;
+}
+
+/// out[b * outStride + r] += dot(matrix row r, vector b) for every row r and vector b. Rows are split over threads,
+/// and each row is multiplied with a block of vectors at a time so that its weights are loaded once per block.
+void MatrixBatchVectorMultiplyAccumulate(const float* matrix,
+                                         unsigned int rows,
+                                         unsigned int cols,
+                                         const float* vectors,
+                                         unsigned int numBatches,
+                                         float* out,
+                                         unsigned int outStride)
+{
+    const unsigned int macsPerRow = std::max(1u, cols * numBatches);
+    armnnUtils::ParallelFor(rows, std::max(1u, g_MinMacsPerTask / macsPerRow),
+                            [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int r = begin; r < end; ++r)
+        {
+            const float* row = matrix + r * cols;
+            unsigned int b = 0;
+            for (; b + g_BatchBlockSize <= numBatches; b += g_BatchBlockSize)
+            {
+                const float* v0 = vectors + b * cols;
+                const float* v1 = v0 + cols;
+                const float* v2 = v1 + cols;
+                const float* v3 = v2 + cols;
+                float sum0 = 0.0f;
+                float sum1 = 0.0f;
+                float sum2 = 0.0f;
+                float sum3 = 0.0f;
+                for (unsigned int c = 0; c < cols; ++c)
+                {
+                    const float weight = row[c];
+                    sum0 += weight * v0[c];
+                    sum1 += weight * v1[c];
+                    sum2 += weight * v2[c];
+                    sum3 += weight * v3[c];
+                }
+                out[b * outStride + r] += sum0;
+                out[(b + 1) * outStride + r] += sum1;
+                out[(b + 2) * outStride + r] += sum2;
+                out[(b + 3) * outStride + r] += sum3;
+            }
+            for (; b < numBatches; ++b)
+            {
+                const float* v = vectors + b * cols;
+                float sum = 0.0f;
+                for (unsigned int c = 0; c < cols; ++c)
+                {
+                    sum += row[c] * v[c];
+                }
+                out[b * outStride + r] += sum;
+            }
+        }
+    });
+}
+
+void ClipVector(float* vector, unsigned int size, float absLimit)
+{
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        vector[i] = std::max(-absLimit, std::min(absLimit, vector[i]));
+    }
+}
+
+} // anonymous namespace
+
+void SetActivationParameters(uint32_t activation,
+                             ActivationFunction& outArmnnActivation,
+                             float& outA,
+                             float& outB)
+{
+    switch (activation)
+    {
+    case 0: // None
+        outA = 0;
+        outB = 0;
+        return;
+
+    case 1: // Relu
+        outArmnnActivation = ActivationFunction::ReLu;
+        outA = 0;
+        outB = 0;
+        return;
+
+    case 3: // Relu6
+        outArmnnActivation = ActivationFunction::BoundedReLu;
+        outA = 6;
+        outB = 0;
+        return;
+
+    case 4: // Tanh
+        outArmnnActivation = ActivationFunction::TanH;
+        outA = 1;
+        outB = 1;
+        return;
+
+    case 6: // Sigmoid
+        outArmnnActivation = ActivationFunction::Sigmoid;
+        outA = 0;
+        outB = 0;
+        return;
+
+    default:
+        throw Exception("Unsupported activation function: " + std::to_string(activation));
+    }
+}
+
+LstmKernel::LstmKernel(const LstmQueueDescriptor& descriptor, unsigned int batchSize)
+    : m_BatchSize(batchSize)
+    , m_InputSize(descriptor.m_InputToOutputWeights->GetShape()[1])
+    , m_CellSize(descriptor.m_InputToOutputWeights->GetShape()[0])
+    , m_OutputSize(descriptor.m_RecurrentToOutputWeights->GetShape()[1])
+    , m_NumGates(descriptor.m_Parameters.m_CifgEnabled ? 3 : 4)
+    , m_CifgEnabled(descriptor.m_Parameters.m_CifgEnabled)
+    , m_PeepholeEnabled(descriptor.m_Parameters.m_PeepholeEnabled)
+    , m_ProjectionEnabled(descriptor.m_Parameters.m_ProjectionEnabled)
+    , m_ClippingThresCell(descriptor.m_Parameters.m_ClippingThresCell)
+    , m_ClippingThresProj(descriptor.m_Parameters.m_ClippingThresProj)
+    , m_GateActivation(GetActivationKernel(ActivationFunction::Sigmoid))
+    , m_CellActivation(nullptr)
+    , m_CellActivationA(0.0f)
+    , m_CellActivationB(0.0f)
+{
+    const LstmDescriptor& parameters = descriptor.m_Parameters;
+
+    ActivationFunction cellActivation = ActivationFunction::Sigmoid;
+    SetActivationParameters(parameters.m_ActivationFunc, cellActivation, m_CellActivationA, m_CellActivationB);
+    if (parameters.m_ActivationFunc > 0)
+    {
+        m_CellActivation = GetActivationKernel(cellActivation);
+    }
+
+    // Each gate contributes cellSize rows of [inputToGate, recurrentToGate] weights.
+    std::vector<std::pair<const ConstCpuTensorHandle*, const ConstCpuTensorHandle*>> gateWeights;
+    std::vector<const ConstCpuTensorHandle*> gateBiases;
+    if (!m_CifgEnabled)
+    {
+        gateWeights.emplace_back(descriptor.m_InputToInputWeights, descriptor.m_RecurrentToInputWeights);
+        gateBiases.push_back(descriptor.m_InputGateBias);
+    }
+    gateWeights.emplace_back(descriptor.m_InputToForgetWeights, descriptor.m_RecurrentToForgetWeights);
+    gateWeights.emplace_back(descriptor.m_InputToCellWeights, descriptor.m_RecurrentToCellWeights);
+    gateWeights.emplace_back(descriptor.m_InputToOutputWeights, descriptor.m_RecurrentToOutputWeights);
+    gateBiases.push_back(descriptor.m_ForgetGateBias);
+    gateBiases.push_back(descriptor.m_CellBias);
+    gateBiases.push_back(descriptor.m_OutputGateBias);
+
+    const unsigned int numCols = m_InputSize + m_OutputSize;
+    m_GateWeights.resize(m_NumGates * m_CellSize * numCols);
+    for (unsigned int gate = 0; gate < m_NumGates; ++gate)
+    {
+        const std::vector<float> inputWeights = ToFloat(gateWeights[gate].first, m_CellSize * m_InputSize);
+        const std::vector<float> recurrentWeights = ToFloat(gateWeights[gate].second, m_CellSize * m_OutputSize);
+        for (unsigned int cell = 0; cell < m_CellSize; ++cell)
+        {
+            float* row = &m_GateWeights[(gate * m_CellSize + cell) * numCols];
+            std::copy_n(&inputWeights[cell * m_InputSize], m_InputSize, row);
+            std::copy_n(&recurrentWeights[cell * m_OutputSize], m_OutputSize, row + m_InputSize);
+        }
+        AppendAsFloat(gateBiases[gate], m_CellSize, m_GateBias);
+    }
+
+    if (m_PeepholeEnabled)
+    {
+        if (!m_CifgEnabled)
+        {
+            m_CellToInputWeights = ToFloat(descriptor.m_CellToInputWeights, m_CellSize);
+        }
+        m_CellToForgetWeights = ToFloat(descriptor.m_CellToForgetWeights, m_CellSize);
+        m_CellToOutputWeights = ToFloat(descriptor.m_CellToOutputWeights, m_CellSize);
+    }
+
+    if (m_ProjectionEnabled)
+    {
+        m_ProjectionWeights = ToFloat(descriptor.m_ProjectionWeights, m_OutputSize * m_CellSize);
+        m_ProjectionBias = descriptor.m_ProjectionBias != nullptr ? ToFloat(descriptor.m_ProjectionBias, m_OutputSize)
+                                                                  : std::vector<float>(m_OutputSize, 0.0f);
+    }
+    else if (m_OutputSize != m_CellSize)
+    {
+        throw InvalidArgumentException("LstmKernel: without projection the output size must equal the cell size");
+    }
+
+    m_InputAndState.resize(m_BatchSize * numCols);
+    m_Gates.resize(m_BatchSize * m_NumGates * m_CellSize);
+    m_Hidden.resize(m_BatchSize * m_CellSize);
+}
+
+void LstmKernel::Run(const float* input,
+                     const float* outputStateIn,
+                     float* cellState,
+                     unsigned int numSteps,
+                     float* output) const
+{
+    const unsigned int inputStepSize = m_BatchSize * m_InputSize;
+    const unsigned int outputStepSize = m_BatchSize * m_OutputSize;
+    for (unsigned int step = 0; step < numSteps; ++step)
+    {
+        const float* stepOutputStateIn = step == 0 ? outputStateIn : output + (step - 1) * outputStepSize;
+        RunStep(input + step * inputStepSize, stepOutputStateIn, cellState, output + step * outputStepSize);
+    }
+}
+
+void LstmKernel::RunStep(const float* input, const float* outputStateIn, float* cellState, float* output) const
+{
+    const unsigned int numCols = m_InputSize + m_OutputSize;
+    const unsigned int numRows = m_NumGates * m_CellSize;
+
+    // Gather [input, outputState] for every batch, and start every gate from its bias.
+    for (unsigned int b = 0; b < m_BatchSize; ++b)
+    {
+        float* packed = &m_InputAndState[b * numCols];
+        std::copy_n(input + b * m_InputSize, m_InputSize, packed);
+        std::copy_n(outputStateIn + b * m_OutputSize, m_OutputSize, packed + m_InputSize);
+        std::copy(m_GateBias.begin(), m_GateBias.end(), &m_Gates[b * numRows]);
+    }
+
+    MatrixBatchVectorMultiplyAccumulate(m_GateWeights.data(), numRows, numCols,
+                                        m_InputAndState.data(), m_BatchSize, m_Gates.data(), numRows);
+
+    const unsigned int numCells = m_CellSize;
+    for (unsigned int b = 0; b < m_BatchSize; ++b)
+    {
+        float* gates = &m_Gates[b * numRows];
+        float* inputGate = m_CifgEnabled ? nullptr : gates;
+        float* forgetGate = gates + (m_CifgEnabled ? 0 : numCells);
+        float* cellGate = forgetGate + numCells;
+        float* outputGate = cellGate + numCells;
+        float* cell = cellState + b * numCells;
+        float* hidden = &m_Hidden[b * numCells];
+
+        if (!m_CifgEnabled)
+        {
+            if (m_PeepholeEnabled)
+            {
+                for (unsigned int c = 0; c < numCells; ++c)
+                {
+                    inputGate[c] += m_CellToInputWeights[c] * cell[c];
+                }
+            }
+            m_GateActivation(inputGate, inputGate, numCells, 0.0f, 0.0f);
+        }
+
+        if (m_PeepholeEnabled)
+        {
+            for (unsigned int c = 0; c < numCells; ++c)
+            {
+                forgetGate[c] += m_CellToForgetWeights[c] * cell[c];
+            }
+        }
+        m_GateActivation(forgetGate, forgetGate, numCells, 0.0f, 0.0f);
+
+        if (m_CellActivation != nullptr)
+        {
+            m_CellActivation(cellGate, cellGate, numCells, m_CellActivationA, m_CellActivationB);
+        }
+
+        // With CIFG the input gate is coupled to the forget gate as (1 - forget).
+        for (unsigned int c = 0; c < numCells; ++c)
+        {
+            const float inputWeight = m_CifgEnabled ? 1.0f - forgetGate[c] : inputGate[c];
+            cell[c] = forgetGate[c] * cell[c] + inputWeight * cellGate[c];
+        }
+        if (m_ClippingThresCell > 0.0f)
+        {
+            ClipVector(cell, numCells, m_ClippingThresCell);
+        }
+
+        if (m_PeepholeEnabled)
+        {
+            for (unsigned int c = 0; c < numCells; ++c)
+            {
+                outputGate[c] += m_CellToOutputWeights[c] * cell[c];
+            }
+        }
+        m_GateActivation(outputGate, outputGate, numCells, 0.0f, 0.0f);
+
+        // As in the Android code base, without a cell activation the output gate multiplies the cell gate.
+        const float* activatedCell = cellGate;
+        if (m_CellActivation != nullptr)
+        {
+            m_CellActivation(cell, hidden, numCells, m_CellActivationA, m_CellActivationB);
+            activatedCell = hidden;
+        }
+        float* gatedOutput = m_ProjectionEnabled ? hidden : output + b * m_OutputSize;
+        for (unsigned int c = 0; c < numCells; ++c)
+        {
+            gatedOutput[c] = outputGate[c] * activatedCell[c];
+        }
+    }
+
+    if (m_ProjectionEnabled)
+    {
+        for (unsigned int b = 0; b < m_BatchSize; ++b)
+        {
+            std::copy(m_ProjectionBias.begin(), m_ProjectionBias.end(), output + b * m_OutputSize);
+        }
+        MatrixBatchVectorMultiplyAccumulate(m_ProjectionWeights.data(), m_OutputSize, m_CellSize,
+                                            m_Hidden.data(), m_BatchSize, output, m_OutputSize);
+        if (m_ClippingThresProj > 0.0f)
+        {
+            ClipVector(output, m_BatchSize * m_OutputSize, m_ClippingThresProj);
+        }
+    }
+}
+
+} //namespace armnn
@@ -0,0 +1,88 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Activation.hpp"
+
+#include <backendsCommon/WorkloadData.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Maps the LstmDescriptor activation function code (0: None, 1: Relu, 3: Relu6, 4: Tanh, 6: Sigmoid) to an
+/// ActivationFunction and its parameters. @a outArmnnActivation is left unchanged for None.
+void SetActivationParameters(uint32_t activation,
+                             ActivationFunction& outArmnnActivation,
+                             float& outA,
+                             float& outB);
+
+/// A float LSTM cell (a port of LSTM::Eval() in the Android code base) whose weights are repacked once, at
+/// construction, so that each time step does a single matrix multiplication for all of its gates.
+///
+/// The input-to-gate and recurrent-to-gate weights of every gate are concatenated into one matrix with a row per
+/// gate unit and a column per element of [input, outputState], and the gate biases into one vector. Weights of any
+/// data type are dequantized to float when packed. The scratch buffers are allocated once, for a fixed batch size,
+/// so Run() does not allocate.
+class LstmKernel
+{
+public:
+    /// Packs the weights of @a descriptor, which need only stay valid for the duration of the constructor.
+    LstmKernel(const LstmQueueDescriptor& descriptor, unsigned int batchSize);
+
+    unsigned int GetInputSize() const { return m_InputSize; }
+    unsigned int GetCellSize() const { return m_CellSize; }
+    unsigned int GetOutputSize() const { return m_OutputSize; }
+
+    /// Runs @a numSteps time steps. @a input is [numSteps, batchSize, inputSize] and @a output receives
+    /// [numSteps, batchSize, outputSize]: the output of each step is also the output state fed to the next one.
+    /// @a cellState holds the cell state on entry and the cell state after the last step on return.
+    /// Not thread safe: a kernel runs one sequence at a time.
+    void Run(const float* input,
+             const float* outputStateIn,
+             float* cellState,
+             unsigned int numSteps,
+             float* output) const;
+
+private:
+    void RunStep(const float* input, const float* outputStateIn, float* cellState, float* output) const;
+
+    unsigned int m_BatchSize;
+    unsigned int m_InputSize;
+    unsigned int m_CellSize;
+    unsigned int m_OutputSize;
+    unsigned int m_NumGates;
+
+    bool  m_CifgEnabled;
+    bool  m_PeepholeEnabled;
+    bool  m_ProjectionEnabled;
+    float m_ClippingThresCell;
+    float m_ClippingThresProj;
+
+    ActivationKernel m_GateActivation;
+    ActivationKernel m_CellActivation;
+    float            m_CellActivationA;
+    float            m_CellActivationB;
+
+    /// [numGates * cellSize, inputSize + outputSize], gates ordered input (unless CIFG), forget, cell, output.
+    std::vector<float> m_GateWeights;
+    std::vector<float> m_GateBias;
+    std::vector<float> m_CellToInputWeights;
+    std::vector<float> m_CellToForgetWeights;
+    std::vector<float> m_CellToOutputWeights;
+    std::vector<float> m_ProjectionWeights;
+    std::vector<float> m_ProjectionBias;
+
+    /// [batchSize, inputSize + outputSize]: the input and output state of the current step, side by side.
+    mutable std::vector<float> m_InputAndState;
+    /// [batchSize, numGates * cellSize]
+    mutable std::vector<float> m_Gates;
+    /// [batchSize, cellSize]: the output before projection.
+    mutable std::vector<float> m_Hidden;
+};
+
+} //namespace armnn
@@ -4,65 +4,16 @@
 //
 
 #include "Mean.hpp"
-#include "backendsCommon/WorkloadData.hpp"
+#include "Reduce.hpp"
+#include "RefWorkloadUtils.hpp"
+
+#include <armnn/TypesUtils.hpp>
 
 #include <boost/numeric/conversion/cast.hpp>
 
-#include <cmath>
-#include <cstddef>
-#include <functional>
+#include <cstdint>
 #include <limits>
 
-namespace armnn
-{
-bool NextIndex(const unsigned int numDims, const armnn::TensorShape& dims, std::vector<unsigned int>& current)
-{
-    unsigned int carry = 1;
-
-    for (unsigned int idx = numDims; idx-- > 0; )
-    {
-        unsigned int current_val = current[idx] + carry;
-        if (dims[idx] == current_val)
-        {
-            current[idx] = 0;
-        }
-        else
-        {
-            current[idx] = current_val;
-            carry = 0;
-            break;
-        }
-    }
-    return (carry == 0);
-}
-
-std::size_t ReducedOutputOffset(const unsigned int numDims, const armnn::TensorShape& dims,
-                                std::vector<unsigned int>& index, const unsigned int numAxis,
-                                const std::vector<unsigned int>& axis) {
-    std::size_t offset = 0;
-    for (unsigned int idx = 0; idx < numDims; ++idx)
-    {
-        bool isAxis = false;
-        if (!axis.empty())
-        {
-            for (unsigned int axisIdx = 0; axisIdx < numAxis; ++axisIdx)
-            {
-                if (idx == axis[axisIdx])
-                {
-                    isAxis = true;
-                    break;
-                }
-            }
-        }
-        if (!isAxis)
-        {
-            offset = offset * boost::numeric_cast<size_t>(dims[idx]) + boost::numeric_cast<size_t>(index[idx]);
-        }
-    }
-    return offset;
-}
-} // namespace
-
 namespace armnn
 {
 void Mean(const armnn::TensorInfo& inputInfo,
@@ -71,66 +22,49 @@ void Mean(const armnn::TensorInfo& inputInfo,
           const float* inputData,
           float* outputData) {
 
-    unsigned int inputNumDims = inputInfo.GetNumDimensions();
-    unsigned int outputNumDims = outputInfo.GetNumDimensions();
+    // Sums the reduced axis, then takes average by num of elements added to get mean.
+    Reduce(inputInfo.GetShape(), axis, ReduceOperation::Sum, inputData, outputData);
 
-    armnn::TensorShape outputDims = outputInfo.GetShape();
-    armnn::TensorShape inputDims = inputInfo.GetShape();
-
-    // Initialise output data.
-    size_t numOutputs = 1;
-    for (unsigned int idx = 0; idx < outputNumDims; ++idx)
+    const float numElementsInAxis = boost::numeric_cast<float>(GetNumReducedElements(inputInfo.GetShape(), axis));
+    const unsigned int numOutputs = outputInfo.GetNumElements();
+    for (unsigned int idx = 0; idx < numOutputs; ++idx)
     {
-        numOutputs *= boost::numeric_cast<size_t>(outputDims[idx]);
+        outputData[idx] = outputData[idx] / numElementsInAxis;
     }
+}
 
-    std::vector<float> tempSum(numOutputs);
-    for (size_t idx = 0; idx < numOutputs; ++idx)
-    {
-        outputData[idx] = 0.0f;
-        tempSum[idx] = 0.0f;
-    }
+void Mean(const armnn::TensorInfo& inputInfo,
+          const armnn::TensorInfo& outputInfo,
+          const std::vector<unsigned int>& axis,
+          const uint8_t* inputData,
+          uint8_t* outputData) {
 
-    // Initialise temp index.
-    std::vector<unsigned int> tempIndex(inputNumDims);
-    for (unsigned int idx = 0; idx < inputNumDims; ++idx)
-    {
-        tempIndex[idx] = 0;
-    }
+    const unsigned int numElementsInAxis = GetNumReducedElements(inputInfo.GetShape(), axis);
+    const unsigned int numOutputs = outputInfo.GetNumElements();
 
-    std::vector<unsigned int> resolvedAxis = axis;
-    if (resolvedAxis.empty())
+    if (numElementsInAxis > std::numeric_limits<uint32_t>::max() / std::numeric_limits<uint8_t>::max())
     {
-      for (unsigned int idx = 0; idx < inputNumDims; ++idx)
-      {
-          resolvedAxis.push_back(idx);
-      }
+        // The integer sums could overflow: average the dequantized values instead.
+        std::vector<float> dequantized = Dequantize(inputData, inputInfo);
+        std::vector<float> results(numOutputs);
+        Mean(inputInfo, outputInfo, axis, dequantized.data(), results.data());
+        Quantize(outputData, results.data(), outputInfo);
+        return;
     }
-    unsigned int numResolvedAxis = boost::numeric_cast<unsigned int>(resolvedAxis.size());
 
-    // Iterates through input_data and sum up the reduced axis.
-    for (bool hasNext = true; hasNext; hasNext = NextIndex(inputNumDims, inputDims, tempIndex))
-    {
-        size_t inputOffset = ReducedOutputOffset(inputNumDims, inputDims, tempIndex, 0, {});
-        size_t outputOffset = ReducedOutputOffset(inputNumDims, inputDims, tempIndex,
-                                                  numResolvedAxis, resolvedAxis);
-        tempSum[outputOffset] += inputData[inputOffset];
-    }
+    // The quantized values are summed exactly as integers: the mean of the dequantized values is then
+    // scale * (sum / count - offset).
+    std::vector<uint32_t> sums(numOutputs);
+    Reduce(inputInfo.GetShape(), axis, ReduceOperation::Sum, inputData, sums.data());
 
-    // Takes average by num of elements added to get mean.
-    size_t numElementsInAxis = 1;
-    for (unsigned int idx = 0; idx < numResolvedAxis; ++idx)
+    const float inputScale = inputInfo.GetQuantizationScale();
+    const float inputOffset = boost::numeric_cast<float>(inputInfo.GetQuantizationOffset());
+    const float count = boost::numeric_cast<float>(numElementsInAxis);
+    for (unsigned int idx = 0; idx < numOutputs; ++idx)
     {
-        size_t current = boost::numeric_cast<size_t>(inputDims[resolvedAxis[idx]]);
-        BOOST_ASSERT(boost::numeric_cast<float>(current) <
-              (std::numeric_limits<float>::max() / boost::numeric_cast<float>(numElementsInAxis)));
-        numElementsInAxis *= current;
-    }
-    if (numElementsInAxis > 0) {
-        for (size_t idx = 0; idx < numOutputs; ++idx)
-        {
-            outputData[idx] = tempSum[idx] / boost::numeric_cast<float>(numElementsInAxis);
-        }
+        const float mean = inputScale * (static_cast<float>(sums[idx]) / count - inputOffset);
+        outputData[idx] = armnn::Quantize<uint8_t>(mean, outputInfo.GetQuantizationScale(),
+                                                   outputInfo.GetQuantizationOffset());
     }
 }
 } //namespace armnn
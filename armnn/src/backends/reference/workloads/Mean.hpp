@@ -8,6 +8,7 @@
 #include "armnn/DescriptorsFwd.hpp"
 #include "armnn/Tensor.hpp"
 
+#include <cstdint>
 #include <vector>
 
 namespace armnn
@@ -17,5 +18,12 @@ void Mean(const TensorInfo& inputInfo,
           const std::vector<unsigned int>& axis,
           const float* inputData,
           float* outputData);
+
+/// Mean of QAsymm8 data, computed from exact integer sums of the quantized values.
+void Mean(const TensorInfo& inputInfo,
+          const TensorInfo& outputInfo,
+          const std::vector<unsigned int>& axis,
+          const uint8_t* inputData,
+          uint8_t* outputData);
 } //namespace armnn
 
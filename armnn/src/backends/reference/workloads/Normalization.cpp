@@ -0,0 +1,281 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "Normalization.hpp"
+
+#include <ParallelFor.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Each output element costs a few flops plus a square root or power, so a task should handle several thousand.
+constexpr unsigned int g_MinElementsPerTask = 16384;
+
+// Windows that slide across a stack of planes are updated a block of this many plane elements at a time, so that the
+// running sums stay in L1.
+constexpr unsigned int g_BlockSize = 1024;
+
+/// Computes (k + alpha * sum)^-beta, with the powers used by common networks special-cased.
+class ScaleFunction
+{
+public:
+    ScaleFunction(float alpha, float beta, float k)
+        : m_Alpha(alpha)
+        , m_Beta(beta)
+        , m_K(k)
+    {}
+
+    float operator()(float sum) const
+    {
+        // Running sums can drift a little below zero when the window holds only zeros.
+        const float base = m_K + m_Alpha * std::max(sum, 0.f);
+        if (m_Beta == 0.75f)
+        {
+            const float inverseSqrt = 1.f / std::sqrt(base);
+            return inverseSqrt * std::sqrt(inverseSqrt);
+        }
+        if (m_Beta == 0.5f)
+        {
+            return 1.f / std::sqrt(base);
+        }
+        if (m_Beta == 1.f)
+        {
+            return 1.f / base;
+        }
+        return std::pow(base, -m_Beta);
+    }
+
+private:
+    float m_Alpha;
+    float m_Beta;
+    float m_K;
+};
+
+inline float Square(float value)
+{
+    return value * value;
+}
+
+/// Normalizes stacks of @a numPlanes planes of @a planeSize elements, with a window of 2 * radius + 1 planes sliding
+/// along each stack. @a terms(stack, plane, i) returns the contribution of element i of a plane to the window sums.
+template <typename TermFunc>
+void NormalizeAlongStacks(const float* inputData,
+                          float* outputData,
+                          unsigned int numStacks,
+                          unsigned int numPlanes,
+                          unsigned int planeSize,
+                          unsigned int radius,
+                          const ScaleFunction& scale,
+                          TermFunc terms)
+{
+    const unsigned int numBlocks = (planeSize + g_BlockSize - 1) / g_BlockSize;
+    const unsigned int elementsPerItem = numPlanes * std::min(planeSize, g_BlockSize);
+    const unsigned int minItemsPerTask = std::max(1u, g_MinElementsPerTask / elementsPerItem);
+
+    armnnUtils::ParallelFor(numStacks * numBlocks, minItemsPerTask, [&](unsigned int begin, unsigned int end)
+    {
+        std::vector<float> sums;
+        for (unsigned int item = begin; item < end; ++item)
+        {
+            const unsigned int stack = item / numBlocks;
+            const unsigned int blockStart = (item % numBlocks) * g_BlockSize;
+            const unsigned int length = std::min(g_BlockSize, planeSize - blockStart);
+
+            // The window of plane 0 covers planes [0, radius].
+            sums.assign(length, 0.f);
+            for (unsigned int plane = 0; plane <= std::min(radius, numPlanes - 1); ++plane)
+            {
+                for (unsigned int i = 0; i < length; ++i)
+                {
+                    sums[i] += terms(stack, plane, blockStart + i);
+                }
+            }
+
+            for (unsigned int plane = 0; plane < numPlanes; ++plane)
+            {
+                const unsigned int offset = (stack * numPlanes + plane) * planeSize + blockStart;
+                for (unsigned int i = 0; i < length; ++i)
+                {
+                    outputData[offset + i] = inputData[offset + i] * scale(sums[i]);
+                }
+
+                if (plane + radius + 1 < numPlanes)
+                {
+                    for (unsigned int i = 0; i < length; ++i)
+                    {
+                        sums[i] += terms(stack, plane + radius + 1, blockStart + i);
+                    }
+                }
+                if (plane >= radius)
+                {
+                    for (unsigned int i = 0; i < length; ++i)
+                    {
+                        sums[i] -= terms(stack, plane - radius, blockStart + i);
+                    }
+                }
+            }
+        }
+    });
+}
+
+/// Sums the squares of each row over a window of 2 * radius + 1 pixels. Rows hold @a channels interleaved values per
+/// pixel, each of which gets its own window.
+void SumSquaresAlongRows(const float* inputData,
+                         float* rowSums,
+                         unsigned int numRows,
+                         unsigned int width,
+                         unsigned int channels,
+                         unsigned int radius)
+{
+    const unsigned int rowSize = width * channels;
+    const unsigned int minRowsPerTask = std::max(1u, g_MinElementsPerTask / rowSize);
+
+    armnnUtils::ParallelFor(numRows, minRowsPerTask, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = begin; row < end; ++row)
+        {
+            const float* in = inputData + row * rowSize;
+            float* sums = rowSums + row * rowSize;
+
+            // The window of pixel 0 covers pixels [0, radius].
+            for (unsigned int c = 0; c < channels; ++c)
+            {
+                sums[c] = 0.f;
+            }
+            for (unsigned int x = 0; x <= std::min(radius, width - 1); ++x)
+            {
+                for (unsigned int c = 0; c < channels; ++c)
+                {
+                    sums[c] += Square(in[x * channels + c]);
+                }
+            }
+
+            for (unsigned int x = 1; x < width; ++x)
+            {
+                const float* entering = x + radius < width ? in + (x + radius) * channels : nullptr;
+                const float* leaving = x > radius ? in + (x - radius - 1) * channels : nullptr;
+                for (unsigned int c = 0; c < channels; ++c)
+                {
+                    float sum = sums[(x - 1) * channels + c];
+                    if (entering)
+                    {
+                        sum += Square(entering[c]);
+                    }
+                    if (leaving)
+                    {
+                        sum -= Square(leaving[c]);
+                    }
+                    sums[x * channels + c] = sum;
+                }
+            }
+        }
+    });
+}
+
+void NormalizeAcross(const float* inputData,
+                     float* outputData,
+                     unsigned int numPixels,
+                     unsigned int channels,
+                     unsigned int radius,
+                     const ScaleFunction& scale)
+{
+    // NHWC: the channels of each pixel are contiguous, so the window slides along them.
+    const unsigned int minPixelsPerTask = std::max(1u, g_MinElementsPerTask / channels);
+    armnnUtils::ParallelFor(numPixels, minPixelsPerTask, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int pixel = begin; pixel < end; ++pixel)
+        {
+            const float* in = inputData + pixel * channels;
+            float* out = outputData + pixel * channels;
+
+            float sum = 0.f;
+            for (unsigned int c = 0; c <= std::min(radius, channels - 1); ++c)
+            {
+                sum += Square(in[c]);
+            }
+            for (unsigned int c = 0; c < channels; ++c)
+            {
+                out[c] = in[c] * scale(sum);
+                if (c + radius + 1 < channels)
+                {
+                    sum += Square(in[c + radius + 1]);
+                }
+                if (c >= radius)
+                {
+                    sum -= Square(in[c - radius]);
+                }
+            }
+        }
+    });
+}
+
+} // anonymous namespace
+
+void LocalResponseNormalization(const float*                  inputData,
+                                float*                        outputData,
+                                const TensorShape&            shape,
+                                armnnUtils::DataLayoutIndexed dataLayout,
+                                NormalizationAlgorithmChannel channelType,
+                                uint32_t                      normSize,
+                                float                         alpha,
+                                float                         beta,
+                                float                         k)
+{
+    if (shape.GetNumElements() == 0)
+    {
+        return;
+    }
+
+    const unsigned int batchSize = shape[0];
+    const unsigned int channels = shape[dataLayout.GetChannelsIndex()];
+    const unsigned int height = shape[dataLayout.GetHeightIndex()];
+    const unsigned int width = shape[dataLayout.GetWidthIndex()];
+    const unsigned int radius = normSize / 2;
+    const bool isNhwc = dataLayout.GetDataLayout() == DataLayout::NHWC;
+    const ScaleFunction scale(alpha, beta, k);
+
+    if (channelType == NormalizationAlgorithmChannel::Across)
+    {
+        if (isNhwc)
+        {
+            NormalizeAcross(inputData, outputData, batchSize * height * width, channels, radius, scale);
+            return;
+        }
+
+        // NCHW: each batch is a stack of channel planes, and the window slides across them.
+        const unsigned int planeSize = height * width;
+        NormalizeAlongStacks(inputData, outputData, batchSize, channels, planeSize, radius, scale,
+            [inputData, channels, planeSize](unsigned int stack, unsigned int plane, unsigned int i)
+            {
+                return Square(inputData[(stack * channels + plane) * planeSize + i]);
+            });
+        return;
+    }
+
+    // Within: sum the squares along each row, then slide a window of rows down each image. An NCHW image is a single
+    // channel; an NHWC image holds every channel, interleaved.
+    const unsigned int numImages = isNhwc ? batchSize : batchSize * channels;
+    const unsigned int rowChannels = isNhwc ? channels : 1;
+    const unsigned int rowSize = width * rowChannels;
+
+    std::vector<float> rowSums(shape.GetNumElements());
+    SumSquaresAlongRows(inputData, rowSums.data(), numImages * height, width, rowChannels, radius);
+
+    const float* sums = rowSums.data();
+    NormalizeAlongStacks(inputData, outputData, numImages, height, rowSize, radius, scale,
+        [sums, height, rowSize](unsigned int stack, unsigned int plane, unsigned int i)
+        {
+            return sums[(stack * height + plane) * rowSize + i];
+        });
+}
+
+} //namespace armnn
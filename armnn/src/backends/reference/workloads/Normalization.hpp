@@ -0,0 +1,35 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <DataLayoutIndexed.hpp>
+
+#include <cstdint>
+
+namespace armnn
+{
+
+/// Local response normalization (Krizhevsky 2012, local brightness normalization) of an NCHW or NHWC tensor:
+/// output = input * (k + alpha * sum)^-beta, where sum is the sum of squares over a window of @a normSize channels
+/// (Across) or of @a normSize x @a normSize pixels of the same channel (Within), clipped to the tensor.
+///
+/// The window sums are running sums, updated by the element entering and the element leaving the window, so the
+/// cost per element does not depend on @a normSize; Within windows are summed along rows and then along columns.
+/// Common powers (beta of 0.5, 0.75 and 1) use square roots and divisions instead of powf.
+void LocalResponseNormalization(const float*                  inputData,
+                                float*                        outputData,
+                                const TensorShape&            shape,
+                                armnnUtils::DataLayoutIndexed dataLayout,
+                                NormalizationAlgorithmChannel channelType,
+                                uint32_t                      normSize,
+                                float                         alpha,
+                                float                         beta,
+                                float                         k);
+
+} //namespace armnn
@@ -4,13 +4,9 @@
 //
 
 #include "Pad.hpp"
+#include "CopyPlan.hpp"
 #include "backendsCommon/WorkloadData.hpp"
-#include <boost/numeric/conversion/cast.hpp>
-#include "TensorBufferArrayView.hpp"
-#include <cmath>
 #include <cstddef>
-#include <functional>
-#include <limits>
 #include <cassert>
 
 namespace armnn
@@ -22,8 +18,6 @@ void Pad(const TensorInfo& inputInfo,
          const T* inputData,
          T* outData)
 {
-    unsigned int numOutputElements = outputInfo.GetNumElements();
-
     TensorShape outputShape = outputInfo.GetShape();
     TensorShape inputShape = inputInfo.GetShape();
 
@@ -36,113 +30,60 @@ void Pad(const TensorInfo& inputInfo,
 
     #endif
 
-    unsigned int inputBatches = 0;
-    unsigned int inputChannels = 0;
-    unsigned int inputHeight = 0;
-    unsigned int inputWidth = 0;
-
-    unsigned int outputChannels = 0;
-    unsigned int outputHeight = 0;
-    unsigned int outputWidth = 0;
+    const std::vector<std::ptrdiff_t> inputStrides = GetRowMajorStrides(inputShape);
+    const std::vector<std::ptrdiff_t> outputStrides = GetRowMajorStrides(outputShape);
 
-    for (unsigned int i = 0; i < numOutputElements; ++i)
+    // Copy the input into the interior of the output.
+    std::vector<CopyDimension> interior;
+    std::ptrdiff_t interiorOffset = 0;
+    for (unsigned int d = 0; d < numInputDimensions; ++d)
     {
-       outData[i] = 0;
+        interior.push_back({ inputShape[d], inputStrides[d], outputStrides[d] });
+        interiorOffset += static_cast<std::ptrdiff_t>(std::get<0>(m_PadList[d])) * outputStrides[d];
     }
+    CopyPlan(interior).Copy(inputData, outData + interiorOffset, sizeof(T));
 
-    switch(numInputDimensions) {
-
-        case 1:
-
-            inputWidth = inputShape[0];
-
-            for (unsigned int w = 0; w < inputWidth ; w++)
+    // Clear the padding, so that every output element is written once: for each dimension d, the slabs before and
+    // after the input along d, within the input's extent along the outer dimensions and across the whole output
+    // along the inner ones.
+    for (unsigned int d = 0; d < numInputDimensions; ++d)
+    {
+        const unsigned int padBefore = std::get<0>(m_PadList[d]);
+        const unsigned int padAfter = std::get<1>(m_PadList[d]);
+        const std::pair<unsigned int, unsigned int> slabs[] =
+        {
+            { 0, padBefore },
+            { padBefore + inputShape[d], padAfter }
+        };
+
+        for (const auto& slab : slabs)
+        {
+            if (slab.second == 0)
             {
-                outData[w+std::get<0>(m_PadList[0])] = inputData[w];
+                continue;
             }
 
-            break;
-
-        case 2  :
-
-            inputHeight = inputShape[0];
-            inputWidth = inputShape[1];
-            outputHeight = outputShape[0];
-            outputWidth = outputShape[1];
-
-            for (unsigned int h = 0; h < inputHeight; h++)
+            std::vector<CopyDimension> box;
+            std::ptrdiff_t boxOffset = 0;
+            for (unsigned int q = 0; q < numInputDimensions; ++q)
             {
-                for (unsigned int w = 0; w < inputWidth ; w++)
+                if (q < d)
                 {
-                    outData[(h+std::get<0>(m_PadList[0]))*outputWidth
-                    + (w+std::get<0>(m_PadList[1]))] = inputData[h * inputWidth + w];
+                    box.push_back(MakeFillDimension(inputShape[q], outputStrides[q]));
+                    boxOffset += static_cast<std::ptrdiff_t>(std::get<0>(m_PadList[q])) * outputStrides[q];
                 }
-            }
-
-            break;
-
-        case 3  :
-
-            inputChannels = inputShape[0];
-            inputHeight = inputShape[1];
-            inputWidth = inputShape[2];
-            outputChannels = outputShape[0];
-            outputHeight = outputShape[1];
-            outputWidth = outputShape[2];
-
-            for (unsigned int c = 0; c < inputChannels; c++)
-            {
-                for (unsigned int h = 0; h < inputHeight; h++)
+                else if (q == d)
                 {
-                    for (unsigned int w = 0; w < inputWidth ; w++)
-                    {
-                        outData[(c+std::get<0>(m_PadList[0]))*outputHeight*outputWidth
-                        + (h+std::get<0>(m_PadList[1]))*outputWidth
-                        + (w+std::get<0>(m_PadList[2]))] = inputData[c * inputHeight * inputWidth
-                                                                      + h * inputWidth
-                                                                      + w];
-                    }
+                    box.push_back(MakeFillDimension(slab.second, outputStrides[q]));
+                    boxOffset += static_cast<std::ptrdiff_t>(slab.first) * outputStrides[q];
                 }
-            }
-
-            break;
-
-        case 4  :
-
-            inputBatches = inputShape[0];
-            inputChannels = inputShape[1];
-            inputHeight = inputShape[2];
-            inputWidth = inputShape[3];
-            outputChannels = outputShape[1];
-            outputHeight = outputShape[2];
-            outputWidth = outputShape[3];
-
-            for (unsigned int b = 0; b < inputBatches; b++)
-            {
-                for (unsigned int c = 0; c < inputChannels; c++)
+                else
                 {
-                    for (unsigned int h = 0; h < inputHeight; h++)
-                    {
-                        for (unsigned int w = 0; w < inputWidth ; w++)
-                        {
-                            outData[(b+std::get<0>(m_PadList[0])) * outputChannels * outputHeight * outputWidth
-                                   + (c+std::get<0>(m_PadList[1])) * outputHeight * outputWidth
-                                   + (h+std::get<0>(m_PadList[2])) * outputWidth
-                                   + (w+std::get<0>(m_PadList[3]))] = inputData[b * inputChannels * inputHeight
-                                                                                * inputWidth
-                                                                             + c * inputHeight * inputWidth
-                                                                             + h * inputWidth
-                                                                             + w];
-                        }
-                    }
+                    box.push_back(MakeFillDimension(outputShape[q], outputStrides[q]));
                 }
             }
-
-            break;
-
-        default :
-
-            break;
+            CopyPlan(box).Zero(outData + boxOffset, sizeof(T));
+        }
     }
 }
 
@@ -0,0 +1,288 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "Reduce.hpp"
+
+#include <ParallelFor.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace armnn
+{
+
+namespace
+{
+
+// A reduction pass reads each input element once, so a task is only worth scheduling for several thousand of them.
+constexpr unsigned int g_MinElementsPerTask = 16384;
+
+// Outputs along a contiguous inner dimension are reduced in blocks of this many, so that the block being
+// accumulated stays in L1 while the reduced rows stream past it.
+constexpr unsigned int g_InnerBlockSize = 1024;
+
+// Independent partial results kept when reducing a contiguous run, so that the loop carries no dependency between
+// consecutive elements and can be vectorized.
+constexpr unsigned int g_NumLanes = 8;
+
+struct SumOp
+{
+    template <typename T>
+    T operator()(T a, T b) const { return a + b; }
+};
+
+struct MaxOp
+{
+    template <typename T>
+    T operator()(T a, T b) const { return std::max(a, b); }
+};
+
+struct MinOp
+{
+    template <typename T>
+    T operator()(T a, T b) const { return std::min(a, b); }
+};
+
+template <typename Op, typename InType, typename AccType>
+AccType ReduceContiguous(const InType* input, unsigned int length)
+{
+    Op op;
+    if (length < g_NumLanes)
+    {
+        AccType result = static_cast<AccType>(input[0]);
+        for (unsigned int i = 1; i < length; ++i)
+        {
+            result = op(result, static_cast<AccType>(input[i]));
+        }
+        return result;
+    }
+
+    AccType lanes[g_NumLanes];
+    for (unsigned int lane = 0; lane < g_NumLanes; ++lane)
+    {
+        lanes[lane] = static_cast<AccType>(input[lane]);
+    }
+    unsigned int i = g_NumLanes;
+    for (; i + g_NumLanes <= length; i += g_NumLanes)
+    {
+        for (unsigned int lane = 0; lane < g_NumLanes; ++lane)
+        {
+            lanes[lane] = op(lanes[lane], static_cast<AccType>(input[i + lane]));
+        }
+    }
+
+    AccType result = lanes[0];
+    for (unsigned int lane = 1; lane < g_NumLanes; ++lane)
+    {
+        result = op(result, lanes[lane]);
+    }
+    for (; i < length; ++i)
+    {
+        result = op(result, static_cast<AccType>(input[i]));
+    }
+    return result;
+}
+
+template <typename Op, typename InType, typename AccType>
+void RunPass(const ReductionPass& pass, const InType* input, AccType* output)
+{
+    const unsigned int numReduce = pass.m_Reduce;
+    const unsigned int numInner = pass.m_Inner;
+
+    if (numInner == 1)
+    {
+        // Each output is the reduction of a contiguous run of the input.
+        const unsigned int minOutputsPerTask = std::max(1u, g_MinElementsPerTask / numReduce);
+        armnnUtils::ParallelFor(pass.m_Outer, minOutputsPerTask, [&](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int outer = begin; outer < end; ++outer)
+            {
+                output[outer] = ReduceContiguous<Op, InType, AccType>(input + outer * numReduce, numReduce);
+            }
+        });
+        return;
+    }
+
+    // Each output block accumulates, elementwise, one row of the input per reduced index. Work is split over the
+    // outer index and the blocks so that a reduction with a single outer index (e.g. a global mean) is threaded too.
+    const unsigned int numBlocks = (numInner + g_InnerBlockSize - 1) / g_InnerBlockSize;
+    const unsigned int elementsPerItem = numReduce * std::min(numInner, g_InnerBlockSize);
+    const unsigned int minItemsPerTask = std::max(1u, g_MinElementsPerTask / elementsPerItem);
+    armnnUtils::ParallelFor(pass.m_Outer * numBlocks, minItemsPerTask, [&](unsigned int begin, unsigned int end)
+    {
+        Op op;
+        for (unsigned int item = begin; item < end; ++item)
+        {
+            const unsigned int outer = item / numBlocks;
+            const unsigned int blockStart = (item % numBlocks) * g_InnerBlockSize;
+            const unsigned int length = std::min(g_InnerBlockSize, numInner - blockStart);
+
+            AccType* out = output + outer * numInner + blockStart;
+            const InType* in = input + outer * numReduce * numInner + blockStart;
+            for (unsigned int i = 0; i < length; ++i)
+            {
+                out[i] = static_cast<AccType>(in[i]);
+            }
+            for (unsigned int r = 1; r < numReduce; ++r)
+            {
+                const InType* row = in + r * numInner;
+                for (unsigned int i = 0; i < length; ++i)
+                {
+                    out[i] = op(out[i], static_cast<AccType>(row[i]));
+                }
+            }
+        }
+    });
+}
+
+template <typename Op, typename InType, typename AccType>
+void RunPasses(const std::vector<ReductionPass>& passes, const InType* input, AccType* output)
+{
+    BOOST_ASSERT(!passes.empty());
+    if (passes.size() == 1)
+    {
+        RunPass<Op>(passes[0], input, output);
+        return;
+    }
+
+    // The intermediate results of all but the last pass are kept in AccType.
+    std::vector<AccType> current(passes[0].m_Outer * passes[0].m_Inner);
+    RunPass<Op>(passes[0], input, current.data());
+
+    std::vector<AccType> next;
+    for (size_t p = 1; p + 1 < passes.size(); ++p)
+    {
+        next.resize(passes[p].m_Outer * passes[p].m_Inner);
+        RunPass<Op>(passes[p], current.data(), next.data());
+        current.swap(next);
+    }
+    RunPass<Op>(passes.back(), current.data(), output);
+}
+
+std::vector<bool> GetReducedDimensions(const TensorShape& inputShape, const std::vector<unsigned int>& axis)
+{
+    const unsigned int numDims = inputShape.GetNumDimensions();
+    std::vector<bool> isReduced(numDims, axis.empty());
+    for (unsigned int dim : axis)
+    {
+        if (dim >= numDims)
+        {
+            throw InvalidArgumentException("Reduce: axis " + std::to_string(dim) + " is out of range for a tensor of " +
+                                           std::to_string(numDims) + " dimensions");
+        }
+        isReduced[dim] = true;
+    }
+    return isReduced;
+}
+
+} // anonymous namespace
+
+std::vector<ReductionPass> PlanReduction(const TensorShape& inputShape, const std::vector<unsigned int>& axis)
+{
+    const std::vector<bool> isReduced = GetReducedDimensions(inputShape, axis);
+
+    // Runs of adjacent dimensions of the same kind, outermost first.
+    struct Run
+    {
+        unsigned int m_Size;
+        bool         m_Reduced;
+    };
+    std::vector<Run> runs;
+    for (unsigned int dim = 0; dim < inputShape.GetNumDimensions(); ++dim)
+    {
+        if (inputShape[dim] == 1)
+        {
+            continue;
+        }
+        if (!runs.empty() && runs.back().m_Reduced == isReduced[dim])
+        {
+            runs.back().m_Size *= inputShape[dim];
+        }
+        else
+        {
+            runs.push_back({ inputShape[dim], isReduced[dim] });
+        }
+    }
+
+    // Reduce the innermost reduced run first. Once it is removed, the remaining runs describe the intermediate
+    // result, in which every run after the next reduced one is kept.
+    std::vector<ReductionPass> passes;
+    for (size_t r = runs.size(); r-- > 0;)
+    {
+        if (!runs[r].m_Reduced)
+        {
+            continue;
+        }
+        unsigned int outer = 1;
+        unsigned int inner = 1;
+        for (size_t q = 0; q < r; ++q)
+        {
+            outer *= runs[q].m_Size;
+        }
+        for (size_t q = r + 1; q < runs.size(); ++q)
+        {
+            inner *= runs[q].m_Size;
+        }
+        passes.push_back({ outer, runs[r].m_Size, inner });
+        runs.erase(runs.begin() + static_cast<std::ptrdiff_t>(r));
+    }
+
+    if (passes.empty())
+    {
+        passes.push_back({ 1, 1, inputShape.GetNumElements() });
+    }
+    return passes;
+}
+
+unsigned int GetNumReducedElements(const TensorShape& inputShape, const std::vector<unsigned int>& axis)
+{
+    const std::vector<bool> isReduced = GetReducedDimensions(inputShape, axis);
+    unsigned int numReduced = 1;
+    for (unsigned int dim = 0; dim < inputShape.GetNumDimensions(); ++dim)
+    {
+        if (isReduced[dim])
+        {
+            numReduced *= inputShape[dim];
+        }
+    }
+    return numReduced;
+}
+
+template <typename InType, typename AccType>
+void Reduce(const TensorShape& inputShape,
+            const std::vector<unsigned int>& axis,
+            ReduceOperation operation,
+            const InType* inputData,
+            AccType* outputData)
+{
+    const std::vector<ReductionPass> passes = PlanReduction(inputShape, axis);
+    switch (operation)
+    {
+        case ReduceOperation::Sum:
+            RunPasses<SumOp>(passes, inputData, outputData);
+            break;
+        case ReduceOperation::Max:
+            RunPasses<MaxOp>(passes, inputData, outputData);
+            break;
+        case ReduceOperation::Min:
+            RunPasses<MinOp>(passes, inputData, outputData);
+            break;
+        default:
+            throw InvalidArgumentException("Reduce: unsupported reduce operation");
+    }
+}
+
+template void Reduce<float, float>(const TensorShape&, const std::vector<unsigned int>&, ReduceOperation,
+                                   const float*, float*);
+template void Reduce<uint8_t, uint32_t>(const TensorShape&, const std::vector<unsigned int>&, ReduceOperation,
+                                        const uint8_t*, uint32_t*);
+
+} //namespace armnn
@@ -0,0 +1,51 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Tensor.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+enum class ReduceOperation
+{
+    Sum,
+    Max,
+    Min
+};
+
+/// One step of a reduction: the input is viewed as [outer, reduce, inner] and reduced to [outer, inner].
+struct ReductionPass
+{
+    unsigned int m_Outer;
+    unsigned int m_Reduce;
+    unsigned int m_Inner;
+};
+
+/// Canonicalizes a reduction of @a inputShape over @a axis (every dimension if empty) into a list of passes.
+/// Size-1 dimensions are dropped and adjacent dimensions that are both reduced or both kept are merged, so that
+/// most reductions (all axes, the spatial axes of NHWC or NCHW, a single axis) become a single pass. Axis sets that
+/// leave several separate reduced runs get one pass per run, innermost first. A reduction that reduces nothing gets
+/// a single pass with m_Reduce == 1.
+std::vector<ReductionPass> PlanReduction(const TensorShape& inputShape, const std::vector<unsigned int>& axis);
+
+/// Returns the number of input elements that contribute to each output of the reduction.
+unsigned int GetNumReducedElements(const TensorShape& inputShape, const std::vector<unsigned int>& axis);
+
+/// Reduces @a inputData over @a axis (every dimension if empty) with @a operation. The outputs are written in the
+/// row-major order of the kept dimensions, which is the layout of the output with or without kept dimensions.
+/// Accumulation is done in AccType: instantiated for float -> float and uint8_t -> uint32_t (the caller is
+/// responsible for the sum of uint8 values fitting 32 bits).
+template <typename InType, typename AccType>
+void Reduce(const TensorShape& inputShape,
+            const std::vector<unsigned int>& axis,
+            ReduceOperation operation,
+            const InType* inputData,
+            AccType* outputData);
+
+} //namespace armnn
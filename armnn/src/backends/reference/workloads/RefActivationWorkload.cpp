@@ -12,9 +12,30 @@
 
 #include "Profiling.hpp"
 
+#include <ParallelFor.hpp>
+
 namespace armnn
 {
 
+namespace
+{
+
+// Elementwise work is cheap, so only tensors of several tasks' worth of elements are split across threads.
+constexpr unsigned int g_MinElementsPerTask = 16384;
+
+} // anonymous namespace
+
+RefActivationWorkload::RefActivationWorkload(const ActivationQueueDescriptor& descriptor, const WorkloadInfo& info)
+    : BaseWorkload<ActivationQueueDescriptor>(descriptor, info)
+    , m_Kernel(nullptr)
+{
+    if (info.m_InputTensorInfos[0].GetDataType() == DataType::Float32 &&
+        info.m_OutputTensorInfos[0].GetDataType() == DataType::Float32)
+    {
+        m_Kernel = GetActivationKernel(descriptor.m_Parameters.m_Function);
+    }
+}
+
 void RefActivationWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefActivationWorkload_Execute");
@@ -22,6 +43,22 @@ void RefActivationWorkload::Execute() const
     const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
 
+    if (m_Kernel != nullptr)
+    {
+        const float* input = GetInputTensorDataFloat(0, m_Data);
+        float* output = GetOutputTensorDataFloat(0, m_Data);
+        const float a = m_Data.m_Parameters.m_A;
+        const float b = m_Data.m_Parameters.m_B;
+        const ActivationKernel kernel = m_Kernel;
+
+        armnnUtils::ParallelFor(inputInfo.GetNumElements(), g_MinElementsPerTask,
+            [input, output, a, b, kernel](unsigned int begin, unsigned int end)
+            {
+                kernel(input + begin, output + begin, end - begin, a, b);
+            });
+        return;
+    }
+
     Activation(*MakeDecoder<float>(inputInfo, m_Data.m_Inputs[0]->Map()),
                *MakeEncoder<float>(outputInfo, m_Data.m_Outputs[0]->Map()),
                inputInfo,
@@ -8,14 +8,21 @@
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
+#include "Activation.hpp"
+
 namespace armnn
 {
 
 class RefActivationWorkload : public BaseWorkload<ActivationQueueDescriptor>
 {
 public:
-    using BaseWorkload<ActivationQueueDescriptor>::BaseWorkload;
+    RefActivationWorkload(const ActivationQueueDescriptor& descriptor, const WorkloadInfo& info);
     virtual void Execute() const override;
+
+private:
+    /// Bulk kernel for Float32 tensors, resolved once at construction. Null for other data types, which go through
+    /// the Decoder/Encoder path.
+    ActivationKernel m_Kernel;
 };
 
 } //namespace armnn
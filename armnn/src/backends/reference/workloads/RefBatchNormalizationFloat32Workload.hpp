@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "BatchNormImpl.hpp"
+
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
@@ -19,10 +21,7 @@ public:
     virtual void Execute() const override;
 
 private:
-    std::unique_ptr<ScopedCpuTensorHandle> m_Mean;
-    std::unique_ptr<ScopedCpuTensorHandle> m_Variance;
-    std::unique_ptr<ScopedCpuTensorHandle> m_Beta;
-    std::unique_ptr<ScopedCpuTensorHandle> m_Gamma;
+    BatchNormScaleShift m_ScaleShift;
 };
 
 } //namespace armnn
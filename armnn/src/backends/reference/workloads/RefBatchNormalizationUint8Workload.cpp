@@ -5,7 +5,6 @@
 
 #include "RefBatchNormalizationUint8Workload.hpp"
 
-#include "BatchNormImpl.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include "Profiling.hpp"
@@ -14,34 +13,54 @@
 
 namespace armnn
 {
+
+namespace
+{
+
+BatchNormScaleShift MakeQuantizedScaleShift(const BatchNormalizationQueueDescriptor& descriptor,
+                                            const WorkloadInfo& info)
+{
+    // Dequantizes without the assertions of armnn::Dequantize: a workload can be created, and never run, for constants
+    // whose quantization parameters are unset.
+    auto dequantize = [](const ConstCpuTensorHandle* handle)
+    {
+        const TensorInfo& info = handle->GetTensorInfo();
+        const uint8_t* data = handle->GetConstTensor<uint8_t>();
+        std::vector<float> values(info.GetNumElements());
+        for (unsigned int i = 0; i < values.size(); ++i)
+        {
+            values[i] = static_cast<float>(data[i] - info.GetQuantizationOffset()) * info.GetQuantizationScale();
+        }
+        return values;
+    };
+
+    const std::vector<float> mean = dequantize(descriptor.m_Mean);
+    const std::vector<float> variance = dequantize(descriptor.m_Variance);
+    const std::vector<float> beta = dequantize(descriptor.m_Beta);
+    const std::vector<float> gamma = dequantize(descriptor.m_Gamma);
+
+    const BatchNormScaleShift scaleShift(mean.data(), variance.data(), beta.data(), gamma.data(),
+                                         static_cast<unsigned int>(mean.size()), descriptor.m_Parameters.m_Eps);
+    return FoldQuantization(scaleShift, info.m_InputTensorInfos[0], info.m_OutputTensorInfos[0]);
+}
+
+} // anonymous namespace
+
 RefBatchNormalizationUint8Workload::RefBatchNormalizationUint8Workload(
     const BatchNormalizationQueueDescriptor& descriptor, const WorkloadInfo& info)
        : Uint8Workload<BatchNormalizationQueueDescriptor>(descriptor, info),
-         m_Mean(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Mean))),
-         m_Variance(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Variance))),
-         m_Beta(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Beta))),
-         m_Gamma(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Gamma))) {}
+         m_ScaleShift(MakeQuantizedScaleShift(descriptor, info)) {}
 
 void RefBatchNormalizationUint8Workload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefBatchNormalizationUint8Workload_Execute");
 
-    const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& varInfo = GetTensorInfo(m_Variance.get());
-    const TensorInfo& meanInfo = GetTensorInfo(m_Mean.get());
-    const TensorInfo& gammaInfo = GetTensorInfo(m_Gamma.get());
-    const TensorInfo& betaInfo = GetTensorInfo(m_Beta.get());
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-
-    auto input = Dequantize(GetInputTensorDataU8(0, m_Data), inputInfo0);
-    auto var = Dequantize(m_Variance->GetConstTensor<uint8_t>(), varInfo);
-    auto mean = Dequantize(m_Mean->GetConstTensor<uint8_t>(), meanInfo);
-    auto gamma = Dequantize(m_Gamma->GetConstTensor<uint8_t>(), gammaInfo);
-    auto beta = Dequantize(m_Beta->GetConstTensor<uint8_t>(), betaInfo);
-
-    std::vector<float> results(outputInfo.GetNumElements());
-    BatchNormImpl(m_Data, var.data(), mean.data(), gamma.data(), beta.data(), results.data(), input.data());
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), outputInfo);
+    BatchNormImpl(m_ScaleShift,
+                  GetTensorInfo(m_Data.m_Inputs[0]).GetShape(),
+                  m_Data.m_Parameters.m_DataLayout,
+                  GetTensorInfo(m_Data.m_Outputs[0]).GetQuantizationOffset(),
+                  GetInputTensorDataU8(0, m_Data),
+                  GetOutputTensorDataU8(0, m_Data));
 }
 
 } //namespace armnn
@@ -17,6 +17,16 @@ void RefBatchToSpaceNdUint8Workload::Execute() const
 
     const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+
+    // Moving data does not change the values, so with the same quantization the bytes can be copied as they are.
+    if (inputInfo.GetQuantizationScale() == outputInfo.GetQuantizationScale() &&
+        inputInfo.GetQuantizationOffset() == outputInfo.GetQuantizationOffset())
+    {
+        BatchToSpaceNd(m_Data.m_Parameters.m_DataLayout, inputInfo, outputInfo, m_Data.m_Parameters.m_BlockShape,
+                       m_Data.m_Parameters.m_Crops, GetInputTensorDataU8(0, m_Data), GetOutputTensorDataU8(0, m_Data));
+        return;
+    }
+
     auto dequantizedInputData = Dequantize(GetInputTensorDataU8(0, m_Data), inputInfo);
 
     std::vector<float> results(outputInfo.GetNumElements());
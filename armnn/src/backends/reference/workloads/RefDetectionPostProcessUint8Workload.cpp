@@ -15,7 +15,11 @@ namespace armnn
 RefDetectionPostProcessUint8Workload::RefDetectionPostProcessUint8Workload(
         const DetectionPostProcessQueueDescriptor& descriptor, const WorkloadInfo& info)
         : Uint8ToFloat32Workload<DetectionPostProcessQueueDescriptor>(descriptor, info),
-          m_Anchors(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Anchors))) {}
+          m_Anchors(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Anchors)))
+{
+    // The anchors are constant, so they are dequantized once here rather than on every execution.
+    m_DequantizedAnchors = Dequantize(m_Anchors->GetConstTensor<uint8_t>(), m_Anchors->GetTensorInfo());
+}
 
 void RefDetectionPostProcessUint8Workload::Execute() const
 {
@@ -31,11 +35,9 @@ void RefDetectionPostProcessUint8Workload::Execute() const
 
     const uint8_t* boxEncodingsData = GetInputTensorDataU8(0, m_Data);
     const uint8_t* scoresData = GetInputTensorDataU8(1, m_Data);
-    const uint8_t* anchorsData = m_Anchors->GetConstTensor<uint8_t>();
 
     auto boxEncodings = Dequantize(boxEncodingsData, boxEncodingsInfo);
     auto scores = Dequantize(scoresData, scoresInfo);
-    auto anchors = Dequantize(anchorsData, anchorsInfo);
 
     float* detectionBoxes = GetOutputTensorData<float>(0, m_Data);
     float* detectionClasses = GetOutputTensorData<float>(1, m_Data);
@@ -45,7 +47,7 @@ void RefDetectionPostProcessUint8Workload::Execute() const
     DetectionPostProcess(boxEncodingsInfo, scoresInfo, anchorsInfo,
                          detectionBoxesInfo, detectionClassesInfo,
                          detectionScoresInfo, numDetectionsInfo, m_Data.m_Parameters,
-                         boxEncodings.data(), scores.data(), anchors.data(),
+                         boxEncodings.data(), scores.data(), m_DequantizedAnchors.data(),
                          detectionBoxes, detectionClasses, detectionScores, numDetections);
 }
 
@@ -8,6 +8,8 @@
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
+#include <vector>
+
 namespace armnn
 {
 
@@ -20,6 +22,7 @@ public:
 
 private:
     std::unique_ptr<ScopedCpuTensorHandle> m_Anchors;
+    std::vector<float> m_DequantizedAnchors;
 };
 
 } //namespace armnn
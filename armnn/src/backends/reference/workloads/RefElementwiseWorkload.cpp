@@ -12,6 +12,7 @@
 #include "RefWorkloadUtils.hpp"
 #include "StringMapping.hpp"
 #include <ResolveType.hpp>
+#include <type_traits>
 #include <vector>
 
 namespace armnn
@@ -22,7 +23,12 @@ RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::RefElementwiseWo
     const ParentDescriptor& desc,
     const WorkloadInfo& info)
     : BaseWorkload<ParentDescriptor>(desc, info)
+    , m_UseFastPath(false)
 {
+    const DataType outputType = std::is_same<OutType, bool>::value ? DataType::Boolean : DataType::Float32;
+    m_UseFastPath = info.m_InputTensorInfos[0].GetDataType() == DataType::Float32 &&
+                    info.m_InputTensorInfos[1].GetDataType() == DataType::Float32 &&
+                    info.m_OutputTensorInfos[0].GetDataType() == outputType;
 }
 
 template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
@@ -49,6 +55,17 @@ void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::Execute() c
     const TensorShape& inShape1 = inputInfo1.GetShape();
     const TensorShape& outShape = outputInfo.GetShape();
 
+    if (m_UseFastPath)
+    {
+        ElementwiseFunction<Functor>(inShape0,
+                                     inShape1,
+                                     outShape,
+                                     GetInputTensorData<InType>(0, m_Data),
+                                     GetInputTensorData<InType>(1, m_Data),
+                                     GetOutputTensorData<OutStorageType>(0, m_Data));
+        return;
+    }
+
     ElementwiseFunction<Functor>(inShape0,
                                  inShape1,
                                  outShape,
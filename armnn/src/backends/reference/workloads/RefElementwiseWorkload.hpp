@@ -23,6 +23,7 @@ class RefElementwiseWorkload : public BaseWorkload<ParentDescriptor>
 public:
     using InType = typename ElementwiseFunction<Functor>::InType;
     using OutType = typename ElementwiseFunction<Functor>::OutType;
+    using OutStorageType = typename ElementwiseFunction<Functor>::OutStorageType;
     using BaseWorkload<ParentDescriptor>::m_Data;
 
     RefElementwiseWorkload(const ParentDescriptor& descriptor, const WorkloadInfo& info);
@@ -30,6 +31,10 @@ public:
     void Execute() const override;
 
 private:
+    /// True when every tensor is a plain array of the functor's types (Float32 in, Float32 or Boolean out), so
+    /// Execute() can use the raw pointer fast path instead of the decoders.
+    bool m_UseFastPath;
+
     std::unique_ptr<Decoder<InType>> m_Input0;
     std::unique_ptr<Decoder<InType>> m_Input1;
     std::unique_ptr<Encoder<OutType>> m_Output;
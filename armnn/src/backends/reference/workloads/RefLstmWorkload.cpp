@@ -10,32 +10,84 @@
 #include "LstmUtils.hpp"
 #include "RefWorkloadUtils.hpp"
 
+#include "Profiling.hpp"
+
+#include <algorithm>
+
 namespace armnn
 {
 
 RefLstmWorkload::RefLstmWorkload(const LstmQueueDescriptor &descriptor, const WorkloadInfo &info)
     : BaseWorkload<LstmQueueDescriptor>(descriptor, info)
-    , m_InputToInputWeightsTensor     (AssignScopedCpuTensorHandle(descriptor.m_InputToInputWeights))
-    , m_InputToForgetWeightsTensor    (AssignScopedCpuTensorHandle(descriptor.m_InputToForgetWeights))
-    , m_InputToCellWeightsTensor      (AssignScopedCpuTensorHandle(descriptor.m_InputToCellWeights))
-    , m_InputToOutputWeightsTensor    (AssignScopedCpuTensorHandle(descriptor.m_InputToOutputWeights))
-    , m_RecurrentToInputWeightsTensor (AssignScopedCpuTensorHandle(descriptor.m_RecurrentToInputWeights))
-    , m_RecurrentToForgetWeightsTensor(AssignScopedCpuTensorHandle(descriptor.m_RecurrentToForgetWeights))
-    , m_RecurrentToCellWeightsTensor  (AssignScopedCpuTensorHandle(descriptor.m_RecurrentToCellWeights))
-    , m_RecurrentToOutputWeightsTensor(AssignScopedCpuTensorHandle(descriptor.m_RecurrentToOutputWeights))
-    , m_CellToInputWeightsTensor      (AssignScopedCpuTensorHandle(descriptor.m_CellToInputWeights))
-    , m_CellToForgetWeightsTensor     (AssignScopedCpuTensorHandle(descriptor.m_CellToForgetWeights))
-    , m_CellToOutputWeightsTensor     (AssignScopedCpuTensorHandle(descriptor.m_CellToOutputWeights))
-    , m_InputGateBiasTensor           (AssignScopedCpuTensorHandle(descriptor.m_InputGateBias))
-    , m_ForgetGateBiasTensor          (AssignScopedCpuTensorHandle(descriptor.m_ForgetGateBias))
-    , m_CellBiasTensor                (AssignScopedCpuTensorHandle(descriptor.m_CellBias))
-    , m_OutputGateBiasTensor          (AssignScopedCpuTensorHandle(descriptor.m_OutputGateBias))
-    , m_ProjectionWeightsTensor       (AssignScopedCpuTensorHandle(descriptor.m_ProjectionWeights))
-    , m_ProjectionBiasTensor          (AssignScopedCpuTensorHandle(descriptor.m_ProjectionBias))
-{}
+{
+    if (info.m_InputTensorInfos[0].GetDataType() == DataType::Float32)
+    {
+        // The output state input is [batchSize, outputSize] whether or not the input is a sequence.
+        m_Kernel = std::make_unique<LstmKernel>(descriptor, info.m_InputTensorInfos[1].GetShape()[0]);
+        return;
+    }
+
+    m_InputToInputWeightsTensor      = AssignScopedCpuTensorHandle(descriptor.m_InputToInputWeights);
+    m_InputToForgetWeightsTensor     = AssignScopedCpuTensorHandle(descriptor.m_InputToForgetWeights);
+    m_InputToCellWeightsTensor       = AssignScopedCpuTensorHandle(descriptor.m_InputToCellWeights);
+    m_InputToOutputWeightsTensor     = AssignScopedCpuTensorHandle(descriptor.m_InputToOutputWeights);
+    m_RecurrentToInputWeightsTensor  = AssignScopedCpuTensorHandle(descriptor.m_RecurrentToInputWeights);
+    m_RecurrentToForgetWeightsTensor = AssignScopedCpuTensorHandle(descriptor.m_RecurrentToForgetWeights);
+    m_RecurrentToCellWeightsTensor   = AssignScopedCpuTensorHandle(descriptor.m_RecurrentToCellWeights);
+    m_RecurrentToOutputWeightsTensor = AssignScopedCpuTensorHandle(descriptor.m_RecurrentToOutputWeights);
+    m_CellToInputWeightsTensor       = AssignScopedCpuTensorHandle(descriptor.m_CellToInputWeights);
+    m_CellToForgetWeightsTensor      = AssignScopedCpuTensorHandle(descriptor.m_CellToForgetWeights);
+    m_CellToOutputWeightsTensor      = AssignScopedCpuTensorHandle(descriptor.m_CellToOutputWeights);
+    m_InputGateBiasTensor            = AssignScopedCpuTensorHandle(descriptor.m_InputGateBias);
+    m_ForgetGateBiasTensor           = AssignScopedCpuTensorHandle(descriptor.m_ForgetGateBias);
+    m_CellBiasTensor                 = AssignScopedCpuTensorHandle(descriptor.m_CellBias);
+    m_OutputGateBiasTensor           = AssignScopedCpuTensorHandle(descriptor.m_OutputGateBias);
+    m_ProjectionWeightsTensor        = AssignScopedCpuTensorHandle(descriptor.m_ProjectionWeights);
+    m_ProjectionBiasTensor           = AssignScopedCpuTensorHandle(descriptor.m_ProjectionBias);
+}
 
 void RefLstmWorkload::Execute() const
 {
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefLstmWorkload_Execute");
+
+    if (m_Kernel)
+    {
+        ExecuteFloat32();
+    }
+    else
+    {
+        ExecuteWithDecoders();
+    }
+}
+
+void RefLstmWorkload::ExecuteFloat32() const
+{
+    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
+    const unsigned int numSteps = m_Data.m_Parameters.m_SequenceMode ? inputInfo.GetShape()[0] : 1;
+
+    // The cell state is updated in place, in the cell state output.
+    const float* cellStateIn = GetInputTensorDataFloat(2, m_Data);
+    float* cellState = GetOutputTensorDataFloat(2, m_Data);
+    if (cellState != cellStateIn)
+    {
+        std::copy_n(cellStateIn, GetTensorInfo(m_Data.m_Outputs[2]).GetNumElements(), cellState);
+    }
+
+    float* output = GetOutputTensorDataFloat(3, m_Data);
+    m_Kernel->Run(GetInputTensorDataFloat(0, m_Data), GetInputTensorDataFloat(1, m_Data), cellState, numSteps, output);
+
+    // The output state is the output of the last time step.
+    const unsigned int outputStateSize = GetTensorInfo(m_Data.m_Outputs[1]).GetNumElements();
+    std::copy_n(output + (numSteps - 1) * outputStateSize, outputStateSize, GetOutputTensorDataFloat(1, m_Data));
+}
+
+void RefLstmWorkload::ExecuteWithDecoders() const
+{
+    if (m_Data.m_Parameters.m_SequenceMode)
+    {
+        throw InvalidArgumentException("RefLstmWorkload: sequence mode is only supported for Float32 tensors");
+    }
+
     // This is a porting of the LSTM::Eval() method in the Android code base
     // Refer to: android/frameworks/ml/nn/common/operations/LSTM.cpp
 
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "Lstm.hpp"
+
 #include <armnn/TypesUtils.hpp>
 
 #include <backendsCommon/Workload.hpp>
@@ -21,6 +23,13 @@ public:
     virtual void Execute() const override;
 
 private:
+    void ExecuteFloat32() const;
+    void ExecuteWithDecoders() const;
+
+    /// Set for Float32 tensors, which run on the packed kernel. Other data types go through Decoders and Encoders,
+    /// with the gates kept in the scratch buffer output, and use the weight tensors below.
+    std::unique_ptr<LstmKernel> m_Kernel;
+
     std::unique_ptr<ScopedCpuTensorHandle> m_InputToInputWeightsTensor;
     std::unique_ptr<ScopedCpuTensorHandle> m_InputToForgetWeightsTensor;
     std::unique_ptr<ScopedCpuTensorHandle> m_InputToCellWeightsTensor;
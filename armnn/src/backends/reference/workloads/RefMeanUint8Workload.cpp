@@ -10,8 +10,6 @@
 
 #include "Profiling.hpp"
 
-#include <vector>
-
 namespace armnn
 {
 
@@ -26,13 +24,8 @@ void RefMeanUint8Workload::Execute() const
     const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
 
-    auto dequant = Dequantize(GetInputTensorDataU8(0, m_Data), inputInfo);
-
-    std::vector<float> results(outputInfo.GetNumElements());
-
-    Mean(inputInfo, outputInfo, m_Data.m_Parameters.m_Axis, dequant.data(), results.data());
-
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), outputInfo);
+    Mean(inputInfo, outputInfo, m_Data.m_Parameters.m_Axis,
+         GetInputTensorDataU8(0, m_Data), GetOutputTensorDataU8(0, m_Data));
 }
 
 } //namespace armnn
@@ -0,0 +1,23 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefMergeWorkload.hpp"
+#include "RefWorkloadUtils.hpp"
+
+#include <cstring>
+
+namespace armnn
+{
+
+void RefMergeWorkload::Execute() const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefMergeWorkload_Execute");
+
+    std::memcpy(GetOutputTensorData<void>(0, m_Data),
+                GetInputTensorData<void>(0, m_Data),
+                GetTensorInfo(m_Data.m_Inputs[0]).GetNumBytes());
+}
+
+} // namespace armnn
@@ -0,0 +1,24 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <backendsCommon/Workload.hpp>
+
+namespace armnn
+{
+
+/// Forwards input 0 to the output. The runtime only uses this workload when both inputs are always computed: a
+/// Merge joining the branches of a Switch is replaced by a copy on each branch, so that the branch taken wins.
+class RefMergeWorkload : public BaseWorkload<MergeQueueDescriptor>
+{
+public:
+    using BaseWorkload<MergeQueueDescriptor>::m_Data;
+    using BaseWorkload<MergeQueueDescriptor>::BaseWorkload;
+
+    void Execute() const override;
+};
+
+} // namespace armnn
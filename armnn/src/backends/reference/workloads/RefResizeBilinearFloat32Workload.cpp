@@ -6,7 +6,7 @@
 #include "RefResizeBilinearFloat32Workload.hpp"
 
 #include "RefWorkloadUtils.hpp"
-#include "ResizeBilinear.hpp"
+#include "Resize.hpp"
 
 #include "Profiling.hpp"
 
@@ -20,11 +20,11 @@ void RefResizeBilinearFloat32Workload::Execute() const
     const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
 
-    ResizeBilinear(GetInputTensorDataFloat(0, m_Data),
-        inputInfo,
-        GetOutputTensorDataFloat(0, m_Data),
-        outputInfo,
-        m_Data.m_Parameters.m_DataLayout);
+    Resize(GetInputTensorDataFloat(0, m_Data),
+           inputInfo,
+           GetOutputTensorDataFloat(0, m_Data),
+           outputInfo,
+           m_Data.m_Parameters.m_DataLayout);
 }
 
 } //namespace armnn
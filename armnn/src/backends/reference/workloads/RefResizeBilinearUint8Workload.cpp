@@ -6,12 +6,10 @@
 #include "RefResizeBilinearUint8Workload.hpp"
 
 #include "RefWorkloadUtils.hpp"
-#include "ResizeBilinear.hpp"
+#include "Resize.hpp"
 
 #include "Profiling.hpp"
 
-#include <vector>
-
 namespace armnn
 {
 
@@ -22,12 +20,11 @@ void RefResizeBilinearUint8Workload::Execute() const
     const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
 
-    auto dequant = Dequantize(GetInputTensorDataU8(0, m_Data), inputInfo);
-
-    std::vector<float> results(outputInfo.GetNumElements());
-    ResizeBilinear(dequant.data(), inputInfo, results.data(), outputInfo, m_Data.m_Parameters.m_DataLayout);
-
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), outputInfo);
+    Resize(GetInputTensorDataU8(0, m_Data),
+           inputInfo,
+           GetOutputTensorDataU8(0, m_Data),
+           outputInfo,
+           m_Data.m_Parameters.m_DataLayout);
 }
 
 } //namespace armnn
@@ -10,27 +10,30 @@
 
 #include "Profiling.hpp"
 
-#include <vector>
-
 namespace armnn
 {
 
+RefSoftmaxUint8Workload::RefSoftmaxUint8Workload(const SoftmaxQueueDescriptor& descriptor,
+                                                 const WorkloadInfo& info)
+    : Uint8Workload<SoftmaxQueueDescriptor>(descriptor, info)
+    , m_Scratch(info.m_InputTensorInfos[0].GetNumElements())
+{
+}
+
 void RefSoftmaxUint8Workload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefSoftmaxUint8Workload_Execute");
 
     const TensorInfo& tensorInfo = GetTensorInfo(m_Data.m_Inputs[0]);
 
-    auto dequant = Dequantize(GetInputTensorDataU8(0, m_Data), tensorInfo);
-
-    std::vector<float> results(tensorInfo.GetNumElements());
+    Dequantize(GetInputTensorDataU8(0, m_Data), m_Scratch.data(), tensorInfo);
 
-    Softmax(dequant.data(),
-            results.data(),
+    Softmax(m_Scratch.data(),
+            m_Scratch.data(),
             tensorInfo,
             m_Data.m_Parameters.m_Beta);
 
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), GetTensorInfo(m_Data.m_Outputs[0]));
+    Quantize(GetOutputTensorDataU8(0, m_Data), m_Scratch.data(), GetTensorInfo(m_Data.m_Outputs[0]));
 }
 
 } //namespace armnn
@@ -8,14 +8,20 @@
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
+#include <vector>
+
 namespace armnn
 {
 
 class RefSoftmaxUint8Workload : public Uint8Workload<SoftmaxQueueDescriptor>
 {
 public:
-    using Uint8Workload<SoftmaxQueueDescriptor>::Uint8Workload;
+    RefSoftmaxUint8Workload(const SoftmaxQueueDescriptor& descriptor, const WorkloadInfo& info);
     virtual void Execute() const override;
+
+private:
+    /// Dequantized input, normalised in place and then requantized. Allocated once rather than on every Execute().
+    mutable std::vector<float> m_Scratch;
 };
 
 } //namespace armnn
@@ -0,0 +1,28 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefSwitchWorkload.hpp"
+#include "RefWorkloadUtils.hpp"
+
+#include <backendsCommon/WorkloadUtils.hpp>
+
+#include <cstring>
+
+namespace armnn
+{
+
+void RefSwitchWorkload::Execute() const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefSwitchWorkload_Execute");
+
+    const TensorInfo& conditionInfo = GetTensorInfo(m_Data.m_Inputs[1]);
+    const unsigned int branch = IsSwitchConditionTrue(*m_Data.m_Inputs[1], conditionInfo) ? 1 : 0;
+
+    std::memcpy(GetOutputTensorData<void>(branch, m_Data),
+                GetInputTensorData<void>(0, m_Data),
+                GetTensorInfo(m_Data.m_Inputs[0]).GetNumBytes());
+}
+
+} // namespace armnn
@@ -0,0 +1,24 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <backendsCommon/Workload.hpp>
+
+namespace armnn
+{
+
+/// Copies the input to output 1 if the condition is true and to output 0 otherwise. The other output is not
+/// touched, so that it need not even be allocated when the runtime skips the branch it feeds.
+class RefSwitchWorkload : public BaseWorkload<SwitchQueueDescriptor>
+{
+public:
+    using BaseWorkload<SwitchQueueDescriptor>::m_Data;
+    using BaseWorkload<SwitchQueueDescriptor>::BaseWorkload;
+
+    void Execute() const override;
+};
+
+} // namespace armnn
@@ -34,7 +34,7 @@
 #include "RefReshapeUint8Workload.hpp"
 #include "RefResizeBilinearFloat32Workload.hpp"
 #include "RefBatchNormalizationUint8Workload.hpp"
-#include "ResizeBilinear.hpp"
+#include "Resize.hpp"
 #include "RefNormalizationFloat32Workload.hpp"
 #include "RefDetectionPostProcessFloat32Workload.hpp"
 #include "RefDetectionPostProcessUint8Workload.hpp"
@@ -59,5 +59,7 @@
 #include "RefDebugWorkload.hpp"
 #include "RefRsqrtFloat32Workload.hpp"
 #include "RefDequantizeWorkload.hpp"
+#include "RefMergeWorkload.hpp"
+#include "RefSwitchWorkload.hpp"
 
 #include "RefQuantizeWorkload.hpp"
@@ -0,0 +1,205 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "Resize.hpp"
+
+#include <ParallelFor.hpp>
+
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+namespace
+{
+
+// Each output element costs a handful of multiply-adds, so a task should write at least this many of them.
+constexpr unsigned int g_MinElementsPerTask = 16384;
+
+/// The input texels and weight used for one output row or column.
+struct ResizeCoefficient
+{
+    unsigned int m_Index0;
+    unsigned int m_Index1;
+    float        m_Weight;
+};
+
+std::vector<ResizeCoefficient> ComputeCoefficients(unsigned int outputSize, unsigned int inputSize, ResizeMethod method)
+{
+    // How much to scale pixel coordinates in the output image, to get the corresponding pixel coordinates
+    // in the input image.
+    const float scale = boost::numeric_cast<float>(inputSize) / boost::numeric_cast<float>(outputSize);
+
+    std::vector<ResizeCoefficient> coefficients(outputSize);
+    for (unsigned int i = 0; i < outputSize; ++i)
+    {
+        const float position = boost::numeric_cast<float>(i) * scale;
+        const float floorPosition = floorf(position);
+        const unsigned int index0 = std::min(boost::numeric_cast<unsigned int>(floorPosition), inputSize - 1u);
+
+        if (method == ResizeMethod::NearestNeighbor)
+        {
+            coefficients[i] = { index0, index0, 0.f };
+        }
+        else
+        {
+            coefficients[i] = { index0, std::min(index0 + 1, inputSize - 1u), position - floorPosition };
+        }
+    }
+    return coefficients;
+}
+
+inline float Lerp(float a, float b, float w)
+{
+    return w * b + (1.f - w) * a;
+}
+
+/// Converts an interpolated value, in the units of the input tensor, to an output element.
+template <typename T>
+class OutputConverter;
+
+template <>
+class OutputConverter<float>
+{
+public:
+    OutputConverter(const TensorInfo&, const TensorInfo&) {}
+
+    float operator()(float value) const { return value; }
+};
+
+template <>
+class OutputConverter<uint8_t>
+{
+public:
+    OutputConverter(const TensorInfo& inputInfo, const TensorInfo& outputInfo)
+        : m_InputOffset(boost::numeric_cast<float>(inputInfo.GetQuantizationOffset()))
+        , m_Scale(inputInfo.GetQuantizationScale() / outputInfo.GetQuantizationScale())
+        , m_OutputOffset(boost::numeric_cast<float>(outputInfo.GetQuantizationOffset()))
+    {}
+
+    uint8_t operator()(float value) const
+    {
+        // Rounds like armnn::Quantize, before adding the output offset.
+        const float quantized = std::round((value - m_InputOffset) * m_Scale) + m_OutputOffset;
+        return static_cast<uint8_t>(std::min(std::max(quantized, 0.f), 255.f));
+    }
+
+private:
+    float m_InputOffset;
+    float m_Scale;
+    float m_OutputOffset;
+};
+
+/// Writes one output row from two input rows. Rows hold @a channels contiguous values per pixel: every channel for
+/// NHWC, a single one for NCHW.
+template <typename T>
+void ResizeRow(const T* topRow,
+               const T* bottomRow,
+               float yWeight,
+               const std::vector<ResizeCoefficient>& xCoefficients,
+               unsigned int channels,
+               ResizeMethod method,
+               const OutputConverter<T>& convert,
+               T* outRow)
+{
+    if (method == ResizeMethod::NearestNeighbor)
+    {
+        for (const ResizeCoefficient& x : xCoefficients)
+        {
+            const T* pixel = topRow + x.m_Index0 * channels;
+            for (unsigned int c = 0; c < channels; ++c)
+            {
+                outRow[c] = convert(static_cast<float>(pixel[c]));
+            }
+            outRow += channels;
+        }
+        return;
+    }
+
+    for (const ResizeCoefficient& x : xCoefficients)
+    {
+        const T* topLeft = topRow + x.m_Index0 * channels;
+        const T* topRight = topRow + x.m_Index1 * channels;
+        const T* bottomLeft = bottomRow + x.m_Index0 * channels;
+        const T* bottomRight = bottomRow + x.m_Index1 * channels;
+        for (unsigned int c = 0; c < channels; ++c)
+        {
+            const float top = Lerp(static_cast<float>(topLeft[c]), static_cast<float>(topRight[c]), x.m_Weight);
+            const float bottom =
+                Lerp(static_cast<float>(bottomLeft[c]), static_cast<float>(bottomRight[c]), x.m_Weight);
+            outRow[c] = convert(Lerp(top, bottom, yWeight));
+        }
+        outRow += channels;
+    }
+}
+
+} // anonymous namespace
+
+template <typename T>
+void Resize(const T*          in,
+            const TensorInfo& inputInfo,
+            T*                out,
+            const TensorInfo& outputInfo,
+            DataLayoutIndexed dataLayout,
+            ResizeMethod      method)
+{
+    const unsigned int batchSize = inputInfo.GetShape()[0];
+    const unsigned int channelCount = inputInfo.GetShape()[dataLayout.GetChannelsIndex()];
+
+    const unsigned int inputHeight = inputInfo.GetShape()[dataLayout.GetHeightIndex()];
+    const unsigned int inputWidth = inputInfo.GetShape()[dataLayout.GetWidthIndex()];
+    const unsigned int outputHeight = outputInfo.GetShape()[dataLayout.GetHeightIndex()];
+    const unsigned int outputWidth = outputInfo.GetShape()[dataLayout.GetWidthIndex()];
+
+    if (outputInfo.GetNumElements() == 0)
+    {
+        return;
+    }
+
+    const std::vector<ResizeCoefficient> yCoefficients = ComputeCoefficients(outputHeight, inputHeight, method);
+    const std::vector<ResizeCoefficient> xCoefficients = ComputeCoefficients(outputWidth, inputWidth, method);
+    const OutputConverter<T> convert(inputInfo, outputInfo);
+
+    // NHWC rows hold every channel of each pixel. NCHW is treated as batchSize * channelCount single-channel images.
+    const bool isNhwc = dataLayout.GetDataLayout() == DataLayout::NHWC;
+    const unsigned int numImages = isNhwc ? batchSize : batchSize * channelCount;
+    const unsigned int rowChannels = isNhwc ? channelCount : 1;
+    const unsigned int inputRowSize = inputWidth * rowChannels;
+    const unsigned int outputRowSize = outputWidth * rowChannels;
+
+    const unsigned int minRowsPerTask = std::max(1u, g_MinElementsPerTask / outputRowSize);
+    ParallelFor(numImages * outputHeight, minRowsPerTask, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int row = begin; row < end; ++row)
+        {
+            const unsigned int image = row / outputHeight;
+            const ResizeCoefficient& y = yCoefficients[row % outputHeight];
+
+            const T* inputImage = in + image * inputHeight * inputRowSize;
+            ResizeRow(inputImage + y.m_Index0 * inputRowSize,
+                      inputImage + y.m_Index1 * inputRowSize,
+                      y.m_Weight,
+                      xCoefficients,
+                      rowChannels,
+                      method,
+                      convert,
+                      out + row * outputRowSize);
+        }
+    });
+}
+
+template void Resize<float>(const float*, const TensorInfo&, float*, const TensorInfo&, DataLayoutIndexed,
+                            ResizeMethod);
+template void Resize<uint8_t>(const uint8_t*, const TensorInfo&, uint8_t*, const TensorInfo&, DataLayoutIndexed,
+                              ResizeMethod);
+
+} //namespace armnn
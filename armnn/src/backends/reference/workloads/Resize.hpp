@@ -0,0 +1,38 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Tensor.hpp>
+
+#include <DataLayoutIndexed.hpp>
+
+namespace armnn
+{
+
+enum class ResizeMethod
+{
+    Bilinear,
+    NearestNeighbor
+};
+
+/// Resizes the height and width of an NCHW or NHWC image tensor.
+///
+/// As in TensorFlow and AndroidNN, the top-left corner of each output texel is projected into the input image.
+/// Bilinear resize interpolates between the 2x2 input texels around that point; nearest neighbour resize takes the
+/// top-left one. The source indices and weights are computed once per output row and column, and the output is
+/// written in memory order, one output row per work item, threaded with ParallelFor.
+///
+/// Instantiated for float and uint8_t. QAsymm8 tensors are interpolated on their quantized values and requantized
+/// directly to the output's quantization parameters, without going through a float copy of the tensor.
+template <typename T>
+void Resize(const T*                      in,
+            const TensorInfo&             inputInfo,
+            T*                            out,
+            const TensorInfo&             outputInfo,
+            armnnUtils::DataLayoutIndexed dataLayout = DataLayout::NCHW,
+            ResizeMethod                  method = ResizeMethod::Bilinear);
+
+} //namespace armnn
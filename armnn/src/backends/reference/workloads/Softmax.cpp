@@ -4,46 +4,102 @@
 //
 
 #include "Softmax.hpp"
+#include "FastMath.hpp"
 
+#include <ParallelFor.hpp>
+
+#include <algorithm>
 #include <cmath>
-#include <vector>
 
 namespace armnn
 {
 
+namespace
+{
+
+// Rows are independent, so they are split across threads. Each task should cover enough elements for the
+// hand-off to the worker threads to pay for itself.
+constexpr unsigned int g_MinElementsPerTask = 16384;
+
+float RowMax(const float* in, unsigned int numChannels)
+{
+    float max = in[0];
+    for (unsigned int c = 1; c < numChannels; c++)
+    {
+        max = std::max(max, in[c]);
+    }
+    return max;
+}
+
+template <typename RowFunction>
+void ForEachRow(const TensorInfo& tensorInfo, RowFunction rowFunction)
+{
+    const unsigned int numRows     = tensorInfo.GetShape()[0];
+    const unsigned int numChannels = tensorInfo.GetShape()[1];
+    const unsigned int minRowsPerTask = std::max(1u, g_MinElementsPerTask / std::max(1u, numChannels));
+
+    armnnUtils::ParallelFor(numRows, minRowsPerTask, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int n = begin; n < end; n++)
+        {
+            rowFunction(n * numChannels, numChannels);
+        }
+    });
+}
+
+} // anonymous namespace
+
 /// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
 void Softmax(const float* in, float* out, const TensorInfo& tensorInfo, float beta)
 {
-    unsigned int numChannels = tensorInfo.GetShape()[1];
-    for (unsigned int n = 0; n < tensorInfo.GetShape()[0]; n++)
+    ForEachRow(tensorInfo, [in, out, beta](unsigned int offset, unsigned int numChannels)
     {
-        // Find maximum channel.
-        float max = in[n * numChannels];
-        for (unsigned int c = 1; c < numChannels; c++)
+        const float* inRow  = in + offset;
+        float*       outRow = out + offset;
+
+        const float max = RowMax(inRow, numChannels);
+
+        // Exponentiate into the output row, then normalise in place.
+        float sum = 0.0f;
+        for (unsigned int c = 0; c < numChannels; c++)
         {
-            float val = in[n * numChannels + c];
-            if (val > max)
-            {
-                max = val;
-            }
+            outRow[c] = FastExp((inRow[c] - max) * beta);
+            sum += outRow[c];
         }
 
-        // Exponentiate all values and sum.
-        std::vector<float> exponentials(numChannels);
-        float              sum = 0.0f;
+        const float scale = 1.0f / sum;
         for (unsigned int c = 0; c < numChannels; c++)
         {
-            float val       = in[n * numChannels + c];
-            exponentials[c] = expf((val - max) * beta);
-            sum += exponentials[c];
+            outRow[c] *= scale;
         }
+    });
+}
 
-        // Divide exponentials by sum to give outputs.
+/// Computes log(softmax) on some inputs, into outputs, with a shape given by tensorInfo.
+void LogSoftmax(const float* in, float* out, const TensorInfo& tensorInfo, float beta)
+{
+    ForEachRow(tensorInfo, [in, out, beta](unsigned int offset, unsigned int numChannels)
+    {
+        const float* inRow  = in + offset;
+        float*       outRow = out + offset;
+
+        const float max = RowMax(inRow, numChannels);
+
+        // log(softmax(x)) = (x - max) * beta - log(sum(exp((x - max) * beta))), which never takes the log of a
+        // value that has underflowed to zero.
+        float sum = 0.0f;
         for (unsigned int c = 0; c < numChannels; c++)
         {
-            out[n * numChannels + c] = exponentials[c] / sum;
+            outRow[c] = (inRow[c] - max) * beta;
+            sum += FastExp(outRow[c]);
         }
-    }
+
+        const float logSum = std::log(sum);
+        for (unsigned int c = 0; c < numChannels; c++)
+        {
+            outRow[c] -= logSum;
+        }
+    });
 }
 
 } //namespace armnn
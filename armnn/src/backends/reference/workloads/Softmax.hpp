@@ -11,6 +11,10 @@ namespace armnn
 {
 
 /// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
+/// in and out may point to the same buffer.
 void Softmax(const float* in, float* out, const TensorInfo& tensorInfo, float beta);
 
+/// Computes log(softmax) on some inputs, into outputs, with a shape given by tensorInfo.
+void LogSoftmax(const float* in, float* out, const TensorInfo& tensorInfo, float beta);
+
 } //namespace armnn
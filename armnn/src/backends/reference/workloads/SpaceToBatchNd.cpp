@@ -4,33 +4,29 @@
 //
 
 #include "SpaceToBatchNd.hpp"
+#include "CopyPlan.hpp"
 
 #include <DataLayoutIndexed.hpp>
 
+#include <algorithm>
+#include <cstddef>
+
 using namespace armnnUtils;
 
 namespace armnn
 {
 
-unsigned int GetOffset(const TensorShape& shape,
-                       unsigned int b,
-                       unsigned int h,
-                       unsigned int w,
-                       unsigned int c,
-                       const DataLayoutIndexed& dataLayout)
+namespace
 {
-    if (dataLayout.GetDataLayout() == DataLayout::NHWC)
-    {
-        return ((b * shape[dataLayout.GetHeightIndex()] + h) * shape[dataLayout.GetWidthIndex()] + w) *
-               shape[dataLayout.GetChannelsIndex()] + c;
-    }
-    else
-    {
-        return ((b * shape[dataLayout.GetChannelsIndex()] + c) * shape[dataLayout.GetHeightIndex()] + h) *
-               shape[dataLayout.GetWidthIndex()] + w;
-    }
+
+/// Returns the smallest index i for which i * block + shift >= threshold.
+unsigned int FirstBlockIndexAtOrAbove(unsigned int threshold, unsigned int shift, unsigned int block)
+{
+    return threshold <= shift ? 0 : (threshold - shift + block - 1) / block;
 }
 
+} // anonymous namespace
+
 template<typename T>
 void SpaceToBatchNd(const TensorInfo& inputInfo,
                     const TensorInfo& outputInfo,
@@ -59,6 +55,28 @@ void SpaceToBatchNd(const TensorInfo& inputInfo,
     const unsigned int paddingTop = params.m_PadList[0].first;
     const unsigned int paddingLeft = params.m_PadList[1].first;
 
+    const ImageStrides inputStrides(inputShape, params.m_DataLayout);
+    const ImageStrides outputStrides(outputShape, params.m_DataLayout);
+
+    // Output pixel (outH, outW) of batch outB reads input pixel (outH * blockHeight + shiftH - paddingTop,
+    // outW * blockWidth + shiftW - paddingLeft) of batch inB: a subsampled view of the input.
+    ImageStrides blockedInputStrides = inputStrides;
+    blockedInputStrides.m_Height *= blockHeight;
+    blockedInputStrides.m_Width *= blockWidth;
+
+    auto zeroRegion = [&](unsigned int outB, unsigned int h, unsigned int height, unsigned int w, unsigned int width)
+    {
+        if (height == 0 || width == 0)
+        {
+            return;
+        }
+        const std::ptrdiff_t offset = static_cast<std::ptrdiff_t>(outB) * outputStrides.m_Batch +
+                                      static_cast<std::ptrdiff_t>(h) * outputStrides.m_Height +
+                                      static_cast<std::ptrdiff_t>(w) * outputStrides.m_Width;
+        CopyPlan(MakeImageBox(params.m_DataLayout, height, width, channels, outputStrides, outputStrides))
+            .Zero(outputData + offset, sizeof(T));
+    };
+
     for (unsigned int outB = 0; outB < outputBatchSize; outB++)
     {
         unsigned int inB = outB % inputBatchSize;
@@ -66,49 +84,32 @@ void SpaceToBatchNd(const TensorInfo& inputInfo,
         unsigned int shiftW = (outB / inputBatchSize) % blockWidth;
         unsigned int shiftH = (outB / inputBatchSize) / blockWidth;
 
-        for (unsigned int outH = 0; outH < outputHeight; outH++)
+        // The output rows and columns that read from inside the input; the rest of the batch is padding.
+        const unsigned int beginH = std::min(outputHeight, FirstBlockIndexAtOrAbove(paddingTop, shiftH, blockHeight));
+        const unsigned int endH = std::max(beginH, std::min(outputHeight,
+            FirstBlockIndexAtOrAbove(paddingTop + inputHeight, shiftH, blockHeight)));
+        const unsigned int beginW = std::min(outputWidth, FirstBlockIndexAtOrAbove(paddingLeft, shiftW, blockWidth));
+        const unsigned int endW = std::max(beginW, std::min(outputWidth,
+            FirstBlockIndexAtOrAbove(paddingLeft + inputWidth, shiftW, blockWidth)));
+
+        if (endH > beginH && endW > beginW)
         {
-            for (unsigned int outW = 0; outW < outputWidth; outW++)
-            {
-                if (outH * blockHeight + shiftH < paddingTop ||
-                    outH * blockHeight + shiftH >= paddingTop + inputHeight ||
-                    outW * blockWidth + shiftW < paddingLeft ||
-                    outW * blockWidth + shiftW >= paddingLeft + inputWidth)
-                {
-                    for (unsigned int c = 0; c < channels; c++)
-                    {
-                        unsigned int outOffset = GetOffset(outputShape,
-                                                           outB,
-                                                           outH,
-                                                           outW,
-                                                           c,
-                                                           dataLayout);
-                        outputData[outOffset] = 0;
-                    }
-                }
-                else
-                {
-                    for (unsigned int c = 0; c < channels; c++)
-                    {
-                        unsigned int inOffset = GetOffset(inputShape,
-                                                          inB,
-                                                          (outH * blockHeight + shiftH) - paddingTop,
-                                                          (outW * blockWidth + shiftW) - paddingLeft,
-                                                          c,
-                                                          dataLayout);
-
-                        unsigned int outOffset = GetOffset(outputShape,
-                                                           outB,
-                                                           outH,
-                                                           outW,
-                                                           c,
-                                                           dataLayout);
-
-                        outputData[outOffset] = inputData[inOffset];
-                    }
-                }
-            }
+            const std::ptrdiff_t inOffset =
+                static_cast<std::ptrdiff_t>(inB) * inputStrides.m_Batch +
+                static_cast<std::ptrdiff_t>(beginH * blockHeight + shiftH - paddingTop) * inputStrides.m_Height +
+                static_cast<std::ptrdiff_t>(beginW * blockWidth + shiftW - paddingLeft) * inputStrides.m_Width;
+            const std::ptrdiff_t outOffset = static_cast<std::ptrdiff_t>(outB) * outputStrides.m_Batch +
+                                             static_cast<std::ptrdiff_t>(beginH) * outputStrides.m_Height +
+                                             static_cast<std::ptrdiff_t>(beginW) * outputStrides.m_Width;
+            CopyPlan(MakeImageBox(params.m_DataLayout, endH - beginH, endW - beginW, channels,
+                                  blockedInputStrides, outputStrides))
+                .Copy(inputData + inOffset, outputData + outOffset, sizeof(T));
         }
+
+        zeroRegion(outB, 0, beginH, 0, outputWidth);
+        zeroRegion(outB, endH, outputHeight - endH, 0, outputWidth);
+        zeroRegion(outB, beginH, endH - beginH, 0, beginW);
+        zeroRegion(outB, beginH, endH - beginH, endW, outputWidth - endW);
     }
 }
 
@@ -4,6 +4,7 @@
 //
 
 #include "StridedSlice.hpp"
+#include "CopyPlan.hpp"
 
 #include <boost/assert.hpp>
 #include <boost/numeric/conversion/cast.hpp>
@@ -93,54 +94,42 @@ void StridedSlice(const TensorInfo& inputInfo,
     // Pad parameters to 4 dimensions
     PadParams(paddedParams, 4);
 
-    const int start0 =
-        paddedParams.GetStartForAxis(inputShape, 0);
-    const int stop0 =
-        paddedParams.GetStopForAxis(inputShape, 0, start0);
-
-    const int start1 =
-        paddedParams.GetStartForAxis(inputShape, 1);
-    const int stop1 =
-        paddedParams.GetStopForAxis(inputShape, 1, start1);
-
-    const int start2 =
-        paddedParams.GetStartForAxis(inputShape, 2);
-    const int stop2 =
-        paddedParams.GetStopForAxis(inputShape, 2, start2);
+    // Each axis is a strided walk over the input from its start towards its stop; the output is the row-major
+    // list of the visited elements.
+    const std::vector<std::ptrdiff_t> inputStrides = GetRowMajorStrides(inputShape);
+    unsigned int counts[4];
+    std::ptrdiff_t inputOffset = 0;
+    for (unsigned int axis = 0; axis < 4; ++axis)
+    {
+        const int start = paddedParams.GetStartForAxis(inputShape, axis);
+        const int stop = paddedParams.GetStopForAxis(inputShape, axis, start);
+        const int stride = paddedParams.m_Stride[axis];
 
-    const int start3 =
-        paddedParams.GetStartForAxis(inputShape, 3);
-    const int stop3 =
-        paddedParams.GetStopForAxis(inputShape, 3, start3);
+        counts[axis] = 0;
+        if (!LoopCondition(start, stop, stride))
+        {
+            const int distance = stride > 0 ? stop - start : start - stop;
+            const int step = stride > 0 ? stride : -stride;
+            counts[axis] = boost::numeric_cast<unsigned int>((distance + step - 1) / step);
+        }
+        inputOffset += static_cast<std::ptrdiff_t>(start) * inputStrides[axis];
+    }
 
-    T* outPtr = outputData;
+    if (counts[0] == 0 || counts[1] == 0 || counts[2] == 0 || counts[3] == 0)
+    {
+        return;
+    }
 
-    for (int in0 = start0;
-         !LoopCondition(in0, stop0, paddedParams.m_Stride[0]);
-         in0 += paddedParams.m_Stride[0])
+    std::vector<CopyDimension> dimensions;
+    std::ptrdiff_t outputStride = 1;
+    for (unsigned int axis = 4; axis-- > 0;)
     {
-        for (int in1 = start1;
-             !LoopCondition(in1, stop1, paddedParams.m_Stride[1]);
-             in1 += paddedParams.m_Stride[1])
-        {
-            for (int in2 = start2;
-                 !LoopCondition(in2, stop2, paddedParams.m_Stride[2]);
-                 in2 += paddedParams.m_Stride[2])
-            {
-                for (int in3 = start3;
-                     !LoopCondition(in3, stop3, paddedParams.m_Stride[3]);
-                     in3 += paddedParams.m_Stride[3])
-                {
-                    int dim1 = boost::numeric_cast<int>(inputShape[1]);
-                    int dim2 = boost::numeric_cast<int>(inputShape[2]);
-                    int dim3 = boost::numeric_cast<int>(inputShape[3]);
-
-                    int inputOffset = ((in0 * dim1 + in1) * dim2 + in2) * dim3 + in3;
-                    *(outPtr++) = inputData[inputOffset];
-                }
-            }
-        }
+        dimensions.insert(dimensions.begin(),
+                          { counts[axis], paddedParams.m_Stride[axis] * inputStrides[axis], outputStride });
+        outputStride *= static_cast<std::ptrdiff_t>(counts[axis]);
     }
+
+    CopyPlan(dimensions).Copy(inputData + inputOffset, outputData, sizeof(T));
 }
 
 template void StridedSlice<float>(const TensorInfo& inputInfo,
@@ -25,6 +25,7 @@
 
 #include <Logging.hpp>
 #include <Profiling.hpp>
+#include <TensorDataset.hpp>
 
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -160,6 +161,43 @@ auto ParseDataArray<armnn::DataType::QuantisedAsymm8>(std::istream& stream,
                                    });
 }
 
+// Copies the first sample of a binary tensor dataset, checking that it has the expected data type.
+template<typename T>
+std::vector<T> ReadDatasetSample(const armnnUtils::TensorDataset& dataset, armnn::DataType expectedType)
+{
+    if (dataset.GetNumSamples() == 0)
+    {
+        throw armnn::ParseException("The tensor dataset has no samples");
+    }
+    if (dataset.GetSampleInfo().GetDataType() != expectedType)
+    {
+        throw armnn::ParseException(std::string("The tensor dataset holds ") +
+                                    armnn::GetDataTypeName(dataset.GetSampleInfo().GetDataType()) +
+                                    " data, not " + armnn::GetDataTypeName(expectedType));
+    }
+    const T* sample = dataset.GetSample<T>(0);
+    return std::vector<T>(sample, sample + dataset.GetSampleInfo().GetNumElements());
+}
+
+// Float32 samples given to a qasymm8 input are quantized, like the values of a text file.
+std::vector<uint8_t> ReadQuantizedDatasetSample(const armnnUtils::TensorDataset& dataset,
+                                                float quantizationScale,
+                                                int32_t quantizationOffset)
+{
+    if (dataset.GetSampleInfo().GetDataType() != armnn::DataType::Float32)
+    {
+        return ReadDatasetSample<uint8_t>(dataset, armnn::DataType::QuantisedAsymm8);
+    }
+
+    const std::vector<float> values = ReadDatasetSample<float>(dataset, armnn::DataType::Float32);
+    std::vector<uint8_t> result(values.size());
+    std::transform(values.begin(), values.end(), result.begin(), [&](float value)
+    {
+        return armnn::Quantize<uint8_t>(value, quantizationScale, quantizationOffset);
+    });
+    return result;
+}
+
 std::vector<unsigned int> ParseArray(std::istream& stream)
 {
     return ParseArrayImpl<unsigned int>(stream,
@@ -293,6 +331,34 @@ int MainImpl(const char* modelPath,
 
         for(unsigned int i = 0; i < inputTensorDataFilePaths.size(); ++i)
         {
+            // Binary tensor datasets are memory mapped instead of parsed.
+            if (armnnUtils::TensorDataset::IsTensorDataset(inputTensorDataFilePaths[i]))
+            {
+                armnnUtils::TensorDataset dataset(inputTensorDataFilePaths[i]);
+                if (inputTypes[i].compare("float") == 0)
+                {
+                    inputDataContainers.push_back(ReadDatasetSample<float>(dataset, armnn::DataType::Float32));
+                }
+                else if (inputTypes[i].compare("int") == 0)
+                {
+                    inputDataContainers.push_back(ReadDatasetSample<int>(dataset, armnn::DataType::Signed32));
+                }
+                else if (inputTypes[i].compare("qasymm8") == 0)
+                {
+                    auto inputBinding = model.GetInputBindingInfo();
+                    inputDataContainers.push_back(
+                        ReadQuantizedDatasetSample(dataset,
+                                                   inputBinding.second.GetQuantizationScale(),
+                                                   inputBinding.second.GetQuantizationOffset()));
+                }
+                else
+                {
+                    BOOST_LOG_TRIVIAL(fatal) << "Unsupported tensor data type \"" << inputTypes[i] << "\". ";
+                    return EXIT_FAILURE;
+                }
+                continue;
+            }
+
             std::ifstream inputTensorFile(inputTensorDataFilePaths[i]);
 
             if (inputTypes[i].compare("float") == 0)
@@ -611,8 +677,8 @@ int RunCsvTest(const armnnUtils::CsvRow &csvRow, const std::shared_ptr<armnn::IR
          "Several shapes can be passed separating them by semicolon. "
          "This parameter is optional, depending on the network.")
         ("input-tensor-data,d", po::value(&inputTensorDataFilePaths),
-         "Path to files containing the input data as a flat array separated by whitespace. "
-         "Several paths can be passed separating them by comma.")
+         "Path to files containing the input data as a flat array separated by whitespace, or as a binary tensor "
+         "dataset (the first sample is used). Several paths can be passed separating them by comma.")
         ("input-type,y",po::value(&inputTypes), "The type of the input tensors in the network separated by comma. "
          "If unset, defaults to \"float\" for all defined inputs. "
          "Accepted values (float, int or qasymm8).")
@@ -731,8 +797,8 @@ int main(int argc, const char* argv[])
              "Several shapes can be passed separating them by semicolon. "
              "This parameter is optional, depending on the network.")
             ("input-tensor-data,d", po::value(&inputTensorDataFilePaths),
-             "Path to files containing the input data as a flat array separated by whitespace. "
-             "Several paths can be passed separating them by comma. ")
+             "Path to files containing the input data as a flat array separated by whitespace, or as a binary "
+             "tensor dataset (the first sample is used). Several paths can be passed separating them by comma. ")
             ("input-type,y",po::value(&inputTypes), "The type of the input tensors in the network separated by comma. "
              "If unset, defaults to \"float\" for all defined inputs. "
              "Accepted values (float, int or qasymm8)")
@@ -5,6 +5,10 @@
 
 #include "../InferenceTestImage.hpp"
 
+#include <TensorDataset.hpp>
+
+#include <armnn/Exceptions.hpp>
+
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
@@ -14,15 +18,19 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace
 {
 
 // parses the command line to extract
-// * the input image file -i the input image file path (must exist)
+// * the input image file -i the input image file path (must exist), or a directory of images for binary output
 // * the layout -l the data layout output generated with (optional - default value is NHWC)
 // * the output file -o the output raw tensor file path (must not already exist)
+// * the output format -f "text" or "binary" (optional - default value is text)
 class CommandLineProcessor
 {
 public:
@@ -40,9 +48,21 @@ public:
             return false;
         }
 
-        if (boost::filesystem::is_directory(inputFileName))
+        // A whole directory of images goes into one binary dataset.
+        if (boost::filesystem::is_directory(inputFileName) && m_OutputFormat != "binary")
+        {
+            std::cerr << "Input file [" << inputFileName << "] is a directory, which needs binary output" << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool ValidateOutputFormat(const std::string& outputFormat)
+    {
+        if (outputFormat != "text" && outputFormat != "binary")
         {
-            std::cerr << "Input file [" << inputFileName << "] is a directory" << std::endl;
+            std::cerr << "Output format [" << outputFormat << "] is not supported" << std::endl;
             return false;
         }
 
@@ -116,7 +136,10 @@ public:
                 ("layout,l", po::value<std::string>(&m_Layout)->default_value("NHWC"),
                              "Output data layout, \"NHWC\" or \"NCHW\", default value NHWC")
                 ("outfile,o", po::value<std::string>(&m_OutputFileName)->required(),
-                              "Output raw tensor file path");
+                              "Output raw tensor file path")
+                ("format,f", po::value<std::string>(&m_OutputFormat)->default_value("text"),
+                             "Output format, \"text\" (space separated values) or \"binary\" (a tensor dataset, "
+                             "which can hold every image of an input directory), default value text");
         }
         catch (const std::exception& e)
         {
@@ -145,6 +168,11 @@ public:
             return false;
         }
 
+        if (!ValidateOutputFormat(m_OutputFormat))
+        {
+            return false;
+        }
+
         if (!ValidateInputFile(m_InputFileName))
         {
             return false;
@@ -166,13 +194,72 @@ public:
     std::string GetInputFileName() {return m_InputFileName;}
     std::string GetLayout() {return m_Layout;}
     std::string GetOutputFileName() {return m_OutputFileName;}
+    std::string GetOutputFormat() {return m_OutputFormat;}
 
 private:
     std::string m_InputFileName;
     std::string m_Layout;
     std::string m_OutputFileName;
+    std::string m_OutputFormat;
 };
 
+std::vector<float> LoadImageTensor(const std::string& imagePath, const std::string& layout, armnn::TensorShape& shape)
+{
+    InferenceTestImage testImage(imagePath.c_str());
+    const unsigned int height = testImage.GetHeight();
+    const unsigned int width = testImage.GetWidth();
+    if (layout == "NHWC")
+    {
+        shape = armnn::TensorShape({ 1, height, width, 3 });
+        return GetImageDataAsNormalizedFloats(ImageChannelLayout::Rgb, testImage);
+    }
+    shape = armnn::TensorShape({ 1, 3, height, width });
+    return GetImageDataInArmNnLayoutAsNormalizedFloats(ImageChannelLayout::Rgb, testImage);
+}
+
+// Writes every image into one dataset, named after the image files. The images must all have the same size.
+int WriteBinaryDataset(const std::vector<std::string>& imagePaths, const std::string& layout,
+                       const std::string& outputPath)
+{
+    std::unique_ptr<armnnUtils::TensorDatasetWriter> writer;
+    armnn::TensorShape firstShape;
+    for (const std::string& imagePath : imagePaths)
+    {
+        armnn::TensorShape shape;
+        std::vector<float> imageData;
+        try
+        {
+            imageData = LoadImageTensor(imagePath, layout, shape);
+        }
+        catch (const InferenceTestImageException& e)
+        {
+            BOOST_LOG_TRIVIAL(fatal) << "Failed to load image file " << imagePath << " with error: " << e.what();
+            return -1;
+        }
+
+        if (!writer)
+        {
+            firstShape = shape;
+            writer = std::make_unique<armnnUtils::TensorDatasetWriter>(
+                outputPath, armnn::TensorInfo(shape, armnn::DataType::Float32));
+        }
+        else if (shape != firstShape)
+        {
+            BOOST_LOG_TRIVIAL(fatal) << "Image " << imagePath << " is not the same size as the first image";
+            return -1;
+        }
+        writer->AddSample(imageData.data(), boost::filesystem::path(imagePath).stem().string());
+    }
+
+    if (!writer)
+    {
+        BOOST_LOG_TRIVIAL(fatal) << "No images to write";
+        return -1;
+    }
+    writer->Close();
+    return 0;
+}
+
 } // namespace anonymous
 
 int main(int argc, char* argv[])
@@ -186,14 +273,42 @@ int main(int argc, char* argv[])
     const std::string imagePath(cmdline.GetInputFileName());
     const std::string outputPath(cmdline.GetOutputFileName());
 
+    if (cmdline.GetOutputFormat() == "binary")
+    {
+        std::vector<std::string> imagePaths;
+        if (boost::filesystem::is_directory(imagePath))
+        {
+            for (const auto& entry : boost::filesystem::directory_iterator(imagePath))
+            {
+                if (boost::filesystem::is_regular_file(entry.path()))
+                {
+                    imagePaths.push_back(entry.path().string());
+                }
+            }
+            std::sort(imagePaths.begin(), imagePaths.end());
+        }
+        else
+        {
+            imagePaths.push_back(imagePath);
+        }
+
+        try
+        {
+            return WriteBinaryDataset(imagePaths, cmdline.GetLayout(), outputPath);
+        }
+        catch (const armnn::Exception& e)
+        {
+            BOOST_LOG_TRIVIAL(fatal) << "Failed to write output file " << outputPath << ": " << e.what();
+            return -1;
+        }
+    }
+
     // generate image tensor
     std::vector<float> imageData;
     try
     {
-        InferenceTestImage testImage(imagePath.c_str());
-        imageData = cmdline.GetLayout() == "NHWC"
-             ? GetImageDataAsNormalizedFloats(ImageChannelLayout::Rgb, testImage)
-             : GetImageDataInArmNnLayoutAsNormalizedFloats(ImageChannelLayout::Rgb, testImage);
+        armnn::TensorShape shape;
+        imageData = LoadImageTensor(imagePath, cmdline.GetLayout(), shape);
     }
     catch (const InferenceTestImageException& e)
     {
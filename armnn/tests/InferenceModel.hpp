@@ -34,6 +34,7 @@
 #include <chrono>
 #include <iterator>
 #include <fstream>
+#include <iomanip>
 #include <map>
 #include <string>
 #include <vector>
@@ -389,11 +390,15 @@ public:
             armnn::OptimizerOptions options;
             options.m_ReduceFp32ToFp16 = params.m_EnableFp16TurboMode;
 
+            auto optimizeStartTime = GetCurrentTime();
             optNet = armnn::Optimize(*network, params.m_ComputeDevices, m_Runtime->GetDeviceSpec(), options);
+            auto optimizeEndTime = GetCurrentTime();
             if (!optNet)
             {
                 throw armnn::Exception("Optimize returned nullptr");
             }
+            BOOST_LOG_TRIVIAL(info) << "Optimization time: " << std::setprecision(2) << std::fixed
+                                    << GetTimeDuration(optimizeStartTime, optimizeEndTime).count() << " ms";
         }
 
         if (params.m_VisualizePostOptimizationModel)
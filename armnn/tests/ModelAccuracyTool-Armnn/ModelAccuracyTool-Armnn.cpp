@@ -8,10 +8,20 @@
 #include "../ImagePreprocessor.hpp"
 #include "armnnDeserializer/IDeserializer.hpp"
 
+#include <TensorDataset.hpp>
+
 #include <boost/filesystem.hpp>
 #include <boost/range/iterator_range.hpp>
 #include <boost/program_options/variables_map.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 using namespace armnn::test;
 
 namespace po = boost::program_options;
@@ -78,6 +88,110 @@ auto ParseDataArray<armnn::DataType::Float32>(std::istream & stream)
     return ParseArrayImpl<float>(stream, [](const std::string& s) { return std::stof(s); });
 }
 
+namespace
+{
+
+struct Image
+{
+    std::string        m_Name;
+    std::vector<float> m_Data;
+};
+
+/// A bounded queue of loaded images between the loader thread and the inference workers, so that images are
+/// read and parsed while the previous ones run.
+class ImageQueue
+{
+public:
+    explicit ImageQueue(unsigned int capacity)
+        : m_Capacity(std::max(1u, capacity))
+        , m_Closed(false)
+    {}
+
+    /// Blocks while the queue is full. Returns false, dropping the image, once the queue has been closed.
+    bool Push(Image&& image)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_NotFull.wait(lock, [this]() { return m_Images.size() < m_Capacity || m_Closed; });
+        if (m_Closed)
+        {
+            return false;
+        }
+        m_Images.push_back(std::move(image));
+        m_NotEmpty.notify_one();
+        return true;
+    }
+
+    /// Blocks until an image is available. Returns false once the queue is closed and drained.
+    bool Pop(Image& image)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_NotEmpty.wait(lock, [this]() { return !m_Images.empty() || m_Closed; });
+        if (m_Images.empty())
+        {
+            return false;
+        }
+        image = std::move(m_Images.front());
+        m_Images.pop_front();
+        m_NotFull.notify_one();
+        return true;
+    }
+
+    void Close()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Closed = true;
+        m_NotFull.notify_all();
+        m_NotEmpty.notify_all();
+    }
+
+private:
+    const unsigned int      m_Capacity;
+    bool                    m_Closed;
+    std::deque<Image>       m_Images;
+    std::mutex              m_Mutex;
+    std::condition_variable m_NotFull;
+    std::condition_variable m_NotEmpty;
+};
+
+/// Pushes every image of the data set, either the samples of a binary tensor dataset or the text tensor files of
+/// a directory, until they run out or the queue is closed.
+void LoadImages(const std::string& dataDir, ImageQueue& queue)
+{
+    using namespace boost::filesystem;
+
+    if (is_regular_file(path(dataDir)))
+    {
+        // The samples of a binary tensor dataset are named after the images they were made from.
+        armnnUtils::TensorDataset dataset(dataDir);
+        if (dataset.GetSampleInfo().GetDataType() != armnn::DataType::Float32)
+        {
+            throw armnn::InvalidArgumentException("The tensor dataset " + dataDir + " does not hold Float32 data");
+        }
+        const unsigned int numElements = dataset.GetSampleInfo().GetNumElements();
+        for (unsigned int i = 0; i < dataset.GetNumSamples(); ++i)
+        {
+            const float* sample = dataset.GetSample<float>(i);
+            if (!queue.Push({ dataset.GetSampleName(i), std::vector<float>(sample, sample + numElements) }))
+            {
+                return;
+            }
+        }
+        return;
+    }
+
+    for (auto & imageEntry : boost::make_iterator_range(directory_iterator(path(dataDir)), {}))
+    {
+        std::ifstream inputTensorFile(imageEntry.path().string());
+        if (!queue.Push({ imageEntry.path().filename().string(),
+                          ParseDataArray<armnn::DataType::Float32>(inputTensorFile) }))
+        {
+            return;
+        }
+    }
+}
+
+} // anonymous namespace
+
 int main(int argc, char* argv[])
 {
     try
@@ -97,6 +211,8 @@ int main(int argc, char* argv[])
         std::string inputName;
         std::string outputName;
         std::string validationLabelPath;
+        unsigned int numWorkers;
+        unsigned int prefetchImages;
 
         const std::string backendsMessage = "Which device to run layers on by default. Possible choices: "
                                             + armnn::BackendRegistryInstance().GetBackendIdsAsString();
@@ -111,13 +227,17 @@ int main(int argc, char* argv[])
                 ("compute,c", po::value<std::vector<armnn::BackendId>>(&computeDevice)->default_value(defaultBackends),
                  backendsMessage.c_str())
                 ("data-dir,d", po::value<std::string>(&dataDir)->required(),
-                 "Path to directory containing the ImageNet test data")
+                 "Path to directory containing the ImageNet test data, or to a binary tensor dataset file")
                 ("input-name,i", po::value<std::string>(&inputName)->required(),
                  "Identifier of the input tensors in the network separated by comma.")
                 ("output-name,o", po::value<std::string>(&outputName)->required(),
                  "Identifier of the output tensors in the network separated by comma.")
                 ("validation-labels-path,v", po::value<std::string>(&validationLabelPath)->required(),
-                 "Path to ImageNet Validation Label file");
+                 "Path to ImageNet Validation Label file")
+                ("num-workers,w", po::value<unsigned int>(&numWorkers)->default_value(1),
+                 "Number of inference workers. Each worker runs its own copy of the network on the same runtime.")
+                ("prefetch-images,p", po::value<unsigned int>(&prefetchImages)->default_value(16),
+                 "Maximum number of images loaded ahead of the inference workers.");
         }
         catch (const std::exception& e)
         {
@@ -170,27 +290,37 @@ int main(int argc, char* argv[])
         // Create a network
         armnn::INetworkPtr network = armnnparser->CreateNetworkFromBinary(file);
 
-        // Optimizes the network.
-        armnn::IOptimizedNetworkPtr optimizedNet(nullptr, nullptr);
-        try
+        if (numWorkers == 0)
         {
-            optimizedNet = armnn::Optimize(*network, computeDevice, runtime->GetDeviceSpec());
-        }
-        catch (armnn::Exception& e)
-        {
-            std::stringstream message;
-            message << "armnn::Exception (" << e.what() << ") caught from optimize.";
-            BOOST_LOG_TRIVIAL(fatal) << message.str();
+            BOOST_LOG_TRIVIAL(fatal) << "At least one inference worker is required";
             return 1;
         }
 
-        // Loads the network into the runtime.
-        armnn::NetworkId networkId;
-        status = runtime->LoadNetwork(networkId, std::move(optimizedNet));
-        if (status == armnn::Status::Failure)
+        // Each worker runs its own loaded copy of the network, as a loaded network runs one inference at a time.
+        std::vector<armnn::NetworkId> networkIds(numWorkers);
+        for (armnn::NetworkId& networkId : networkIds)
         {
-            BOOST_LOG_TRIVIAL(fatal) << "armnn::IRuntime: Failed to load network";
-            return 1;
+            // Optimizes the network.
+            armnn::IOptimizedNetworkPtr optimizedNet(nullptr, nullptr);
+            try
+            {
+                optimizedNet = armnn::Optimize(*network, computeDevice, runtime->GetDeviceSpec());
+            }
+            catch (armnn::Exception& e)
+            {
+                std::stringstream message;
+                message << "armnn::Exception (" << e.what() << ") caught from optimize.";
+                BOOST_LOG_TRIVIAL(fatal) << message.str();
+                return 1;
+            }
+
+            // Loads the network into the runtime.
+            status = runtime->LoadNetwork(networkId, std::move(optimizedNet));
+            if (status == armnn::Status::Failure)
+            {
+                BOOST_LOG_TRIVIAL(fatal) << "armnn::IRuntime: Failed to load network";
+                return 1;
+            }
         }
 
         // Set up Network
@@ -215,35 +345,98 @@ int main(int argc, char* argv[])
         armnnUtils::ModelAccuracyChecker checker(validationLabels);
         using TContainer = boost::variant<std::vector<float>, std::vector<int>, std::vector<uint8_t>>;
 
-        if(ValidateDirectory(dataDir))
+        const bool isDataset = is_regular_file(pathToDataDir) && armnnUtils::TensorDataset::IsTensorDataset(dataDir);
+        if (!isDataset && !ValidateDirectory(dataDir))
         {
-            for (auto & imageEntry : boost::make_iterator_range(directory_iterator(pathToDataDir), {}))
-            {
-                cout << "Processing image: " << imageEntry << "\n";
+            return 1;
+        }
+
+        // One loader thread parses images ahead of the workers; each worker runs its own network and scores its
+        // results straight into the checker, whose counts are atomic.
+        ImageQueue queue(prefetchImages);
+        std::exception_ptr loaderError;
+        std::mutex workerErrorMutex;
+        std::exception_ptr workerError;
 
-                std::ifstream inputTensorFile(imageEntry.path().string());
-                vector<TContainer> inputDataContainers;
-                inputDataContainers.push_back(ParseDataArray<armnn::DataType::Float32>(inputTensorFile));
-                vector<TContainer> outputDataContainers = {vector<float>(1001)};
+        const auto startTime = std::chrono::steady_clock::now();
 
-                status = runtime->EnqueueWorkload(networkId,
-                                                  armnnUtils::MakeInputTensors(inputBindings, inputDataContainers),
-                                                  armnnUtils::MakeOutputTensors(outputBindings, outputDataContainers));
+        std::thread loader([&]()
+        {
+            try
+            {
+                LoadImages(dataDir, queue);
+            }
+            catch (...)
+            {
+                loaderError = std::current_exception();
+            }
+            queue.Close();
+        });
 
-                if (status == armnn::Status::Failure)
+        std::vector<std::thread> workers;
+        for (armnn::NetworkId networkId : networkIds)
+        {
+            workers.emplace_back([&, networkId]()
+            {
+                try
+                {
+                    vector<TContainer> outputDataContainers = {vector<float>(1001)};
+                    Image image;
+                    while (queue.Pop(image))
+                    {
+                        vector<TContainer> inputDataContainers;
+                        inputDataContainers.push_back(std::move(image.m_Data));
+
+                        armnn::Status workerStatus = runtime->EnqueueWorkload(
+                            networkId,
+                            armnnUtils::MakeInputTensors(inputBindings, inputDataContainers),
+                            armnnUtils::MakeOutputTensors(outputBindings, outputDataContainers));
+
+                        if (workerStatus == armnn::Status::Failure)
+                        {
+                            BOOST_LOG_TRIVIAL(fatal) << "armnn::IRuntime: Failed to enqueue workload for image: "
+                                                     << image.m_Name;
+                        }
+
+                        checker.AddImageResult<TContainer>(image.m_Name, outputDataContainers);
+                    }
+                }
+                catch (...)
                 {
-                    BOOST_LOG_TRIVIAL(fatal) << "armnn::IRuntime: Failed to enqueue workload for image: " << imageEntry;
+                    std::lock_guard<std::mutex> lock(workerErrorMutex);
+                    if (!workerError)
+                    {
+                        workerError = std::current_exception();
+                    }
+                    queue.Close();
                 }
+            });
+        }
 
-                const std::string imageName = imageEntry.path().filename().string();
-                checker.AddImageResult<TContainer>(imageName, outputDataContainers);
-            }
+        for (std::thread& worker : workers)
+        {
+            worker.join();
         }
-        else
+        // Workers that stopped early leave the loader blocked on a full queue.
+        queue.Close();
+        loader.join();
+
+        if (loaderError)
         {
-            return 1;
+            std::rethrow_exception(loaderError);
+        }
+        if (workerError)
+        {
+            std::rethrow_exception(workerError);
         }
 
+        const double seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        const unsigned int imagesProcessed = checker.GetImagesProcessed();
+        std::cout << "Processed " << imagesProcessed << " images in " << seconds << " s ("
+                  << (seconds > 0.0 ? imagesProcessed / seconds : 0.0) << " images/sec) with " << numWorkers
+                  << " worker(s)" << "\n";
+
         for(unsigned int i = 1; i <= 5; ++i)
         {
             std::cout << "Top " << i <<  " Accuracy: " << checker.GetAccuracy(i) << "%" << "\n";
@@ -5,7 +5,9 @@
 #include <iostream>
 #include <chrono>
 #include <vector>
+#include <algorithm>
 #include <array>
+#include <thread>
 #include <boost/log/trivial.hpp>
 
 #include "armnn/ArmNN.hpp"
@@ -40,6 +42,7 @@ int main(int argc, char* argv[])
         std::vector<armnn::BackendId> defaultBackends = {armnn::Compute::CpuAcc, armnn::Compute::CpuRef};
         std::string modelDir;
         std::string dataDir;
+        unsigned int schedulerThreads = 0;
 
         const std::string backendsMessage = "Which device to run layers on by default. Possible choices: "
                                           + armnn::BackendRegistryInstance().GetBackendIdsAsString();
@@ -55,7 +58,10 @@ int main(int argc, char* argv[])
                 ("compute,c", po::value<std::vector<armnn::BackendId>>(&computeDevice)->default_value(defaultBackends),
                     backendsMessage.c_str())
                 ("data-dir,d", po::value<std::string>(&dataDir)->required(),
-                    "Path to directory containing the Cifar10 test data");
+                    "Path to directory containing the Cifar10 test data")
+                ("scheduler-threads,s", po::value<unsigned int>(&schedulerThreads)->default_value(0),
+                    "If non-zero, the networks run concurrently on a shared pool of this many runtime worker threads "
+                    "instead of one after the other on the main thread");
         }
         catch (const std::exception& e)
         {
@@ -105,6 +111,7 @@ int main(int argc, char* argv[])
 
         // Create runtime
         armnn::IRuntime::CreationOptions options;
+        options.m_NumSchedulerThreads = schedulerThreads;
         armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
 
         // Loads networks.
@@ -182,7 +189,8 @@ int main(int argc, char* argv[])
                 outputs.push_back(std::vector<float>(10));
             }
 
-            for (unsigned int k = 0; k < networksCount; ++k)
+            std::vector<armnn::Status> statuses(networksCount, armnn::Status::Success);
+            auto runNetwork = [&](unsigned int k)
             {
                 std::vector<armnn::BindingPointInfo> inputBindings  = { networks[k].m_InputBindingInfo  };
                 std::vector<armnn::BindingPointInfo> outputBindings = { networks[k].m_OutputBindingInfo };
@@ -190,16 +198,38 @@ int main(int argc, char* argv[])
                 std::vector<TContainer> inputDataContainers = { testCaseData->m_InputImage };
                 std::vector<TContainer> outputDataContainers = { outputs[k] };
 
-                status = runtime->EnqueueWorkload(networks[k].m_Network,
+                statuses[k] = runtime->EnqueueWorkload(networks[k].m_Network,
                     armnnUtils::MakeInputTensors(inputBindings, inputDataContainers),
                     armnnUtils::MakeOutputTensors(outputBindings, outputDataContainers));
-                if (status == armnn::Status::Failure)
+            };
+
+            if (schedulerThreads > 0)
+            {
+                // Submit all networks at once and let the runtime scheduler share its worker pool between them.
+                std::vector<std::thread> callers;
+                for (unsigned int k = 0; k < networksCount; ++k)
                 {
-                    BOOST_LOG_TRIVIAL(fatal) << "armnn::IRuntime: Failed to enqueue workload";
-                    return 1;
+                    callers.emplace_back(runNetwork, k);
+                }
+                for (std::thread& caller : callers)
+                {
+                    caller.join();
+                }
+            }
+            else
+            {
+                for (unsigned int k = 0; k < networksCount; ++k)
+                {
+                    runNetwork(k);
                 }
             }
 
+            if (std::find(statuses.begin(), statuses.end(), armnn::Status::Failure) != statuses.end())
+            {
+                BOOST_LOG_TRIVIAL(fatal) << "armnn::IRuntime: Failed to enqueue workload";
+                return 1;
+            }
+
             // Compares outputs.
             std::vector<float> output0 = boost::get<std::vector<float>>(outputs[0]);
 
@@ -215,6 +245,18 @@ int main(int argc, char* argv[])
             }
         }
 
+        if (schedulerThreads > 0)
+        {
+            for (const Net& net : networks)
+            {
+                armnn::NetworkSchedulingCounters counters = runtime->GetNetworkSchedulingCounters(net.m_Network);
+                BOOST_LOG_TRIVIAL(info) << "Network " << net.m_Network << ": " << counters.m_CompletedRequests
+                                        << " requests, mean queue latency " << counters.m_MeanQueueLatencyUs
+                                        << " us (max " << counters.m_MaxQueueLatencyUs << " us), mean execution "
+                                        << counters.m_MeanExecutionLatencyUs << " us";
+            }
+        }
+
         BOOST_LOG_TRIVIAL(info) << "Multiple networks inference ran successfully!";
         return 0;
     }
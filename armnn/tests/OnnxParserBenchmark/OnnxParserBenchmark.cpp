@@ -0,0 +1,285 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <armnnOnnxParser/IOnnxParser.hpp>
+
+#include <onnx/onnx.pb.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__)
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+
+// parses the command line to extract
+// * the model file -m to generate or to parse
+// * whether to generate the model -g, and its number of layers -l, their size -s and where their weights are stored -e
+class CommandLineProcessor
+{
+public:
+    bool ProcessCommandLine(int argc, char* argv[])
+    {
+        namespace po = boost::program_options;
+
+        po::options_description desc("Options");
+        try
+        {
+            desc.add_options()
+                ("help,h", "Display help messages")
+                ("model,m", po::value<std::string>(&m_ModelPath)->required(),
+                            "Path of the .onnx model file to generate or to parse")
+                ("generate,g", po::bool_switch(&m_Generate),
+                               "Generate a synthetic model at the model path instead of parsing it")
+                ("layers,l", po::value<unsigned int>(&m_NumLayers)->default_value(16),
+                             "Number of fully connected layers of the generated model")
+                ("size,s", po::value<unsigned int>(&m_LayerSize)->default_value(2048),
+                           "Number of inputs and outputs of each layer of the generated model")
+                ("external-data,e", po::bool_switch(&m_ExternalData),
+                                    "Store the weights of the generated model in an external data file, next to the "
+                                    "model file");
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Fatal internal error: [" << e.what() << "]" << std::endl;
+            return false;
+        }
+
+        po::variables_map vm;
+
+        try
+        {
+            po::store(po::parse_command_line(argc, argv, desc), vm);
+
+            if (vm.count("help"))
+            {
+                std::cout << desc << std::endl;
+                return false;
+            }
+
+            po::notify(vm);
+        }
+        catch (const po::error& e)
+        {
+            std::cerr << e.what() << std::endl << std::endl;
+            std::cerr << desc << std::endl;
+            return false;
+        }
+
+        if (m_LayerSize == 0)
+        {
+            std::cerr << "The layer size must not be 0" << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    const std::string& GetModelPath() const { return m_ModelPath; }
+    bool GetGenerate() const { return m_Generate; }
+    unsigned int GetNumLayers() const { return m_NumLayers; }
+    unsigned int GetLayerSize() const { return m_LayerSize; }
+    bool GetExternalData() const { return m_ExternalData; }
+
+private:
+    std::string  m_ModelPath;
+    bool         m_Generate = false;
+    unsigned int m_NumLayers = 0;
+    unsigned int m_LayerSize = 0;
+    bool         m_ExternalData = false;
+};
+
+void AddValueInfo(google::protobuf::RepeatedPtrField<onnx::ValueInfoProto>* list,
+                  const std::string& name,
+                  const std::vector<int64_t>& dims)
+{
+    onnx::ValueInfoProto* info = list->Add();
+    info->set_name(name);
+    onnx::TypeProto_Tensor* tensorType = info->mutable_type()->mutable_tensor_type();
+    tensorType->set_elem_type(onnx::TensorProto::FLOAT);
+    for (int64_t dim : dims)
+    {
+        tensorType->mutable_shape()->add_dim()->set_dim_value(dim);
+    }
+}
+
+std::string EncodeExternalDataEntry(const std::string& key, const std::string& value)
+{
+    // A StringStringEntryProto, encoded by hand as the onnx.proto of ONNX versions before 1.3 does not define the
+    // external data fields. Both strings are short enough for their length to fit in a single byte.
+    std::string entry;
+    entry.push_back(static_cast<char>((1 << 3) | 2));
+    entry.push_back(static_cast<char>(key.size()));
+    entry += key;
+    entry.push_back(static_cast<char>((2 << 3) | 2));
+    entry.push_back(static_cast<char>(value.size()));
+    entry += value;
+    return entry;
+}
+
+/// Generates a chain of MatMul and Add nodes, which the parser turns into fully connected layers.
+int GenerateModel(const CommandLineProcessor& cmdline)
+{
+    const int64_t size = cmdline.GetLayerSize();
+    const std::string dataFileName = boost::filesystem::path(cmdline.GetModelPath()).filename().string() + ".data";
+    const std::string dataPath =
+        (boost::filesystem::path(cmdline.GetModelPath()).parent_path() / dataFileName).string();
+
+    std::ofstream dataFile;
+    if (cmdline.GetExternalData())
+    {
+        dataFile.open(dataPath, std::ios::binary);
+        if (!dataFile)
+        {
+            std::cerr << "Failed to open external data file: " << dataPath << std::endl;
+            return -1;
+        }
+    }
+    uint64_t dataOffset = 0;
+
+    onnx::ModelProto model;
+    model.set_ir_version(3);
+    model.set_producer_name("OnnxParserBenchmark");
+    model.add_opset_import()->set_version(7);
+
+    onnx::GraphProto* graph = model.mutable_graph();
+    graph->set_name("OnnxParserBenchmark");
+    AddValueInfo(graph->mutable_input(), "Input", { 1, size });
+
+    auto addInitializer = [&](const std::string& name, const std::vector<int64_t>& dims)
+    {
+        AddValueInfo(graph->mutable_input(), name, dims);
+
+        uint64_t numElements = 1;
+        onnx::TensorProto* tensor = graph->add_initializer();
+        tensor->set_name(name);
+        tensor->set_data_type(onnx::TensorProto::FLOAT);
+        for (int64_t dim : dims)
+        {
+            tensor->add_dims(dim);
+            numElements *= static_cast<uint64_t>(dim);
+        }
+
+        const std::vector<float> data(numElements, 1.0f / static_cast<float>(size));
+        const size_t numBytes = data.size() * sizeof(float);
+        if (cmdline.GetExternalData())
+        {
+            dataFile.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(numBytes));
+
+            google::protobuf::UnknownFieldSet* fields = tensor->GetReflection()->MutableUnknownFields(tensor);
+            fields->AddLengthDelimited(13, EncodeExternalDataEntry("location", dataFileName));
+            fields->AddLengthDelimited(13, EncodeExternalDataEntry("offset", std::to_string(dataOffset)));
+            fields->AddLengthDelimited(13, EncodeExternalDataEntry("length", std::to_string(numBytes)));
+            fields->AddVarint(14, 1);
+            dataOffset += numBytes;
+        }
+        else
+        {
+            tensor->set_raw_data(data.data(), numBytes);
+        }
+    };
+
+    std::string previousOutput = "Input";
+    for (unsigned int layer = 0; layer < cmdline.GetNumLayers(); ++layer)
+    {
+        const std::string suffix = std::to_string(layer);
+        addInitializer("Weight" + suffix, { size, size });
+        addInitializer("Bias" + suffix, { size });
+
+        onnx::NodeProto* matmul = graph->add_node();
+        matmul->set_name("MatMul" + suffix);
+        matmul->set_op_type("MatMul");
+        matmul->add_input(previousOutput);
+        matmul->add_input("Weight" + suffix);
+        matmul->add_output("MatMulOutput" + suffix);
+
+        onnx::NodeProto* add = graph->add_node();
+        add->set_name("Add" + suffix);
+        add->set_op_type("Add");
+        add->add_input("MatMulOutput" + suffix);
+        add->add_input("Bias" + suffix);
+        add->add_output("Output" + suffix);
+
+        AddValueInfo(graph->mutable_value_info(), "MatMulOutput" + suffix, { 1, size });
+        previousOutput = "Output" + suffix;
+    }
+    AddValueInfo(graph->mutable_output(), previousOutput, { 1, size });
+
+    std::ofstream modelFile(cmdline.GetModelPath(), std::ios::binary);
+    if (!model.SerializeToOstream(&modelFile))
+    {
+        std::cerr << "Failed to write model file: " << cmdline.GetModelPath() << std::endl;
+        return -1;
+    }
+
+    std::cout << "Generated " << cmdline.GetModelPath() << " with " << cmdline.GetNumLayers() << " layers of "
+              << size << "x" << size << " weights";
+    if (cmdline.GetExternalData())
+    {
+        std::cout << ", stored in " << dataPath;
+    }
+    std::cout << std::endl;
+    return 0;
+}
+
+/// The peak resident set size of the process in kilobytes, or 0 where it is not known.
+long GetPeakResidentSetSizeKb()
+{
+#if defined(__unix__)
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        return usage.ru_maxrss;
+    }
+#endif
+    return 0;
+}
+
+int ParseModel(const CommandLineProcessor& cmdline)
+{
+    const long baselinePeakKb = GetPeakResidentSetSizeKb();
+
+    armnnOnnxParser::IOnnxParserPtr parser = armnnOnnxParser::IOnnxParser::Create();
+    const auto start = std::chrono::steady_clock::now();
+    armnn::INetworkPtr network = parser->CreateNetworkFromBinaryFile(cmdline.GetModelPath().c_str());
+    const auto end = std::chrono::steady_clock::now();
+
+    const long peakKb = GetPeakResidentSetSizeKb();
+    std::cout << "Parse time: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms"
+              << std::endl;
+    std::cout << "Peak resident set size: " << peakKb << " KB (" << peakKb - baselinePeakKb
+              << " KB more than before parsing)" << std::endl;
+    return 0;
+}
+
+} // namespace anonymous
+
+int main(int argc, char* argv[])
+{
+    CommandLineProcessor cmdline;
+    if (!cmdline.ProcessCommandLine(argc, argv))
+    {
+        return -1;
+    }
+
+    try
+    {
+        return cmdline.GetGenerate() ? GenerateModel(cmdline) : ParseModel(cmdline);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return -1;
+    }
+}